@@ -0,0 +1,133 @@
+// Unit test utils
+#include <predefined_utils/benchmark/fixtures/graph_bench_fixtures.h>
+
+// Day 5 graph path finding library
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/w1d5_graph_path_finding/dag_shortest_paths.h>
+#include <lib3611/w1d5_graph_path_finding/dijkstra_shortest_paths.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <random>
+#include <vector>
+
+// Qualify predefined fixtures
+using namespace dte3611::predef::benchmarking::graph::fixtures;
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+
+namespace
+{
+  struct EdgeProperties {
+    double distance{0.};
+  };
+
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS,
+                                      boost::no_property, EdgeProperties>;
+
+  const auto distance_op = [](auto const& e, auto const& g) { return g[e].distance; };
+}   // namespace
+
+// The predefined six-vertex DAG, A -> E
+BENCHMARK_DEFINE_F(BenchDagOneF, dijkstraShortestPaths)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(alg::dijkstraShortestPaths(m_graph->graph(), m_graph->a(),
+                                                        m_graph->e(), distance_op));
+}
+
+BENCHMARK_DEFINE_F(BenchDagOneF, dagShortestPaths)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(
+      alg::dagShortestPaths(m_graph->graph(), m_graph->a(), m_graph->e(), distance_op));
+}
+
+BENCHMARK_REGISTER_F(BenchDagOneF, dijkstraShortestPaths);
+BENCHMARK_REGISTER_F(BenchDagOneF, dagShortestPaths);
+
+// Random DAG, range(0) vertices with 4 out-edges each to higher indices,
+// weights in [-1, 8) so that some are negative; queries 0 -> n - 1
+struct RandomDagF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~RandomDagF() override {}
+
+  Graph                                              m_graph;
+  gutl::CsrGraph<boost::no_property, EdgeProperties> m_csr;   // same DAG in CSR form
+  std::vector<std::size_t>                           m_order;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    auto const                       n = static_cast<std::size_t>(st.range(0));
+    std::mt19937                     rng(42);
+    std::uniform_real_distribution<> weight(-1., 8.);
+
+    m_graph = Graph(n);
+    for (std::size_t u = 0; u + 1 < n; ++u) {
+      std::uniform_int_distribution<std::size_t> later(u + 1, n - 1);
+      for (int k = 0; k < 4; ++k) boost::add_edge(u, later(rng), {weight(rng)}, m_graph);
+    }
+    m_csr   = gutl::makeCsrGraph(m_graph);
+    m_order = alg::topologicalSort(m_graph);
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_graph.clear();
+    m_csr = {};
+    m_order.clear();
+  }
+};
+
+// Dijkstra is only a baseline here: with negative weights its answers may be wrong
+BENCHMARK_DEFINE_F(RandomDagF, dijkstraShortestPaths)(benchmark::State& st)
+{
+  auto const goal = boost::num_vertices(m_graph) - 1;
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(alg::dijkstraShortestPaths(m_graph, 0, goal, distance_op));
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_DEFINE_F(RandomDagF, dagShortestPaths)(benchmark::State& st)
+{
+  auto const goal = boost::num_vertices(m_graph) - 1;
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(alg::dagShortestPaths(m_graph, 0, goal, distance_op));
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+// Topological order computed once, as for repeated queries on one DAG
+BENCHMARK_DEFINE_F(RandomDagF, dagShortestPathsSharedOrder)(benchmark::State& st)
+{
+  auto const goal = boost::num_vertices(m_graph) - 1;
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(
+      alg::dagShortestPaths<Graph>(m_order, m_graph, 0, goal, distance_op));
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_DEFINE_F(RandomDagF, dagShortestPathsCsr)(benchmark::State& st)
+{
+  std::vector<std::uint32_t> const order(m_order.begin(), m_order.end());
+
+  auto const goal = static_cast<std::uint32_t>(boost::num_vertices(m_csr) - 1);
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(
+      alg::dagShortestPaths<decltype(m_csr)>(order, m_csr, 0, goal, distance_op));
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_REGISTER_F(RandomDagF, dijkstraShortestPaths)
+  ->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RandomDagF, dagShortestPaths)
+  ->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RandomDagF, dagShortestPathsSharedOrder)
+  ->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RandomDagF, dagShortestPathsCsr)
+  ->RangeMultiplier(8)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Day 5 graph path finding library
+#include <lib3611/w1d5_graph_path_finding/dijkstra_shortest_paths.h>
+#include <lib3611/w1d5_graph_path_finding/shortest_path_cache.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace alg = dte3611::graph::algorithms;
+
+namespace
+{
+  struct EdgeProperties {
+    double distance{0.};
+  };
+
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS,
+                                      boost::no_property, EdgeProperties>;
+
+  struct DistanceOp {
+    double operator()(Graph::edge_descriptor const& e, Graph const& g) const
+    {
+      return g[e].distance;
+    }
+  };
+}   // namespace
+
+// Random 4000-vertex graph, 4 out-edges per vertex, integral weights 1..8;
+// range(0) hot (start, goal) pairs drawn from 8 starts
+struct HotQueriesF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~HotQueriesF() override {}
+
+  Graph                                                  m_graph;
+  std::vector<std::pair<std::size_t, std::size_t>>       m_queries;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    std::mt19937                               rng(42);
+    std::uniform_int_distribution<std::size_t> vertex(0, 3999);
+    std::uniform_int_distribution<>            weight(1, 8);
+
+    m_graph = Graph(4000);
+    for (std::size_t u = 0; u < 4000; ++u)
+      for (int k = 0; k < 4; ++k)
+        boost::add_edge(u, vertex(rng), {double(weight(rng))}, m_graph);
+
+    m_queries.clear();
+    for (std::int64_t q = 0; q < st.range(0); ++q)
+      m_queries.emplace_back(q % 8, vertex(rng));
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_graph.clear();
+    m_queries.clear();
+  }
+};
+
+BENCHMARK_DEFINE_F(HotQueriesF, uncached)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto const& [start, goal] : m_queries)
+      benchmark::DoNotOptimize(
+        alg::dijkstraShortestPaths(m_graph, start, goal, DistanceOp{}));
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+// Cache persists across iterations, as in a long-running service
+BENCHMARK_DEFINE_F(HotQueriesF, cached)(benchmark::State& st)
+{
+  alg::ShortestPathCache<Graph> cache(m_graph, std::size_t{64} << 20);
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto const& [start, goal] : m_queries)
+      benchmark::DoNotOptimize(
+        cache.dijkstraShortestPaths(start, goal, DistanceOp{}));
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+// Cache cleared every iteration: first query per start searches, the rest
+// of its goals come from the cached tree
+BENCHMARK_DEFINE_F(HotQueriesF, coldCache)(benchmark::State& st)
+{
+  alg::ShortestPathCache<Graph> cache(m_graph, std::size_t{64} << 20);
+
+  for ([[maybe_unused]] auto const& _ : st) {
+    cache.invalidate();
+    for (auto const& [start, goal] : m_queries)
+      benchmark::DoNotOptimize(
+        cache.dijkstraShortestPaths(start, goal, DistanceOp{}));
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_REGISTER_F(HotQueriesF, uncached)->Arg(64)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(HotQueriesF, cached)->Arg(64)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(HotQueriesF, coldCache)->Arg(64)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,145 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Day 4 graph traversal library
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/utils/csr_graph_file.h>
+#include <lib3611/w1d4_graph_traversal/breadth_first_search.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// posix
+#include <unistd.h>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+
+namespace
+{
+  struct EdgeProperties {
+    double distance{0.};
+  };
+
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS,
+                                      boost::no_property, EdgeProperties>;
+  using Edges = std::vector<gutl::CsrGraph<>::edge_entry>;
+
+  double parseDistance(std::string_view rest)
+  {
+    double     d     = 0.;
+    auto const first = rest.find_first_not_of(" \t");
+    if (first != std::string_view::npos)
+      std::from_chars(rest.data() + first, rest.data() + rest.size(), d);
+    return d;
+  }
+}   // namespace
+
+// range(0) random weighted edges over range(0) / 8 vertices, held in memory
+// and written once as a text edge list and as a binary graph file
+struct GraphFilesF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~GraphFilesF() override {}
+
+  std::size_t           m_vertices{0};
+  Edges                 m_edges;
+  std::vector<double>   m_distances;
+  std::filesystem::path m_text;
+  std::filesystem::path m_binary;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    auto const m = static_cast<std::size_t>(st.range(0));
+    m_vertices   = m / 8;
+
+    std::mt19937                                 rng(42);
+    std::uniform_int_distribution<std::uint32_t> vertex(0, std::uint32_t(m_vertices - 1));
+    std::uniform_int_distribution<>              weight(1, 100);
+
+    m_edges.clear();
+    m_distances.clear();
+    for (std::size_t i = 0; i < m; ++i) {
+      m_edges.emplace_back(vertex(rng), vertex(rng));
+      m_distances.push_back(weight(rng));
+    }
+
+    auto const tmp = std::filesystem::temp_directory_path();
+    auto const tag = std::to_string(::getpid()) + "_" + std::to_string(m);
+    m_text         = tmp / ("dte3611_edges_" + tag + ".txt");
+    m_binary       = tmp / ("dte3611_graph_" + tag + ".csr");
+
+    {
+      std::ofstream out(m_text);
+      for (std::size_t i = 0; i < m; ++i)
+        out << m_edges[i].first << ' ' << m_edges[i].second << ' ' << m_distances[i] << '\n';
+    }
+    std::vector<EdgeProperties> bundles;
+    for (auto d : m_distances) bundles.push_back({d});
+    gutl::writeCsrGraph(m_binary, gutl::CsrGraph<boost::no_property, EdgeProperties>(
+                                    m_vertices, m_edges, std::move(bundles)));
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    std::filesystem::remove(m_text);
+    std::filesystem::remove(m_binary);
+    m_edges.clear();
+    m_distances.clear();
+  }
+};
+
+// Today's startup: one boost::add_edge per edge, from edges already in memory
+BENCHMARK_DEFINE_F(GraphFilesF, addEdgeStartup)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st) {
+    Graph g(m_vertices);
+    for (std::size_t i = 0; i < m_edges.size(); ++i)
+      boost::add_edge(m_edges[i].first, m_edges[i].second, {m_distances[i]}, g);
+    benchmark::DoNotOptimize(g);
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_DEFINE_F(GraphFilesF, importEdgeList)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(gutl::importEdgeList(m_text, parseDistance));
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_DEFINE_F(GraphFilesF, loadCsrGraph)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(gutl::loadCsrGraph<boost::no_property, EdgeProperties>(m_binary));
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+// Load plus a first BFS, which faults in the pages it touches
+BENCHMARK_DEFINE_F(GraphFilesF, loadCsrGraphAndBfs)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st) {
+    auto const g = gutl::loadCsrGraph<boost::no_property, EdgeProperties>(m_binary);
+    benchmark::DoNotOptimize(alg::breadthFirstSearch(g, 0u));
+  }
+  st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+BENCHMARK_REGISTER_F(GraphFilesF, addEdgeStartup)
+  ->RangeMultiplier(8)->Range(1 << 20, 1 << 23)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(GraphFilesF, importEdgeList)
+  ->RangeMultiplier(8)->Range(1 << 20, 1 << 23)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(GraphFilesF, loadCsrGraph)
+  ->RangeMultiplier(8)->Range(1 << 20, 1 << 23)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(GraphFilesF, loadCsrGraphAndBfs)
+  ->RangeMultiplier(8)->Range(1 << 20, 1 << 23)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,345 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/strong_components.hpp>
+
+// Day 4 graph traversal library
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/utils/graph_reordering.h>
+#include <lib3611/w1d4_graph_traversal/breadth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/connected_components.h>
+#include <lib3611/w1d4_graph_traversal/depth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/direction_optimizing_bfs.h>
+#include <lib3611/w1d4_graph_traversal/multi_source_bfs.h>
+#include <lib3611/w1d4_graph_traversal/parallel_bfs.h>
+#include <lib3611/w1d4_graph_traversal/traversal_views.h>
+#include <lib3611/w1d4_graph_traversal/traversal_visitors.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <set>
+#include <stack>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+
+namespace
+{
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS>;
+
+  // The traversals as they were before the dense containers: std::set
+  // visited sets, std::queue / std::stack, a neighbour vector per vertex
+  std::vector<std::size_t> setBasedBfs(Graph const& g, std::size_t start)
+  {
+    std::vector<std::size_t> order;
+    std::set<std::size_t>    visited{start};
+    std::queue<std::size_t>  q;
+    for (q.push(start); !q.empty(); q.pop()) {
+      order.push_back(q.front());
+      for (auto v : boost::make_iterator_range(boost::adjacent_vertices(q.front(), g)))
+        if (visited.insert(v).second) q.push(v);
+    }
+    return order;
+  }
+
+  std::vector<std::size_t> setBasedDfs(Graph const& g, std::size_t start)
+  {
+    std::vector<std::size_t> order;
+    std::set<std::size_t>    visited;
+    std::stack<std::size_t>  s;
+    for (s.push(start); !s.empty();) {
+      auto const u = s.top();
+      s.pop();
+      if (not visited.insert(u).second) continue;
+      order.push_back(u);
+      std::vector<std::size_t> next;
+      for (auto v : boost::make_iterator_range(boost::adjacent_vertices(u, g)))
+        if (not visited.contains(v)) next.push_back(v);
+      for (auto it = next.rbegin(); it != next.rend(); ++it) s.push(*it);
+    }
+    return order;
+  }
+}   // namespace
+
+// Random graph, range(0) vertices with range(1) out-edges each
+struct RandomGraphF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~RandomGraphF() override {}
+
+  Graph            m_graph;
+  gutl::CsrGraph<> m_csr;   // same graph in CSR form
+
+  void SetUp(const benchmark::State& st) final
+  {
+    auto const                                 n = static_cast<std::size_t>(st.range(0));
+    std::mt19937                               rng(42);
+    std::uniform_int_distribution<std::size_t> vertex(0, n - 1);
+
+    m_graph = Graph(n);
+    for (std::size_t u = 0; u < n; ++u)
+      for (std::int64_t k = 0; k < st.range(1); ++k) boost::add_edge(u, vertex(rng), m_graph);
+    m_csr = gutl::makeCsrGraph(m_graph);
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_graph.clear();
+    m_csr = {};
+  }
+};
+
+#define DTE3611_TRAVERSAL_BENCHMARK_ON(NAME, CALL, GRAPH)                      \
+  BENCHMARK_DEFINE_F(RandomGraphF, NAME)(benchmark::State & st)               \
+  {                                                                            \
+    for ([[maybe_unused]] auto const& _ : st)                                  \
+      benchmark::DoNotOptimize(CALL(GRAPH, 0));                                \
+    st.SetItemsProcessed(st.iterations() * st.range(0));                       \
+  }                                                                            \
+  BENCHMARK_REGISTER_F(RandomGraphF, NAME)                                     \
+    ->ArgsProduct({{1 << 12, 1 << 15, 1 << 18, 1 << 21}, {8}})                 \
+    ->Args({1 << 19, 32})                                                      \
+    ->Unit(benchmark::kMillisecond);
+
+#define DTE3611_TRAVERSAL_BENCHMARK(NAME, CALL)                                \
+  DTE3611_TRAVERSAL_BENCHMARK_ON(NAME, CALL, m_graph)
+
+DTE3611_TRAVERSAL_BENCHMARK(setBasedBfs, setBasedBfs)
+DTE3611_TRAVERSAL_BENCHMARK(breadthFirstSearch, alg::breadthFirstSearch)
+DTE3611_TRAVERSAL_BENCHMARK_ON(breadthFirstSearchCsr, alg::breadthFirstSearch, m_csr)
+
+// Levels and parents; forced top-down vs Beamer switching
+auto topDownBfs(Graph const& g, std::size_t start)
+{
+  return alg::directionOptimizingBfs(g, start, {.direction = alg::bfs_direction::top_down});
+}
+
+auto directionOptimizingBfs(Graph const& g, std::size_t start)
+{
+  return alg::directionOptimizingBfs(g, start);
+}
+
+DTE3611_TRAVERSAL_BENCHMARK(topDownBfs, topDownBfs)
+DTE3611_TRAVERSAL_BENCHMARK(directionOptimizingBfs, directionOptimizingBfs)
+DTE3611_TRAVERSAL_BENCHMARK_ON(directionOptimizingBfsCsr, alg::directionOptimizingBfs, m_csr)
+
+auto parallelBfs(Graph const& g, std::size_t start)
+{
+  return alg::parallelBfs(g, start);
+}
+
+DTE3611_TRAVERSAL_BENCHMARK(parallelBfs, parallelBfs)
+
+// First vertex with an index divisible by 1000 -- eager search vs lazy view
+std::size_t firstMatchEager(Graph const& g, std::size_t start)
+{
+  auto const order = alg::breadthFirstSearch(g, start);
+  return *std::ranges::find_if(order, [](auto v) { return v % 1000 == 0; });
+}
+
+std::size_t firstMatchView(Graph const& g, std::size_t start)
+{
+  auto view = alg::breadthFirstView(g, start);
+  return *std::ranges::find_if(view, [](auto v) { return v % 1000 == 0; });
+}
+
+DTE3611_TRAVERSAL_BENCHMARK(firstMatchEager, firstMatchEager)
+DTE3611_TRAVERSAL_BENCHMARK(firstMatchView, firstMatchView)
+// Visitor traversals: no hooks at all, and one counting discoveries
+struct DiscoveryCount {
+  std::size_t count{0};
+  void discover_vertex(std::size_t, Graph const&) { ++count; }
+};
+
+std::size_t emptyVisitorBfs(Graph const& g, std::size_t start)
+{
+  struct {} nothing;
+  alg::breadthFirstVisit(g, start, nothing);
+  return start;
+}
+
+std::size_t countingVisitorBfs(Graph const& g, std::size_t start)
+{
+  DiscoveryCount counter;
+  alg::breadthFirstVisit(g, start, counter);
+  return counter.count;
+}
+
+std::size_t countingVisitorDfs(Graph const& g, std::size_t start)
+{
+  DiscoveryCount counter;
+  alg::depthFirstVisit(g, start, counter);
+  return counter.count;
+}
+
+DTE3611_TRAVERSAL_BENCHMARK(emptyVisitorBfs, emptyVisitorBfs)
+DTE3611_TRAVERSAL_BENCHMARK(countingVisitorBfs, countingVisitorBfs)
+DTE3611_TRAVERSAL_BENCHMARK(setBasedDfs, setBasedDfs)
+DTE3611_TRAVERSAL_BENCHMARK(depthFirstSearch, alg::depthFirstSearch)
+DTE3611_TRAVERSAL_BENCHMARK_ON(depthFirstSearchCsr, alg::depthFirstSearch, m_csr)
+DTE3611_TRAVERSAL_BENCHMARK(countingVisitorDfs, countingVisitorDfs)
+
+// Hop distances from 256 sources: one BFS each vs 64- and 256-wide MS-BFS
+std::vector<std::size_t> spreadSources(std::size_t n)
+{
+  std::vector<std::size_t> sources(256);
+  for (std::size_t i = 0; i < sources.size(); ++i) sources[i] = i * (n / sources.size());
+  return sources;
+}
+
+BENCHMARK_DEFINE_F(RandomGraphF, perSourceBfs)(benchmark::State& st)
+{
+  auto const sources = spreadSources(boost::num_vertices(m_csr));
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto s : sources) benchmark::DoNotOptimize(alg::directionOptimizingBfs(m_csr, s));
+  st.SetItemsProcessed(st.iterations() * 256);
+}
+
+template <std::size_t Words_V>
+void multiSourceBfs(benchmark::State& st, gutl::CsrGraph<> const& g)
+{
+  auto const                 wide = spreadSources(boost::num_vertices(g));
+  std::vector<std::uint32_t> sources(wide.begin(), wide.end());
+  for ([[maybe_unused]] auto const& _ : st) {
+    std::size_t sum = 0;
+    alg::multiSourceBfs<Words_V>(g, sources, [&](std::size_t, auto, std::size_t d) { sum += d; });
+    benchmark::DoNotOptimize(sum);
+  }
+  st.SetItemsProcessed(st.iterations() * 256);
+}
+
+BENCHMARK_DEFINE_F(RandomGraphF, multiSourceBfs64)(benchmark::State& st)
+{
+  multiSourceBfs<1>(st, m_csr);
+}
+
+BENCHMARK_DEFINE_F(RandomGraphF, multiSourceBfs256)(benchmark::State& st)
+{
+  multiSourceBfs<4>(st, m_csr);
+}
+
+BENCHMARK_REGISTER_F(RandomGraphF, perSourceBfs)
+  ->Args({1 << 15, 8})
+  ->Args({1 << 18, 8})
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RandomGraphF, multiSourceBfs64)
+  ->Args({1 << 15, 8})
+  ->Args({1 << 18, 8})
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RandomGraphF, multiSourceBfs256)
+  ->Args({1 << 15, 8})
+  ->Args({1 << 18, 8})
+  ->Unit(benchmark::kMillisecond);
+
+// Components of the whole graph; the start argument is ignored
+std::size_t boostStrongComponents(Graph const& g, std::size_t)
+{
+  std::vector<std::size_t> component(boost::num_vertices(g));
+  return boost::strong_components(
+    g, boost::make_iterator_property_map(component.begin(), boost::get(boost::vertex_index, g)));
+}
+
+template <typename Graph_T>
+auto stronglyConnectedComponents(Graph_T const& g, std::size_t)
+{
+  return alg::stronglyConnectedComponents(g);
+}
+
+template <typename Graph_T>
+auto weaklyConnectedComponents(Graph_T const& g, std::size_t)
+{
+  return alg::weaklyConnectedComponents(g);
+}
+
+auto parallelWeaklyConnectedComponents(gutl::CsrGraph<> const& g, std::size_t)
+{
+  return alg::weaklyConnectedComponents(dte3611::utils::defaultThreadPool(), g);
+}
+
+DTE3611_TRAVERSAL_BENCHMARK(boostStrongComponents, boostStrongComponents)
+DTE3611_TRAVERSAL_BENCHMARK(stronglyConnectedComponents, stronglyConnectedComponents)
+DTE3611_TRAVERSAL_BENCHMARK_ON(stronglyConnectedComponentsCsr, stronglyConnectedComponents, m_csr)
+DTE3611_TRAVERSAL_BENCHMARK_ON(weaklyConnectedComponentsCsr, weaklyConnectedComponents, m_csr)
+DTE3611_TRAVERSAL_BENCHMARK_ON(parallelWeaklyConnectedComponentsCsr,
+                               parallelWeaklyConnectedComponents, m_csr)
+
+// range(0) x range(0) grid with edges both ways and shuffled vertex ids --
+// ingestion order -- relabeled by range(1): 0 none, 1 RCM, 2 BFS, 3 degree.
+// edge_gap is the mean id distance across an edge, a proxy for the cache
+// lines a traversal touches.
+struct ShuffledGridF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~ShuffledGridF() override {}
+
+  gutl::CsrGraph<> m_csr;
+  std::uint32_t    m_start{0};
+  double           m_edge_gap{0.};
+
+  void SetUp(const benchmark::State& st) final
+  {
+    auto const side = static_cast<std::size_t>(st.range(0));
+
+    std::vector<std::uint32_t> id(side * side);
+    std::iota(id.begin(), id.end(), std::uint32_t{0});
+    std::shuffle(id.begin(), id.end(), std::mt19937(42));
+
+    std::vector<gutl::CsrGraph<>::edge_entry> edges;
+    for (std::size_t r = 0; r < side; ++r)
+      for (std::size_t c = 0; c < side; ++c) {
+        auto const u = id[r * side + c];
+        if (c + 1 < side) {
+          edges.emplace_back(u, id[r * side + c + 1]);
+          edges.emplace_back(id[r * side + c + 1], u);
+        }
+        if (r + 1 < side) {
+          edges.emplace_back(u, id[(r + 1) * side + c]);
+          edges.emplace_back(id[(r + 1) * side + c], u);
+        }
+      }
+    m_csr   = gutl::CsrGraph<>(side * side, edges);
+    m_start = id[0];
+
+    if (st.range(1) > 0) {
+      constexpr gutl::vertex_order orders[] = {gutl::vertex_order::reverse_cuthill_mckee,
+                                               gutl::vertex_order::breadth_first,
+                                               gutl::vertex_order::degree};
+      auto const relabeling = gutl::computeVertexOrder(m_csr, orders[st.range(1) - 1]);
+      m_csr   = gutl::relabelGraph(m_csr, relabeling);
+      m_start = relabeling.new_id[m_start];
+    }
+
+    double gap = 0.;
+    for (auto e : boost::make_iterator_range(boost::edges(m_csr)))
+      gap += std::abs(double(e.source) - double(e.target));
+    m_edge_gap = gap / double(boost::num_edges(m_csr));
+  }
+
+  void TearDown(const benchmark::State&) final { m_csr = {}; }
+};
+
+#define DTE3611_REORDERING_BENCHMARK(NAME, CALL)                               \
+  BENCHMARK_DEFINE_F(ShuffledGridF, NAME)(benchmark::State & st)              \
+  {                                                                            \
+    for ([[maybe_unused]] auto const& _ : st)                                  \
+      benchmark::DoNotOptimize(CALL(m_csr, m_start));                          \
+    st.SetItemsProcessed(st.iterations() * st.range(0) * st.range(0));         \
+    st.counters["edge_gap"] = m_edge_gap;                                      \
+  }                                                                            \
+  BENCHMARK_REGISTER_F(ShuffledGridF, NAME)                                    \
+    ->ArgsProduct({{1 << 9, 1 << 11}, {0, 1, 2, 3}})                           \
+    ->Unit(benchmark::kMillisecond);
+
+DTE3611_REORDERING_BENCHMARK(reorderedBfs, alg::breadthFirstSearch)
+DTE3611_REORDERING_BENCHMARK(reorderedDirectionOptimizingBfs, alg::directionOptimizingBfs)
+DTE3611_REORDERING_BENCHMARK(reorderedDfs, alg::depthFirstSearch)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,125 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Day 4 graph traversal library
+#include <lib3611/w1d4_graph_traversal/breadth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/depth_first_search.h>
+
+// Day 5 graph path finding library
+#include <lib3611/w1d5_graph_path_finding/dijkstra_shortest_paths.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <random>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+
+namespace
+{
+  struct EdgeProperties {
+    double distance{1.};
+  };
+
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS,
+                                      boost::no_property, EdgeProperties>;
+
+  auto const distance_op = [](auto const& e, auto const& g) { return g[e].distance; };
+}   // namespace
+
+// range(0) vertices in blocks of 64, 4 random out-edges per vertex within its
+// block -- every query reaches at most 64 vertices; 256 queries per iteration
+struct SmallQueriesF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~SmallQueriesF() override {}
+
+  Graph                    m_graph;
+  std::vector<std::size_t> m_starts;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    auto const                                 n = static_cast<std::size_t>(st.range(0));
+    std::mt19937                               rng(42);
+    std::uniform_int_distribution<std::size_t> offset(0, 63);
+    std::uniform_int_distribution<std::size_t> vertex(0, n - 1);
+    std::uniform_int_distribution<>            weight(1, 8);
+
+    m_graph = Graph(n);
+    for (std::size_t u = 0; u < n; ++u)
+      for (int k = 0; k < 4; ++k)
+        boost::add_edge(u, std::min(n - 1, u / 64 * 64 + offset(rng)),
+                        {double(weight(rng))}, m_graph);
+
+    m_starts.resize(256);
+    for (auto& s : m_starts) s = vertex(rng);
+  }
+
+  void TearDown(const benchmark::State&) final { m_graph.clear(); }
+};
+
+BENCHMARK_DEFINE_F(SmallQueriesF, breadthFirstSearch)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto s : m_starts) benchmark::DoNotOptimize(alg::breadthFirstSearch(m_graph, s));
+  st.SetItemsProcessed(st.iterations() * 256);
+}
+
+BENCHMARK_DEFINE_F(SmallQueriesF, breadthFirstSearchWorkspace)(benchmark::State& st)
+{
+  gutl::TraversalWorkspace<Graph> workspace(m_graph);
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto s : m_starts)
+      benchmark::DoNotOptimize(alg::breadthFirstSearch(workspace, m_graph, s));
+  st.SetItemsProcessed(st.iterations() * 256);
+}
+
+BENCHMARK_DEFINE_F(SmallQueriesF, depthFirstSearch)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto s : m_starts) benchmark::DoNotOptimize(alg::depthFirstSearch(m_graph, s));
+  st.SetItemsProcessed(st.iterations() * 256);
+}
+
+BENCHMARK_DEFINE_F(SmallQueriesF, depthFirstSearchWorkspace)(benchmark::State& st)
+{
+  gutl::TraversalWorkspace<Graph> workspace(m_graph);
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto s : m_starts)
+      benchmark::DoNotOptimize(alg::depthFirstSearch(workspace, m_graph, s));
+  st.SetItemsProcessed(st.iterations() * 256);
+}
+
+BENCHMARK_DEFINE_F(SmallQueriesF, dijkstraShortestPaths)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto s : m_starts)
+      benchmark::DoNotOptimize(
+        alg::dijkstraShortestPaths(m_graph, s, s / 64 * 64, distance_op));
+  st.SetItemsProcessed(st.iterations() * 256);
+}
+
+BENCHMARK_DEFINE_F(SmallQueriesF, dijkstraShortestPathsWorkspace)(benchmark::State& st)
+{
+  gutl::TraversalWorkspace<Graph> workspace(m_graph);
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto s : m_starts)
+      benchmark::DoNotOptimize(
+        alg::dijkstraShortestPaths(workspace, m_graph, s, s / 64 * 64, distance_op));
+  st.SetItemsProcessed(st.iterations() * 256);
+}
+
+BENCHMARK_REGISTER_F(SmallQueriesF, breadthFirstSearch)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SmallQueriesF, breadthFirstSearchWorkspace)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SmallQueriesF, depthFirstSearch)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SmallQueriesF, depthFirstSearchWorkspace)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SmallQueriesF, dijkstraShortestPaths)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SmallQueriesF, dijkstraShortestPathsWorkspace)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+#include <lib3611/w1d3_string_match/aho_corasick_search.h>
+#include <lib3611/w1d3_string_match/compiled_pattern.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <random>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+
+// Keyword tagging: a growing dictionary over a fixed 1 MB document
+struct KeywordDictionaryF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~KeywordDictionaryF() override {}
+
+  std::string              m_document;
+  std::vector<std::string> m_keywords;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    auto const n_keywords = static_cast<std::size_t>(st.range(0));
+
+    std::mt19937                    rng(42);
+    std::uniform_int_distribution<> ch_dist('a', 'z');
+    std::uniform_int_distribution<> len_dist(4, 12);
+
+    auto random_string = [&](std::size_t len) {
+      std::string s(len, ' ');
+      for (auto& ch : s) ch = static_cast<char>(ch_dist(rng));
+      return s;
+    };
+
+    m_document = random_string(std::size_t{1} << 20);
+
+    m_keywords.clear();
+    for (std::size_t i = 0; i < n_keywords; ++i)
+      m_keywords.push_back(random_string(static_cast<std::size_t>(len_dist(rng))));
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_document.clear();
+    m_keywords.clear();
+  }
+};
+
+BENCHMARK_DEFINE_F(KeywordDictionaryF, ahoCorasick)(benchmark::State& st)
+{
+  alg::aho_corasick_automaton<char> const automaton(m_keywords);
+
+  for ([[maybe_unused]] auto const& _ : st) {
+    std::size_t hits = 0;
+    automaton.forEachMatch(m_document.begin(), m_document.end(),
+                           [&hits](auto const&) { ++hits; });
+    benchmark::DoNotOptimize(hits);
+  }
+  st.SetBytesProcessed(st.iterations()
+                       * static_cast<std::int64_t>(m_document.size()));
+  st.counters["states"] = static_cast<double>(automaton.stateCount());
+}
+
+BENCHMARK_DEFINE_F(KeywordDictionaryF, bmhPerKeyword)(benchmark::State& st)
+{
+  std::vector<decltype(alg::compile_pattern<alg::bmh_search>(m_keywords.front()))>
+    compiled;
+  for (auto const& keyword : m_keywords)
+    compiled.push_back(alg::compile_pattern<alg::bmh_search>(keyword));
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto const& keyword : compiled)
+      benchmark::DoNotOptimize(keyword.search(m_document));
+  st.SetBytesProcessed(st.iterations()
+                       * static_cast<std::int64_t>(m_document.size()));
+}
+
+BENCHMARK_REGISTER_F(KeywordDictionaryF, ahoCorasick)
+  ->RangeMultiplier(10)
+  ->Range(10, 20000)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(KeywordDictionaryF, bmhPerKeyword)
+  ->RangeMultiplier(10)
+  ->Range(10, 1000)
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+#include <lib3611/w1d3_string_match/approximate_search.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+
+// Random DNA haystack, pattern of length m with a k = m / 8 error budget
+struct ApproximateF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~ApproximateF() override {}
+
+  std::string m_haystack;
+  std::string m_pattern;
+  std::size_t m_budget{0};
+
+  void SetUp(const benchmark::State& st) final
+  {
+    std::mt19937                    rng(3611);
+    std::uniform_int_distribution<> base_dist(0, 3);
+    m_haystack.resize(std::size_t{1} << 18);
+    for (auto& ch : m_haystack) ch = "ACGT"[base_dist(rng)];
+
+    auto const m = static_cast<std::size_t>(st.range(0));
+    m_pattern    = m_haystack.substr(m_haystack.size() / 2, m);
+    m_budget     = m / 8;
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_haystack.clear();
+    m_pattern.clear();
+  }
+
+  template <typename Search_T>
+  void run(benchmark::State& st, Search_T const& search) const
+  {
+    for ([[maybe_unused]] auto const& _ : st)
+      benchmark::DoNotOptimize(search(m_haystack, m_pattern, m_budget));
+    st.SetBytesProcessed(st.iterations()
+                         * static_cast<std::int64_t>(m_haystack.size()));
+  }
+};
+
+// Reference: Sellers' column-wise DP, O(nm)
+std::vector<std::size_t> sellersSearch(std::string const& text,
+                                       std::string const& pat, std::size_t k)
+{
+  std::vector<std::size_t> col(pat.size() + 1), ends;
+  for (std::size_t i = 0; i < col.size(); ++i) col[i] = i;
+  for (std::size_t j = 0; j < text.size(); ++j) {
+    std::size_t diag = col[0];
+    col[0]           = 0;
+    for (std::size_t i = 1; i < col.size(); ++i) {
+      std::size_t const up = col[i];
+      col[i] = std::min({col[i] + 1, col[i - 1] + 1,
+                         diag + (pat[i - 1] == text[j] ? 0 : 1)});
+      diag   = up;
+    }
+    if (col.back() <= k) ends.push_back(j + 1);
+  }
+  return ends;
+}
+
+BENCHMARK_DEFINE_F(ApproximateF, bitap)(benchmark::State& st)
+{
+  run(st, alg::bitap_search);
+}
+BENCHMARK_DEFINE_F(ApproximateF, myers)(benchmark::State& st)
+{
+  run(st, alg::myers_search);
+}
+BENCHMARK_DEFINE_F(ApproximateF, sellersDp)(benchmark::State& st)
+{
+  run(st, sellersSearch);
+}
+
+BENCHMARK_REGISTER_F(ApproximateF, bitap)->RangeMultiplier(2)->Range(8, 64);
+BENCHMARK_REGISTER_F(ApproximateF, myers)->RangeMultiplier(4)->Range(8, 1024);
+BENCHMARK_REGISTER_F(ApproximateF, sellersDp)->RangeMultiplier(4)->Range(8, 1024);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+#include <lib3611/w1d3_string_match/naive_search.h>
+#include <lib3611/w1d3_string_match/kmp_search.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <cctype>
+#include <random>
+#include <string>
+
+namespace alg = dte3611::string_match::algorithms;
+
+// 1 MiB of random lowercase text, a 16 byte pattern only at the very end
+struct ByteTextF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~ByteTextF() override {}
+
+  std::string m_haystack;
+  std::string m_pattern;
+
+  void SetUp(const benchmark::State&) final
+  {
+    std::mt19937                    rng(3611);
+    std::uniform_int_distribution<> ch_dist('a', 'z');
+    m_haystack.resize(std::size_t{1} << 20);
+    for (auto& ch : m_haystack) ch = static_cast<char>(ch_dist(rng));
+
+    m_pattern = "needleinhaystack";
+    m_haystack.replace(m_haystack.size() - m_pattern.size(), m_pattern.size(),
+                       m_pattern);
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_haystack.clear();
+    m_pattern.clear();
+  }
+
+  template <typename Search_T>
+  void run(benchmark::State& st, Search_T const& search) const
+  {
+    for ([[maybe_unused]] auto const& _ : st)
+      benchmark::DoNotOptimize(search(m_haystack, m_pattern));
+    st.SetBytesProcessed(st.iterations()
+                         * static_cast<std::int64_t>(m_haystack.size()));
+  }
+};
+
+namespace
+{
+  // Same comparisons as the defaults, but opaque to the fast-path detection
+  auto const plainEqual = [](char a, char b) { return a == b; };
+
+  char lower(char c)
+  {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  }
+  auto const caselessEqual = [](char a, char b) { return lower(a) == lower(b); };
+}   // namespace
+
+BENCHMARK_DEFINE_F(ByteTextF, naiveMemchr)(benchmark::State& st)
+{
+  run(st, [](auto const& h, auto const& p) { return alg::naive_search(h, p); });
+}
+BENCHMARK_DEFINE_F(ByteTextF, naiveGeneric)(benchmark::State& st)
+{
+  run(st, [](auto const& h, auto const& p) {
+    return alg::naive_search(h, p, plainEqual);
+  });
+}
+BENCHMARK_DEFINE_F(ByteTextF, kmpMemchr)(benchmark::State& st)
+{
+  run(st, [](auto const& h, auto const& p) { return alg::kmp_search(h, p); });
+}
+BENCHMARK_DEFINE_F(ByteTextF, kmpGeneric)(benchmark::State& st)
+{
+  run(st, [](auto const& h, auto const& p) {
+    return alg::kmp_search(h, p, plainEqual);
+  });
+}
+BENCHMARK_DEFINE_F(ByteTextF, kmpCaseFoldTable)(benchmark::State& st)
+{
+  auto const folded = dte3611::string_match::utils::makeByteTranslation<char>(lower);
+  run(st, [&folded](auto const& h, auto const& p) {
+    return alg::kmp_search(h, p, {}, folded, lower);
+  });
+}
+BENCHMARK_DEFINE_F(ByteTextF, kmpCaseFoldProjection)(benchmark::State& st)
+{
+  run(st, [](auto const& h, auto const& p) {
+    return alg::kmp_search(h, p, {}, lower, lower);
+  });
+}
+BENCHMARK_DEFINE_F(ByteTextF, kmpCaseFoldPredicate)(benchmark::State& st)
+{
+  run(st, [](auto const& h, auto const& p) {
+    return alg::kmp_search(h, p, caselessEqual);
+  });
+}
+
+BENCHMARK_REGISTER_F(ByteTextF, naiveMemchr);
+BENCHMARK_REGISTER_F(ByteTextF, naiveGeneric);
+BENCHMARK_REGISTER_F(ByteTextF, kmpMemchr);
+BENCHMARK_REGISTER_F(ByteTextF, kmpGeneric);
+BENCHMARK_REGISTER_F(ByteTextF, kmpCaseFoldTable);
+BENCHMARK_REGISTER_F(ByteTextF, kmpCaseFoldProjection);
+BENCHMARK_REGISTER_F(ByteTextF, kmpCaseFoldPredicate);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+#include <lib3611/w1d3_string_match/compiled_pattern.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <random>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+
+// Many short records, a handful of patterns -- preprocessing dominates
+// unless it is amortized across records
+struct ShortRecordsF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~ShortRecordsF() override {}
+
+  std::vector<std::string> m_records;
+  std::vector<std::string> m_patterns;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    auto const record_len = static_cast<std::size_t>(st.range(0));
+
+    std::mt19937                    rng(42);
+    std::uniform_int_distribution<> ch_dist('a', 'z');
+
+    auto random_string = [&](std::size_t len) {
+      std::string s(len, ' ');
+      for (auto& ch : s) ch = static_cast<char>(ch_dist(rng));
+      return s;
+    };
+
+    m_records.clear();
+    for (int i = 0; i < 4096; ++i) m_records.push_back(random_string(record_len));
+
+    m_patterns.clear();
+    for (int i = 0; i < 16; ++i) m_patterns.push_back(random_string(12));
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_records.clear();
+    m_patterns.clear();
+  }
+
+  template <auto Engine_V>
+  void runPerCall(benchmark::State& st) const
+  {
+    for ([[maybe_unused]] auto const& _ : st)
+      for (auto const& pattern : m_patterns)
+        for (auto const& record : m_records)
+          benchmark::DoNotOptimize(Engine_V(record, pattern));
+  }
+
+  template <auto Engine_V>
+  void runCompiled(benchmark::State& st) const
+  {
+    std::vector<decltype(alg::compile_pattern<Engine_V>(m_patterns.front()))>
+      compiled;
+    for (auto const& pattern : m_patterns)
+      compiled.push_back(alg::compile_pattern<Engine_V>(pattern));
+
+    for ([[maybe_unused]] auto const& _ : st)
+      for (auto const& pattern : compiled)
+        for (auto const& record : m_records)
+          benchmark::DoNotOptimize(pattern.search(record));
+  }
+};
+
+BENCHMARK_DEFINE_F(ShortRecordsF, kmpPerCall)(benchmark::State& st)
+{
+  runPerCall<alg::kmp_search>(st);
+}
+BENCHMARK_DEFINE_F(ShortRecordsF, kmpCompiled)(benchmark::State& st)
+{
+  runCompiled<alg::kmp_search>(st);
+}
+BENCHMARK_DEFINE_F(ShortRecordsF, bmhPerCall)(benchmark::State& st)
+{
+  runPerCall<alg::bmh_search>(st);
+}
+BENCHMARK_DEFINE_F(ShortRecordsF, bmhCompiled)(benchmark::State& st)
+{
+  runCompiled<alg::bmh_search>(st);
+}
+BENCHMARK_DEFINE_F(ShortRecordsF, krPerCall)(benchmark::State& st)
+{
+  runPerCall<alg::kr_search>(st);
+}
+BENCHMARK_DEFINE_F(ShortRecordsF, krCompiled)(benchmark::State& st)
+{
+  runCompiled<alg::kr_search>(st);
+}
+BENCHMARK_DEFINE_F(ShortRecordsF, twoWayPerCall)(benchmark::State& st)
+{
+  runPerCall<alg::two_way_search>(st);
+}
+BENCHMARK_DEFINE_F(ShortRecordsF, twoWayCompiled)(benchmark::State& st)
+{
+  runCompiled<alg::two_way_search>(st);
+}
+
+BENCHMARK_REGISTER_F(ShortRecordsF, kmpPerCall)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK_REGISTER_F(ShortRecordsF, kmpCompiled)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK_REGISTER_F(ShortRecordsF, bmhPerCall)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK_REGISTER_F(ShortRecordsF, bmhCompiled)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK_REGISTER_F(ShortRecordsF, krPerCall)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK_REGISTER_F(ShortRecordsF, krCompiled)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK_REGISTER_F(ShortRecordsF, twoWayPerCall)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK_REGISTER_F(ShortRecordsF, twoWayCompiled)->Arg(32)->Arg(128)->Arg(512);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+#include <lib3611/w1d3_string_match/file_search.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+
+namespace alg = dte3611::string_match::algorithms;
+namespace fs  = std::filesystem;
+
+// Largest file generated by default. The pipeline target is up to 10 GB;
+// raise this (disk and page cache permitting) to reproduce those sizes.
+constexpr std::int64_t max_file_size = std::int64_t{1} << 28;
+
+// Log-grep: count every occurrence of a token in a file on disk
+struct LogFileF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~LogFileF() override {}
+
+  fs::path    m_path;
+  std::string m_pattern{"ERROR"};
+  std::size_t m_size{0};
+
+  void SetUp(const benchmark::State& st) final
+  {
+    m_size = static_cast<std::size_t>(st.range(0));
+    m_path = fs::temp_directory_path() / "dte3611_file_search_bench.log";
+
+    std::mt19937                    rng(42);
+    std::uniform_int_distribution<> ch_dist('a', 'z');
+
+    // Written in blocks so the fixture itself stays small
+    std::string block(std::size_t{1} << 20, ' ');
+    for (auto& ch : block) ch = static_cast<char>(ch_dist(rng));
+    for (std::size_t pos = 0; pos + m_pattern.size() < block.size(); pos += 4096)
+      block.replace(pos, m_pattern.size(), m_pattern);
+
+    std::ofstream out(m_path, std::ios::binary);
+    for (std::size_t written = 0; written < m_size; written += block.size())
+      out.write(block.data(),
+                static_cast<std::streamsize>(std::min(block.size(), m_size - written)));
+  }
+
+  void TearDown(const benchmark::State&) final { fs::remove(m_path); }
+};
+
+BENCHMARK_DEFINE_F(LogFileF, ifstreamRead)(benchmark::State& st)
+{
+  auto const compiled = alg::compile_pattern<alg::bmh_search>(m_pattern);
+
+  for ([[maybe_unused]] auto const& _ : st) {
+    std::ifstream     in(m_path, std::ios::binary);
+    std::string const content{std::istreambuf_iterator<char>(in), {}};
+
+    std::size_t hits = 0;
+    for (auto it = compiled.search(content); it != content.end();
+         it      = compiled.search(std::next(it), content.end()))
+      ++hits;
+    benchmark::DoNotOptimize(hits);
+  }
+  st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(m_size));
+}
+
+BENCHMARK_DEFINE_F(LogFileF, mmapSearch)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st) {
+    std::size_t hits = 0;
+    alg::file_search_all<alg::bmh_search>(m_path, m_pattern,
+                                          [&hits](std::size_t) { ++hits; });
+    benchmark::DoNotOptimize(hits);
+  }
+  st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(m_size));
+}
+
+BENCHMARK_REGISTER_F(LogFileF, ifstreamRead)
+  ->RangeMultiplier(16)
+  ->Range(std::int64_t{1} << 20, max_file_size)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LogFileF, mmapSearch)
+  ->RangeMultiplier(16)
+  ->Range(std::int64_t{1} << 20, max_file_size)
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
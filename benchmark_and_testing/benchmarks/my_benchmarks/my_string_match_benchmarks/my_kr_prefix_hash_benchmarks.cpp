@@ -0,0 +1,110 @@
+#include <lib3611/w1d3_string_match/kr_prefix_hash.h>
+#include <lib3611/w1d3_string_match/parallel_search.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <random>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+namespace utl = dte3611::utils;
+
+// 64 MB haystack and 64 equal-length queries drawn from it
+struct PrefixHashF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~PrefixHashF() override {}
+
+  std::string              m_haystack;
+  std::vector<std::string> m_queries;
+
+  void SetUp(const benchmark::State&) final
+  {
+    std::mt19937                    rng(42);
+    std::uniform_int_distribution<> ch_dist('a', 'z');
+
+    m_haystack.assign(std::size_t{1} << 26, ' ');
+    for (auto& ch : m_haystack) ch = static_cast<char>(ch_dist(rng));
+
+    std::uniform_int_distribution<std::size_t> pos_dist(0, m_haystack.size() - 32);
+    m_queries.clear();
+    for (int q = 0; q < 64; ++q) m_queries.push_back(m_haystack.substr(pos_dist(rng), 32));
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_haystack.clear();
+    m_queries.clear();
+  }
+};
+
+// Table build; range(0) is the pool size
+BENCHMARK_DEFINE_F(PrefixHashF, build)(benchmark::State& st)
+{
+  utl::ThreadPool pool(static_cast<std::size_t>(st.range(0)));
+
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(alg::kr_prefix_hashes(pool, m_haystack));
+  st.SetBytesProcessed(st.iterations()
+                       * static_cast<std::int64_t>(m_haystack.size()));
+}
+
+// range(0) queries against a prebuilt table, one at a time
+BENCHMARK_DEFINE_F(PrefixHashF, prefixTableQueries)(benchmark::State& st)
+{
+  alg::kr_prefix_hashes const table(m_haystack);
+  auto const                  queries = static_cast<std::size_t>(st.range(0));
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (std::size_t q = 0; q < queries; ++q)
+      benchmark::DoNotOptimize(table.findAll(m_queries[q]));
+}
+
+// range(0) queries against a prebuilt table, in one batch
+BENCHMARK_DEFINE_F(PrefixHashF, prefixTableBatch)(benchmark::State& st)
+{
+  alg::kr_prefix_hashes const table(m_haystack);
+  std::vector<std::string> const batch(
+    m_queries.begin(), m_queries.begin() + static_cast<std::ptrdiff_t>(st.range(0)));
+
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(table.findAllOf(batch));
+}
+
+// range(0) queries, each a fresh rolling-hash scan
+BENCHMARK_DEFINE_F(PrefixHashF, rollingHashQueries)(benchmark::State& st)
+{
+  utl::ThreadPool pool(1);
+  auto const      queries = static_cast<std::size_t>(st.range(0));
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (std::size_t q = 0; q < queries; ++q)
+      benchmark::DoNotOptimize(
+        alg::parallel_search_all<alg::kr_search>(pool, m_haystack, m_queries[q]));
+}
+
+BENCHMARK_REGISTER_F(PrefixHashF, build)
+  ->RangeMultiplier(2)
+  ->Range(1, 16)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(PrefixHashF, prefixTableQueries)
+  ->RangeMultiplier(4)
+  ->Range(1, 64)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(PrefixHashF, prefixTableBatch)
+  ->RangeMultiplier(4)
+  ->Range(1, 64)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(PrefixHashF, rollingHashQueries)
+  ->RangeMultiplier(4)
+  ->Range(1, 64)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
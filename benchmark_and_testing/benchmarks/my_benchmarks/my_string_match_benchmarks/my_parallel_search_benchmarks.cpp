@@ -0,0 +1,72 @@
+#include <lib3611/w1d3_string_match/parallel_search.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <random>
+#include <string>
+
+namespace alg = dte3611::string_match::algorithms;
+namespace utl = dte3611::utils;
+
+// Find-all over a 64 MB haystack; serial (1 thread) vs. a growing pool
+struct LargeHaystackF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~LargeHaystackF() override {}
+
+  std::string m_haystack;
+  std::string m_pattern;
+
+  void SetUp(const benchmark::State&) final
+  {
+    std::mt19937                    rng(42);
+    std::uniform_int_distribution<> ch_dist('a', 'z');
+
+    m_haystack.assign(std::size_t{1} << 26, ' ');
+    for (auto& ch : m_haystack) ch = static_cast<char>(ch_dist(rng));
+    m_pattern = m_haystack.substr(m_haystack.size() / 2, 16);
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_haystack.clear();
+    m_pattern.clear();
+  }
+};
+
+BENCHMARK_DEFINE_F(LargeHaystackF, bmhFindAll)(benchmark::State& st)
+{
+  utl::ThreadPool pool(static_cast<std::size_t>(st.range(0)));
+
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(
+      alg::parallel_search_all<alg::bmh_search>(pool, m_haystack, m_pattern));
+  st.SetBytesProcessed(st.iterations()
+                       * static_cast<std::int64_t>(m_haystack.size()));
+}
+
+BENCHMARK_DEFINE_F(LargeHaystackF, kmpFindAll)(benchmark::State& st)
+{
+  utl::ThreadPool pool(static_cast<std::size_t>(st.range(0)));
+
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(
+      alg::parallel_search_all<alg::kmp_search>(pool, m_haystack, m_pattern));
+  st.SetBytesProcessed(st.iterations()
+                       * static_cast<std::int64_t>(m_haystack.size()));
+}
+
+BENCHMARK_REGISTER_F(LargeHaystackF, bmhFindAll)
+  ->RangeMultiplier(2)
+  ->Range(1, 16)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(LargeHaystackF, kmpFindAll)
+  ->RangeMultiplier(2)
+  ->Range(1, 16)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
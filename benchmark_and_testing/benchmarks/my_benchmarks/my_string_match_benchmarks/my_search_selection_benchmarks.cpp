@@ -0,0 +1,177 @@
+#include <lib3611/w1d3_string_match/naive_search.h>
+#include <lib3611/w1d3_string_match/kmp_search.h>
+#include <lib3611/w1d3_string_match/bmh_search.h>
+#include <lib3611/w1d3_string_match/kr_search.h>
+#include <lib3611/w1d3_string_match/search.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <random>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+
+// Crossover sweep behind the search() engine thresholds.
+// range(0): alphabet size (4 ~ DNA, 26 ~ text), range(1): pattern length.
+// The pattern is cut from the text but ends in a symbol outside the
+// alphabet, so the whole 1 Mi element haystack is scanned. Byte text runs
+// the memchr fast paths, 32-bit text the generic loops.
+template <typename Text_T>
+struct SelectionF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~SelectionF() override {}
+
+  Text_T m_haystack;
+  Text_T m_pattern;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    std::mt19937                    rng(3611);
+    std::uniform_int_distribution<> ch_dist(0, static_cast<int>(st.range(0)) - 1);
+    m_haystack.resize(std::size_t{1} << 20);
+    for (auto& ch : m_haystack) ch = static_cast<char>('a' + ch_dist(rng));
+
+    auto const m   = static_cast<std::size_t>(st.range(1));
+    auto const mid = m_haystack.begin() + static_cast<std::ptrdiff_t>(m_haystack.size() / 2);
+    m_pattern.assign(mid, mid + static_cast<std::ptrdiff_t>(m));
+    m_pattern.back() = '#';
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_haystack.clear();
+    m_pattern.clear();
+  }
+
+  template <auto Engine_V>
+  void run(benchmark::State& st) const
+  {
+    for ([[maybe_unused]] auto const& _ : st)
+      benchmark::DoNotOptimize(Engine_V(m_haystack, m_pattern));
+    st.SetBytesProcessed(st.iterations()
+                         * static_cast<std::int64_t>(m_haystack.size()));
+  }
+};
+
+using ByteTextF = SelectionF<std::string>;
+using WideTextF = SelectionF<std::vector<std::uint32_t>>;
+
+#define DTE3611_SELECTION_SWEEP                                                \
+  ArgsProduct({{4, 26}, {2, 4, 8, 16, 32, 64, 256}})
+
+BENCHMARK_DEFINE_F(ByteTextF, naive)(benchmark::State& st)
+{
+  run<alg::naive_search>(st);
+}
+BENCHMARK_REGISTER_F(ByteTextF, naive)->DTE3611_SELECTION_SWEEP;
+
+BENCHMARK_DEFINE_F(ByteTextF, kmp)(benchmark::State& st)
+{
+  run<alg::kmp_search>(st);
+}
+BENCHMARK_REGISTER_F(ByteTextF, kmp)->DTE3611_SELECTION_SWEEP;
+
+BENCHMARK_DEFINE_F(ByteTextF, bmh)(benchmark::State& st)
+{
+  run<alg::bmh_search>(st);
+}
+BENCHMARK_REGISTER_F(ByteTextF, bmh)->DTE3611_SELECTION_SWEEP;
+
+BENCHMARK_DEFINE_F(ByteTextF, kr)(benchmark::State& st)
+{
+  run<alg::kr_search>(st);
+}
+BENCHMARK_REGISTER_F(ByteTextF, kr)->DTE3611_SELECTION_SWEEP;
+
+BENCHMARK_DEFINE_F(WideTextF, naive)(benchmark::State& st)
+{
+  run<alg::naive_search>(st);
+}
+BENCHMARK_REGISTER_F(WideTextF, naive)->DTE3611_SELECTION_SWEEP;
+
+BENCHMARK_DEFINE_F(WideTextF, kmp)(benchmark::State& st)
+{
+  run<alg::kmp_search>(st);
+}
+BENCHMARK_REGISTER_F(WideTextF, kmp)->DTE3611_SELECTION_SWEEP;
+
+BENCHMARK_DEFINE_F(WideTextF, bmh)(benchmark::State& st)
+{
+  run<alg::bmh_search>(st);
+}
+BENCHMARK_REGISTER_F(WideTextF, bmh)->DTE3611_SELECTION_SWEEP;
+
+BENCHMARK_DEFINE_F(WideTextF, kr)(benchmark::State& st)
+{
+  run<alg::kr_search>(st);
+}
+BENCHMARK_REGISTER_F(WideTextF, kr)->DTE3611_SELECTION_SWEEP;
+
+BENCHMARK_DEFINE_F(ByteTextF, search)(benchmark::State& st)
+{
+  run<alg::search>(st);
+}
+BENCHMARK_REGISTER_F(ByteTextF, search)->DTE3611_SELECTION_SWEEP;
+
+BENCHMARK_DEFINE_F(WideTextF, search)(benchmark::State& st)
+{
+  run<alg::search>(st);
+}
+BENCHMARK_REGISTER_F(WideTextF, search)->DTE3611_SELECTION_SWEEP;
+
+// Dictionary of range(1) equal-length patterns cut from the text, range(0)
+// is the alphabet size as above: Karp-Rabin set vs Aho-Corasick
+struct DictionaryF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~DictionaryF() override {}
+
+  std::string              m_haystack;
+  std::vector<std::string> m_patterns;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    std::mt19937                    rng(3611);
+    std::uniform_int_distribution<> ch_dist(0, static_cast<int>(st.range(0)) - 1);
+    m_haystack.resize(std::size_t{1} << 20);
+    for (auto& ch : m_haystack) ch = static_cast<char>('a' + ch_dist(rng));
+
+    std::uniform_int_distribution<std::size_t> pos_dist(0, m_haystack.size() - 16);
+    for (std::int64_t i = 0; i < st.range(1); ++i)
+      m_patterns.push_back(m_haystack.substr(pos_dist(rng), 16));
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_haystack.clear();
+    m_patterns.clear();
+  }
+
+  template <auto Engine_V>
+  void run(benchmark::State& st) const
+  {
+    for ([[maybe_unused]] auto const& _ : st)
+      benchmark::DoNotOptimize(Engine_V(m_haystack, m_patterns));
+    st.SetBytesProcessed(st.iterations()
+                         * static_cast<std::int64_t>(m_haystack.size()));
+  }
+};
+
+BENCHMARK_DEFINE_F(DictionaryF, krSet)(benchmark::State& st)
+{
+  run<alg::multi_search>(st);
+}
+BENCHMARK_DEFINE_F(DictionaryF, ahoCorasick)(benchmark::State& st)
+{
+  run<alg::aho_corasick_search>(st);
+}
+
+BENCHMARK_REGISTER_F(DictionaryF, krSet)->ArgsProduct({{4, 26}, {8, 256}});
+BENCHMARK_REGISTER_F(DictionaryF, ahoCorasick)->ArgsProduct({{4, 26}, {8, 256}});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,64 @@
+#include <lib3611/w1d3_string_match/two_way_search.h>
+#include <lib3611/w1d3_string_match/kmp_search.h>
+#include <lib3611/w1d3_string_match/bmh_search.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <string>
+
+namespace alg = dte3611::string_match::algorithms;
+
+// BMH worst case: haystack a^n, pattern a..aba..a -- every window
+// compares half the pattern before a one-step shift, i.e. O(nm)
+struct AdversarialF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~AdversarialF() override {}
+
+  std::string m_haystack;
+  std::string m_pattern;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    auto const m = static_cast<std::size_t>(st.range(0));
+    m_haystack.assign(std::size_t{1} << 20, 'a');
+    m_pattern.assign(m, 'a');
+    m_pattern[m / 2] = 'b';
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_haystack.clear();
+    m_pattern.clear();
+  }
+
+  template <auto Engine_V>
+  void run(benchmark::State& st) const
+  {
+    for ([[maybe_unused]] auto const& _ : st)
+      benchmark::DoNotOptimize(Engine_V(m_haystack, m_pattern));
+    st.SetBytesProcessed(st.iterations()
+                         * static_cast<std::int64_t>(m_haystack.size()));
+  }
+};
+
+BENCHMARK_DEFINE_F(AdversarialF, twoWay)(benchmark::State& st)
+{
+  run<alg::two_way_search>(st);
+}
+BENCHMARK_DEFINE_F(AdversarialF, kmp)(benchmark::State& st)
+{
+  run<alg::kmp_search>(st);
+}
+BENCHMARK_DEFINE_F(AdversarialF, bmh)(benchmark::State& st)
+{
+  run<alg::bmh_search>(st);
+}
+
+BENCHMARK_REGISTER_F(AdversarialF, twoWay)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK_REGISTER_F(AdversarialF, kmp)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK_REGISTER_F(AdversarialF, bmh)->RangeMultiplier(8)->Range(8, 512);
+
+BENCHMARK_MAIN();
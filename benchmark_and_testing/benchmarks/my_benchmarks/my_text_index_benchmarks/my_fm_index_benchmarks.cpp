@@ -0,0 +1,89 @@
+#include <lib3611/w1d3_text_index/fm_index.h>
+#include <lib3611/w1d3_text_index/suffix_array.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <random>
+#include <string>
+#include <vector>
+
+namespace txt = dte3611::text_index;
+
+// DNA-like corpus and a batch of queries sampled from it
+struct DnaCorpusF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~DnaCorpusF() override {}
+
+  std::string              m_text;
+  std::vector<std::string> m_queries;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    std::mt19937                    rng(42);
+    std::uniform_int_distribution<> base_dist(0, 3);
+
+    m_text.assign(static_cast<std::size_t>(st.range(0)), ' ');
+    for (auto& ch : m_text) ch = "ACGT"[base_dist(rng)];
+
+    std::uniform_int_distribution<std::size_t> pos_dist(0, m_text.size() - 32);
+    m_queries.clear();
+    for (int i = 0; i < 1000; ++i) m_queries.push_back(m_text.substr(pos_dist(rng), 12));
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_text.clear();
+    m_queries.clear();
+  }
+};
+
+BENCHMARK_DEFINE_F(DnaCorpusF, fmCount)(benchmark::State& st)
+{
+  txt::fm_index const index(m_text);
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto const& query : m_queries)
+      benchmark::DoNotOptimize(index.count(query));
+  st.SetItemsProcessed(st.iterations() * static_cast<std::int64_t>(m_queries.size()));
+  st.counters["bytes_per_symbol"]
+    = static_cast<double>(index.byteSize()) / static_cast<double>(m_text.size());
+}
+
+BENCHMARK_DEFINE_F(DnaCorpusF, fmLocate)(benchmark::State& st)
+{
+  txt::fm_index const index(m_text);
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto const& query : m_queries)
+      benchmark::DoNotOptimize(index.locate(query));
+  st.SetItemsProcessed(st.iterations() * static_cast<std::int64_t>(m_queries.size()));
+}
+
+BENCHMARK_DEFINE_F(DnaCorpusF, suffixArrayCount)(benchmark::State& st)
+{
+  txt::suffix_array_index const index(m_text);
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto const& query : m_queries)
+      benchmark::DoNotOptimize(index.count(query));
+  st.SetItemsProcessed(st.iterations() * static_cast<std::int64_t>(m_queries.size()));
+  st.counters["bytes_per_symbol"] = 1.0 + 4 * sizeof(std::uint32_t);
+}
+
+BENCHMARK_REGISTER_F(DnaCorpusF, fmCount)
+  ->RangeMultiplier(8)
+  ->Range(1 << 16, 1 << 22)
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(DnaCorpusF, fmLocate)
+  ->RangeMultiplier(8)
+  ->Range(1 << 16, 1 << 22)
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(DnaCorpusF, suffixArrayCount)
+  ->RangeMultiplier(8)
+  ->Range(1 << 16, 1 << 22)
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
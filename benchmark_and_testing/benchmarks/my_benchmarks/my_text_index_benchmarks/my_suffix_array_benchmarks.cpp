@@ -0,0 +1,88 @@
+#include <lib3611/w1d3_text_index/suffix_array.h>
+#include <lib3611/w1d3_string_match/compiled_pattern.h>
+
+// google benchmark
+#include <benchmark/benchmark.h>
+
+// stl
+#include <random>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+namespace txt = dte3611::text_index;
+
+// DNA-like corpus and a batch of queries sampled from it
+struct CorpusF : benchmark::Fixture {
+
+  using benchmark::Fixture::Fixture;
+  ~CorpusF() override {}
+
+  std::string              m_text;
+  std::vector<std::string> m_queries;
+
+  void SetUp(const benchmark::State& st) final
+  {
+    std::mt19937                    rng(42);
+    std::uniform_int_distribution<> base_dist(0, 3);
+
+    m_text.assign(static_cast<std::size_t>(st.range(0)), ' ');
+    for (auto& ch : m_text) ch = "ACGT"[base_dist(rng)];
+
+    std::uniform_int_distribution<std::size_t> pos_dist(0, m_text.size() - 32);
+    m_queries.clear();
+    for (int i = 0; i < 1000; ++i) m_queries.push_back(m_text.substr(pos_dist(rng), 20));
+  }
+
+  void TearDown(const benchmark::State&) final
+  {
+    m_text.clear();
+    m_queries.clear();
+  }
+};
+
+BENCHMARK_DEFINE_F(CorpusF, build)(benchmark::State& st)
+{
+  for ([[maybe_unused]] auto const& _ : st)
+    benchmark::DoNotOptimize(txt::suffix_array_index(m_text));
+  st.SetBytesProcessed(st.iterations() * static_cast<std::int64_t>(m_text.size()));
+}
+
+BENCHMARK_DEFINE_F(CorpusF, indexCount)(benchmark::State& st)
+{
+  txt::suffix_array_index const index(m_text);
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto const& query : m_queries)
+      benchmark::DoNotOptimize(index.count(query));
+  st.SetItemsProcessed(st.iterations() * static_cast<std::int64_t>(m_queries.size()));
+}
+
+BENCHMARK_DEFINE_F(CorpusF, scanFind)(benchmark::State& st)
+{
+  // Scanning baseline -- first occurrence only, still a full pass per miss
+  std::vector<decltype(alg::compile_pattern<alg::bmh_search>(m_queries.front()))>
+    compiled;
+  for (auto const& query : m_queries)
+    compiled.push_back(alg::compile_pattern<alg::bmh_search>(query));
+
+  for ([[maybe_unused]] auto const& _ : st)
+    for (auto const& query : compiled)
+      benchmark::DoNotOptimize(query.search(m_text));
+  st.SetItemsProcessed(st.iterations() * static_cast<std::int64_t>(m_queries.size()));
+}
+
+BENCHMARK_REGISTER_F(CorpusF, build)
+  ->RangeMultiplier(4)
+  ->Range(1 << 16, 1 << 24)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(CorpusF, indexCount)
+  ->RangeMultiplier(4)
+  ->Range(1 << 16, 1 << 24)
+  ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(CorpusF, scanFind)
+  ->RangeMultiplier(4)
+  ->Range(1 << 16, 1 << 20)
+  ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
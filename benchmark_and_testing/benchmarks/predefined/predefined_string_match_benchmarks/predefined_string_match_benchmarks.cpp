@@ -3,6 +3,11 @@
 
 // Day 3 string match library
 #include <lib3611/w1d3_string_match/naive_search.h>
+#include <lib3611/w1d3_string_match/kmp_search.h>
+#include <lib3611/w1d3_string_match/bmh_search.h>
+#include <lib3611/w1d3_string_match/kr_search.h>
+#include <lib3611/w1d3_string_match/two_way_search.h>
+#include <lib3611/w1d3_string_match/search.h>
 
 // google benchmark
 #include <benchmark/benchmark.h>
@@ -10,6 +15,7 @@
 // stl
 #include <memory>
 #include <algorithm>
+#include <functional>
 
 // Qualify predefined fixtures
 using namespace dte3611::predef::benchmarking::string_match::fixtures;
@@ -39,4 +45,53 @@ BENCHMARK_REGISTER_F(HelloWorldF, stlSearch);
 
 BENCHMARK_REGISTER_F(HelloWorldF, naiveSearch);
 
+
+// Corpus sweep -- std baselines, then every engine, corpus by corpus (the
+// fixtures keep one generated corpus at a time)
+namespace
+{
+  auto const stlSearch = [](auto const& text, auto const& pattern) {
+    return std::search(text.begin(), text.end(), pattern.begin(), pattern.end());
+  };
+
+  auto const stlBmhSearcher = [](auto const& text, auto const& pattern) {
+    return std::search(text.begin(), text.end(),
+                       std::boyer_moore_horspool_searcher(pattern.begin(),
+                                                          pattern.end()));
+  };
+}   // namespace
+
+using detail::corpusSweep;
+
+#define DTE3611_CORPUS_BENCHMARK(Fixture_T, Name_T, Search_V, Sweep_V)         \
+  BENCHMARK_DEFINE_F(Fixture_T, Name_T)(benchmark::State & st)                 \
+  {                                                                            \
+    run(st, Search_V);                                                         \
+  }                                                                            \
+  BENCHMARK_REGISTER_F(Fixture_T, Name_T)->Apply(Sweep_V);
+
+// Naive search and std::search are O(nm) on the adversarial corpus
+#define DTE3611_CORPUS_BENCHMARKS(Fixture_T, Quadratic_V)                      \
+  DTE3611_CORPUS_BENCHMARK(Fixture_T, stlSearch, stlSearch,                    \
+                           corpusSweep<Quadratic_V>)                           \
+  DTE3611_CORPUS_BENCHMARK(Fixture_T, stlBmhSearcher, stlBmhSearcher,          \
+                           corpusSweep<false>)                                 \
+  DTE3611_CORPUS_BENCHMARK(Fixture_T, naiveSearch, alg::naive_search,          \
+                           corpusSweep<Quadratic_V>)                           \
+  DTE3611_CORPUS_BENCHMARK(Fixture_T, kmpSearch, alg::kmp_search,              \
+                           corpusSweep<false>)                                 \
+  DTE3611_CORPUS_BENCHMARK(Fixture_T, bmhSearch, alg::bmh_search,              \
+                           corpusSweep<false>)                                 \
+  DTE3611_CORPUS_BENCHMARK(Fixture_T, krSearch, alg::kr_search,                \
+                           corpusSweep<false>)                                 \
+  DTE3611_CORPUS_BENCHMARK(Fixture_T, twoWaySearch, alg::two_way_search,       \
+                           corpusSweep<false>)                                 \
+  DTE3611_CORPUS_BENCHMARK(Fixture_T, autoSearch, alg::search,                 \
+                           corpusSweep<Quadratic_V>)
+
+DTE3611_CORPUS_BENCHMARKS(DnaCorpusF, false)
+DTE3611_CORPUS_BENCHMARKS(EnglishCorpusF, false)
+DTE3611_CORPUS_BENCHMARKS(BinaryCorpusF, false)
+DTE3611_CORPUS_BENCHMARKS(AdversarialCorpusF, true)
+
 BENCHMARK_MAIN();
@@ -8,7 +8,12 @@
 #include <vector>
 #include <random>
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <string>
+#include <string_view>
 
 namespace dte3611::predef::benchmarking::string_match::fixtures
 {
@@ -26,6 +31,179 @@ namespace dte3611::predef::benchmarking::string_match::fixtures
 
       void TearDown(const benchmark::State&) override {}
     };
+
+
+    /**
+     * Generated corpora. Every generator is seeded and prefix-stable: the
+     * text of size n is the first n bytes of any larger one, so one buffer
+     * per corpus serves the whole size sweep. The append* generators only
+     * ever append whole units -- all symbols of an RNG word, whole words --
+     * and may overshoot n; the buffer is cut when it is read, not stored.
+     */
+    enum class Corpus { dna, english, binary, adversarial };
+
+    // Sweep: text sizes 1 KiB .. 1 GiB (x32), pattern lengths 2 .. 4096
+    inline constexpr std::int64_t corpus_min_bytes        = std::int64_t{1} << 10;
+    inline constexpr std::int64_t corpus_max_bytes        = std::int64_t{1} << 30;
+    inline constexpr std::int64_t corpus_size_multiplier  = 32;
+    inline constexpr std::array<std::int64_t, 6> corpus_pattern_lengths{
+      2, 8, 64, 512, 2048, 4096};
+
+    // O(nm) engines on the adversarial corpus stop at n * m = 2^32
+    inline constexpr std::int64_t quadratic_work_budget = std::int64_t{1} << 32;
+
+    inline void appendDna(std::string& text, std::size_t n, std::mt19937_64& rng)
+    {
+      while (text.size() < n) {
+        auto bits = rng();
+        for (int i = 0; i < 32; ++i, bits >>= 2)
+          text.push_back("ACGT"[bits & 3]);
+      }
+    }
+
+    inline void appendBinary(std::string& text, std::size_t n, std::mt19937_64& rng)
+    {
+      while (text.size() < n) {
+        auto bits = rng();
+        for (int i = 0; i < 8; ++i, bits >>= 8)
+          text.push_back(static_cast<char>(bits & 0xff));
+      }
+    }
+
+    /**
+     * English-like text: words drawn from a fixed 4096-word vocabulary with
+     * Zipfian frequencies (P(rank r) ~ 1/r), letters within words weighted
+     * by English letter frequency, separated by spaces.
+     */
+    inline void appendEnglish(std::string& text, std::size_t n, std::mt19937_64& rng)
+    {
+      static auto const vocabulary = [] {
+        std::mt19937_64 vocab_rng(3611);
+        std::discrete_distribution<> letter(
+          {82, 15, 28, 43, 127, 22, 20, 61, 70, 2, 8, 40, 24,
+           67, 75, 19, 1,  60, 63, 91, 28, 10, 24, 2,  20, 1});
+        std::uniform_int_distribution<> length(1, 10);
+
+        std::vector<std::string> words(4096);
+        for (auto& word : words) {
+          word.resize(static_cast<std::size_t>(length(vocab_rng)));
+          for (auto& ch : word) ch = static_cast<char>('a' + letter(vocab_rng));
+        }
+        // Short words are the frequent ones
+        std::ranges::stable_sort(words, {}, [](auto const& w) { return w.size(); });
+        return words;
+      }();
+
+      static auto const cumulative = [] {
+        std::vector<double> cdf(vocabulary.size());
+        double              sum = 0;
+        for (std::size_t r = 0; r < cdf.size(); ++r) cdf[r] = sum += 1.0 / double(r + 1);
+        for (auto& c : cdf) c /= sum;
+        return cdf;
+      }();
+
+      std::uniform_real_distribution<> unit(0.0, 1.0);
+      while (text.size() < n) {
+        auto const rank = static_cast<std::size_t>(
+          std::ranges::upper_bound(cumulative, unit(rng)) - cumulative.begin());
+        text += vocabulary[std::min(rank, vocabulary.size() - 1)];
+        text.push_back(' ');
+      }
+    }
+
+    /**
+     * The first n bytes of a corpus. Buffers grow on demand and only the
+     * most recently used random corpus is kept, so register benchmarks
+     * corpus by corpus.
+     */
+    inline std::string_view corpusText(Corpus corpus, std::size_t n)
+    {
+      static Corpus          cached_corpus{Corpus::adversarial};
+      static std::string     text;
+      static std::mt19937_64 rng;
+
+      if (corpus == Corpus::adversarial) {
+        // a^(n-1) b -- one match, at the very end
+        static std::string adversarial;
+        adversarial.assign(n - 1, 'a');
+        adversarial.push_back('b');
+        return adversarial;
+      }
+
+      if (corpus != cached_corpus) {
+        cached_corpus = corpus;
+        text.clear();
+        text.shrink_to_fit();
+        rng.seed(3611);
+      }
+      if (text.size() < n) {
+        text.reserve(n);
+        switch (corpus) {
+          case Corpus::dna: appendDna(text, n, rng); break;
+          case Corpus::english: appendEnglish(text, n, rng); break;
+          default: appendBinary(text, n, rng); break;
+        }
+      }
+      return std::string_view{text}.substr(0, n);
+    }
+
+
+    /**
+     * range(0): text bytes, range(1): pattern length. The pattern is the
+     * tail of the text (a^(m-1) b on the adversarial corpus), so there is
+     * always a match; bytes_per_second counts the bytes up to and including
+     * the first one.
+     */
+    template <Corpus Corpus_V>
+    struct CorpusBenchmarkFixtureTemplate : benchmark::Fixture {
+
+      using benchmark::Fixture::Fixture;
+      ~CorpusBenchmarkFixtureTemplate() override {}
+
+      std::string_view m_text;
+      std::string      m_pattern;
+      std::int64_t     m_scan_bytes{0};
+
+      void SetUp(const benchmark::State& st) override
+      {
+        auto const n = static_cast<std::size_t>(st.range(0));
+        auto const m = static_cast<std::size_t>(st.range(1));
+
+        m_text = corpusText(Corpus_V, n);
+        if constexpr (Corpus_V == Corpus::adversarial) {
+          m_pattern.assign(m - 1, 'a');
+          m_pattern.push_back('b');
+        }
+        else
+          m_pattern.assign(m_text.substr(n - m));
+
+        auto const first = std::search(
+          m_text.begin(), m_text.end(),
+          std::boyer_moore_horspool_searcher(m_pattern.begin(), m_pattern.end()));
+        m_scan_bytes = (first - m_text.begin()) + static_cast<std::int64_t>(m);
+      }
+
+      void TearDown(const benchmark::State&) override { m_pattern.clear(); }
+
+      template <typename Search_T>
+      void run(benchmark::State& st, Search_T const& search) const
+      {
+        for ([[maybe_unused]] auto const& _ : st)
+          benchmark::DoNotOptimize(search(m_text, m_pattern));
+        st.SetBytesProcessed(st.iterations() * m_scan_bytes);
+      }
+    };
+
+    // Every (n, m) with m <= n, optionally bounded by the O(nm) budget
+    template <bool Quadratic_V>
+    void corpusSweep(benchmark::internal::Benchmark* b)
+    {
+      for (auto n = corpus_min_bytes; n <= corpus_max_bytes; n *= corpus_size_multiplier)
+        for (auto const m : corpus_pattern_lengths)
+          if (m <= n and (not Quadratic_V or n * m <= quadratic_work_budget))
+            b->Args({n, m});
+    }
+
   }   // namespace detail
 
   struct HelloWorldF : detail::StringMatchBenchmarkFixtureTemplate {
@@ -41,6 +219,37 @@ namespace dte3611::predef::benchmarking::string_match::fixtures
     }
   };
 
+  struct DnaCorpusF : detail::CorpusBenchmarkFixtureTemplate<detail::Corpus::dna> {
+    using Base = detail::CorpusBenchmarkFixtureTemplate<detail::Corpus::dna>;
+
+    using Base::Base;
+    ~DnaCorpusF() override {}
+  };
+
+  struct EnglishCorpusF
+    : detail::CorpusBenchmarkFixtureTemplate<detail::Corpus::english> {
+    using Base = detail::CorpusBenchmarkFixtureTemplate<detail::Corpus::english>;
+
+    using Base::Base;
+    ~EnglishCorpusF() override {}
+  };
+
+  struct BinaryCorpusF
+    : detail::CorpusBenchmarkFixtureTemplate<detail::Corpus::binary> {
+    using Base = detail::CorpusBenchmarkFixtureTemplate<detail::Corpus::binary>;
+
+    using Base::Base;
+    ~BinaryCorpusF() override {}
+  };
+
+  struct AdversarialCorpusF
+    : detail::CorpusBenchmarkFixtureTemplate<detail::Corpus::adversarial> {
+    using Base = detail::CorpusBenchmarkFixtureTemplate<detail::Corpus::adversarial>;
+
+    using Base::Base;
+    ~AdversarialCorpusF() override {}
+  };
+
 }   // namespace dte3611::predef::benchmarking::string_match::fixtures
 
 #endif   // DTE3611_PREDEF_BENCHMARKING_STRING_MATCH_FIXTURES_H
@@ -0,0 +1,116 @@
+#ifndef DTE3611_PREDEF_TESTING_RANDOM_GRAPH_FIXTURES_H
+#define DTE3611_PREDEF_TESTING_RANDOM_GRAPH_FIXTURES_H
+
+// boost
+#include <boost/graph/adjacency_list.hpp>
+
+// stl
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dte3611::predef::testing::graph::generators
+{
+
+  namespace detail
+  {
+    // Default edge bundle generator: leave the bundle default constructed
+    struct NoEdgeBundle {
+    };
+
+    template <typename Graph_T, typename EdgeBundle_T>
+    void addEdge(typename Graph_T::vertex_descriptor u,
+                 typename Graph_T::vertex_descriptor v, std::mt19937& rng,
+                 std::size_t i, EdgeBundle_T& edge_bundle, Graph_T& g)
+    {
+      if constexpr (std::is_same_v<EdgeBundle_T, NoEdgeBundle>)
+        boost::add_edge(u, v, g);
+      else
+        boost::add_edge(u, v, edge_bundle(rng, i), g);
+    }
+
+    // Vertex descriptors by index, so listS graphs work too
+    template <typename Graph_T>
+    std::vector<typename Graph_T::vertex_descriptor> vertexList(Graph_T const& g)
+    {
+      std::vector<typename Graph_T::vertex_descriptor> vertices;
+      vertices.reserve(boost::num_vertices(g));
+      for (auto v : boost::make_iterator_range(boost::vertices(g)))
+        vertices.push_back(v);
+      return vertices;
+    }
+
+    template <typename Graph_T, typename EdgeBundle_T>
+    Graph_T randomEdges(std::size_t n, std::size_t m, unsigned seed,
+                        bool self_loops, EdgeBundle_T edge_bundle)
+    {
+      std::mt19937                               rng(seed);
+      std::uniform_int_distribution<std::size_t> vertex(0, n - 1);
+
+      Graph_T    g(n);
+      auto const vertices = vertexList(g);
+      for (std::size_t i = 0; i < m; ++i) {
+        auto const u = vertex(rng), v = vertex(rng);
+        if (u != v or self_loops)
+          addEdge(vertices[u], vertices[v], rng, i, edge_bundle, g);
+      }
+      return g;
+    }
+  }   // namespace detail
+
+
+  /**
+   * n vertices and m edges with uniformly random endpoints; self-loops and
+   * parallel edges included.  The optional edge_bundle(rng, i) returns the
+   * bundle of the i-th drawn edge, using the generator's own rng so the
+   * graph is still a function of the seed alone.
+   */
+  template <typename Graph_T, typename EdgeBundle_T = detail::NoEdgeBundle>
+  Graph_T randomGraph(std::size_t n, std::size_t m, unsigned seed,
+                      EdgeBundle_T edge_bundle = {})
+  {
+    return detail::randomEdges<Graph_T>(n, m, seed, true, std::move(edge_bundle));
+  }
+
+  /**
+   * As randomGraph, but draws that land on a self-loop are dropped, so the
+   * graph has at most m edges.  Flow networks want these.
+   */
+  template <typename Graph_T, typename EdgeBundle_T = detail::NoEdgeBundle>
+  Graph_T randomLooplessGraph(std::size_t n, std::size_t m, unsigned seed,
+                              EdgeBundle_T edge_bundle = {})
+  {
+    return detail::randomEdges<Graph_T>(n, m, seed, false, std::move(edge_bundle));
+  }
+
+  /**
+   * Acyclic graph of at most m edges: the vertices get a random rank and
+   * every edge runs from the lower to the higher rank, so the vertex
+   * numbering is no topological order.  Draws of equal rank are dropped.
+   */
+  template <typename Graph_T, typename EdgeBundle_T = detail::NoEdgeBundle>
+  Graph_T randomDag(std::size_t n, std::size_t m, unsigned seed,
+                    EdgeBundle_T edge_bundle = {})
+  {
+    std::mt19937                               rng(seed);
+    std::uniform_int_distribution<std::size_t> position(0, n - 1);
+
+    Graph_T g(n);
+    auto    ranked = detail::vertexList(g);
+    std::shuffle(ranked.begin(), ranked.end(), rng);
+
+    for (std::size_t i = 0; i < m; ++i) {
+      auto a = position(rng), b = position(rng);
+      if (a == b) continue;
+      if (a > b) std::swap(a, b);
+      detail::addEdge(ranked[a], ranked[b], rng, i, edge_bundle, g);
+    }
+    return g;
+  }
+
+}   // namespace dte3611::predef::testing::graph::generators
+
+#endif   // DTE3611_PREDEF_TESTING_RANDOM_GRAPH_FIXTURES_H
@@ -0,0 +1,123 @@
+// Unit test utils
+#include <predefined_utils/testing/fixtures/graph_testing_fixtures.h>
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Day 5 graph path finding library
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/w1d5_graph_path_finding/dag_shortest_paths.h>
+#include <lib3611/w1d5_graph_path_finding/dijkstra_shortest_paths.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Qualify predefined fixtures
+using namespace dte3611::predef::testing::graph::fixtures;
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace
+{
+  template <typename Paths_T>
+  Paths_T sorted(Paths_T paths)
+  {
+    std::sort(std::begin(paths), std::end(paths));
+    return paths;
+  }
+
+  struct EdgeProperties {
+    double distance{0.};
+  };
+
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS,
+                                      boost::no_property, EdgeProperties>;
+
+  // Integral weights 1..4 for ties
+  Graph randomDag(std::size_t n, std::size_t m, unsigned seed)
+  {
+    std::uniform_int_distribution<> weight(1, 4);
+
+    return gen::randomDag<Graph>(n, m, seed, [&](std::mt19937& rng, std::size_t) {
+      return EdgeProperties{double(weight(rng))};
+    });
+  }
+}   // namespace
+
+
+TEST_F(DAGOneF, dagShortestPaths_MatchesGold)
+{
+  EXPECT_EQ(sorted(alg::dagShortestPaths(gold->graph(), gold->a(), gold->e(), distance_op)),
+            sorted(gold->shortestPathsAEGold()));
+  EXPECT_EQ(sorted(alg::dagShortestPaths(gold->graph(), gold->a(), gold->c(), distance_op)),
+            sorted(gold->shortestPathsACGold()));
+}
+
+TEST_F(DAGTwoF, dagShortestPaths_UnreachableGoalHasNoPaths)
+{
+  EXPECT_TRUE(alg::dagShortestPaths(gold->graph(), gold->a(), gold->e(), distance_op).empty());
+  EXPECT_TRUE(alg::dagShortestPaths(gold->graph(), gold->a(), gold->c(), distance_op).empty());
+}
+
+TEST_F(DAGThreeF, dagShortestPaths_CountsAllShortestPaths)
+{
+  auto const tree = alg::dagShortestPathTree(gold->graph(), gold->a(), distance_op);
+
+  EXPECT_EQ(tree.distance[gold->c()], 5.);
+  EXPECT_EQ(tree.path_count[gold->c()], gold->shortestPathsACGold().size());
+  EXPECT_EQ(tree.path_count[gold->e()], gold->shortestPathsAEGold().size());
+  EXPECT_EQ(tree.path_count[gold->a()], 1u);
+
+  EXPECT_EQ(sorted(alg::dagShortestPaths(gold->graph(), gold->a(), gold->c(), distance_op)),
+            sorted(gold->shortestPathsACGold()));
+}
+
+TEST_F(DAG_Neg_OneF, dagShortestPaths_NegativeWeights)
+{
+  EXPECT_EQ(alg::dagShortestPaths(gold->graph(), gold->s(), gold->t(), distance_op),
+            gold->shortestPathsSTGold());
+  EXPECT_EQ(alg::dagShortestPathTree(gold->graph(), gold->s(), distance_op).distance[gold->t()],
+            1.);
+}
+
+TEST_F(DAG_Neg_TwoF, dagShortestPaths_NegativeWeights)
+{
+  EXPECT_EQ(alg::dagShortestPaths(gold->graph(), gold->s(), gold->t(), distance_op),
+            gold->shortestPathsSTGold());
+}
+
+TEST(MyDagShortestPathsTest, matchesDijkstraOnRandomDags)
+{
+  auto const g     = randomDag(400, 2400, 31);
+  auto const csr   = gutl::makeCsrGraph(g);
+  auto const order = alg::topologicalSort(g);
+
+  auto const op     = [](auto const& e, auto const& graph) { return graph[e].distance; };
+  auto const tree   = alg::dagShortestPathTree(csr, 0u, op);
+
+  for (std::size_t goal = 0; goal < 400; goal += 7) {
+    auto const gold = sorted(alg::dijkstraShortestPaths(g, 0, goal, op));
+    EXPECT_EQ(sorted(alg::dagShortestPaths<Graph>(order, g, 0, goal, op)), gold) << goal;
+    EXPECT_EQ(tree.path_count[goal], gold.size()) << goal;
+    EXPECT_EQ(tree.reached(goal), not gold.empty() or goal == 0) << goal;
+  }
+}
+
+TEST(MyDagShortestPathsTest, unitWeightsByDefault)
+{
+  // Diamond 0 -> {1, 2} -> 3, plus the long way 0 -> 4 -> 5 -> 3
+  Graph g(6);
+  for (auto [u, v] : {std::pair{0, 1}, {0, 2}, {1, 3}, {2, 3}, {0, 4}, {4, 5}, {5, 3}})
+    boost::add_edge(u, v, g);
+
+  auto const tree = alg::dagShortestPathTree(g, 0);
+  EXPECT_EQ(tree.distance[3], 2.);
+  EXPECT_EQ(tree.path_count[3], 2u);
+  EXPECT_EQ(sorted(alg::dagShortestPaths(g, 0, 3)),
+            (std::vector<std::vector<std::size_t>>{{1, 3}, {2, 3}}));
+}
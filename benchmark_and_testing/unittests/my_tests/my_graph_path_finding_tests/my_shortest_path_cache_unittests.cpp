@@ -0,0 +1,163 @@
+// Unit test utils
+#include <predefined_utils/testing/fixtures/graph_testing_fixtures.h>
+
+// Day 5 graph path finding library
+#include <lib3611/w1d5_graph_path_finding/shortest_path_cache.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <vector>
+
+// Qualify predefined fixtures
+using namespace dte3611::predef::testing::graph::fixtures;
+
+namespace alg = dte3611::graph::algorithms;
+
+namespace
+{
+  using Graph = dte3611::predef::testing::graph::detail::types::BidirectionalGraph;
+  using Cache = alg::ShortestPathCache<Graph>;
+
+  auto sorted(Cache::Paths paths)
+  {
+    std::sort(std::begin(paths), std::end(paths));
+    return paths;
+  }
+
+  struct DistanceOp {
+    double operator()(Graph::edge_descriptor const& e, Graph const& g) const
+    {
+      return g[e].distance;
+    }
+  };
+
+  const auto zero_heuristic_fn
+    = []([[maybe_unused]] auto const& u, [[maybe_unused]] auto const& v,
+         [[maybe_unused]] auto const& graph) { return 0.; };
+}   // namespace
+
+
+TEST_F(DAGOneF, shortestPathCache_AnswersMatchUncachedSearch)
+{
+  Cache cache(gold->graph(), 1 << 20);
+
+  // Same paths in the same order as the uncached search, from any source
+  auto const uncached_ae
+    = alg::dijkstraShortestPaths(gold->graph(), gold->a(), gold->e(), distance_op);
+  auto const uncached_ac
+    = alg::dijkstraShortestPaths(gold->graph(), gold->a(), gold->c(), distance_op);
+  EXPECT_EQ(sorted(uncached_ae), sorted(gold->shortestPathsAEGold()));
+  EXPECT_EQ(sorted(uncached_ac), sorted(gold->shortestPathsACGold()));
+
+  for (int round = 0; round < 2; ++round) {
+    EXPECT_EQ(cache.dijkstraShortestPaths(gold->a(), gold->e(), distance_op),
+              uncached_ae);
+    EXPECT_EQ(cache.dijkstraShortestPaths(gold->a(), gold->c(), distance_op),
+              uncached_ac);
+  }
+
+  // A->E searches, A->C reads the A tree, then both are path hits
+  auto const stats = cache.statistics();
+  EXPECT_EQ(stats.misses, 1u);
+  EXPECT_EQ(stats.tree_hits, 1u);
+  EXPECT_EQ(stats.path_hits, 2u);
+}
+
+TEST_F(DAGTwoF, shortestPathCache_AStarMatchesUncachedSearch)
+{
+  Cache cache(gold->graph(), 1 << 20);
+
+  auto const astar = [&](auto const& goal) {
+    return alg::aStarSearch(gold->graph(), gold->a(), goal, zero_heuristic_fn,
+                            DistanceOp{});
+  };
+  EXPECT_EQ(sorted(astar(gold->e())), sorted(gold->shortestPathsAEGold()));
+
+  EXPECT_EQ(cache.aStarSearch(gold->a(), gold->e(), zero_heuristic_fn, DistanceOp{}),
+            astar(gold->e()));
+  EXPECT_EQ(cache.statistics().misses, 1u);
+
+  // A Dijkstra tree from A is cached now, but A* never reads it: its own
+  // settle order, not Dijkstra's, decides the path order
+  cache.dijkstraShortestPaths(gold->a(), gold->e(), DistanceOp{});
+  EXPECT_EQ(cache.aStarSearch(gold->a(), gold->c(), zero_heuristic_fn, DistanceOp{}),
+            astar(gold->c()));
+  EXPECT_EQ(cache.aStarSearch(gold->a(), gold->e(), zero_heuristic_fn, DistanceOp{}),
+            astar(gold->e()));
+
+  auto const stats = cache.statistics();
+  EXPECT_EQ(stats.misses, 3u);
+  EXPECT_EQ(stats.tree_hits, 0u);
+  EXPECT_EQ(stats.path_hits, 1u);
+}
+
+TEST(MyShortestPathCacheTest, operatorsOfDifferentTypesAreCachedApart)
+{
+  Graph      g(3);
+  auto const a = boost::vertex(0, g), b = boost::vertex(1, g), c = boost::vertex(2, g);
+  boost::add_edge(a, b, {1.}, g);
+  boost::add_edge(b, c, {1.}, g);
+  boost::add_edge(a, c, {3.}, g);
+
+  Cache cache(g, 1 << 20);
+  EXPECT_EQ(&cache.graph(), &g);
+  EXPECT_EQ(cache.dijkstraShortestPaths(a, c, DistanceOp{}),
+            (Cache::Paths{{b, c}}));
+  // Unit distances -- the direct edge wins
+  EXPECT_EQ(cache.dijkstraShortestPaths(a, c), (Cache::Paths{{c}}));
+  EXPECT_EQ(cache.statistics().misses, 2u);
+}
+
+TEST(MyShortestPathCacheTest, invalidateDropsStaleAnswers)
+{
+  Graph      g(3);
+  auto const a = boost::vertex(0, g), b = boost::vertex(1, g), c = boost::vertex(2, g);
+  boost::add_edge(a, b, {1.}, g);
+  boost::add_edge(b, c, {1.}, g);
+
+  Cache cache(g, 1 << 20);
+  EXPECT_EQ(cache.dijkstraShortestPaths(a, c, DistanceOp{}), (Cache::Paths{{b, c}}));
+
+  boost::add_edge(a, c, {1.}, g);
+  // Not watched -- still the cached answer
+  EXPECT_EQ(cache.dijkstraShortestPaths(a, c, DistanceOp{}), (Cache::Paths{{b, c}}));
+
+  cache.invalidate();
+  EXPECT_EQ(cache.version(), 1u);
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_EQ(cache.memoryUsage(), 0u);
+  EXPECT_EQ(cache.dijkstraShortestPaths(a, c, DistanceOp{}), (Cache::Paths{{c}}));
+}
+
+TEST(MyShortestPathCacheTest, evictsLeastRecentlyUsedWithinBudget)
+{
+  // A path 0 -> 1 -> ... -> 63; every start gets its own tree
+  Graph g(64);
+  for (std::size_t v = 0; v + 1 < 64; ++v)
+    boost::add_edge(boost::vertex(v, g), boost::vertex(v + 1, g), {1.}, g);
+
+  Cache       probe(g, std::size_t{1} << 30);
+  probe.dijkstraShortestPaths(0, 63, DistanceOp{});
+  auto const  one_query = probe.memoryUsage();
+
+  // Room for about three queries' tree and paths
+  Cache cache(g, 3 * one_query + one_query / 2);
+  for (std::size_t start = 0; start < 10; ++start) {
+    cache.dijkstraShortestPaths(start, 63, DistanceOp{});
+    EXPECT_LE(cache.memoryUsage(), cache.memoryBudget());
+  }
+
+  // Latest start is still there, the first one was evicted
+  cache.dijkstraShortestPaths(9, 63, DistanceOp{});
+  EXPECT_EQ(cache.statistics().path_hits, 1u);
+  cache.dijkstraShortestPaths(0, 63, DistanceOp{});
+  EXPECT_EQ(cache.statistics().misses, 11u);
+
+  // Entries larger than the whole budget are never stored
+  Cache tiny(g, 16);
+  tiny.dijkstraShortestPaths(0, 63, DistanceOp{});
+  EXPECT_EQ(tiny.size(), 0u);
+}
@@ -0,0 +1,142 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/connected_components.hpp>
+#include <boost/graph/strong_components.hpp>
+
+// Unit test utils
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Day 4 graph traversal library
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/utils/thread_pool.h>
+#include <lib3611/w1d4_graph_traversal/connected_components.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <map>
+#include <random>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace
+{
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS>;
+  using Undirected = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
+
+  // Same partition of the vertices, whatever the numbering
+  void expectSamePartition(std::vector<std::size_t> const& ids, std::vector<int> const& gold)
+  {
+    ASSERT_EQ(ids.size(), gold.size());
+    std::map<std::size_t, int> to_gold;
+    std::map<int, std::size_t> from_gold;
+    for (std::size_t v = 0; v < ids.size(); ++v) {
+      EXPECT_EQ(to_gold.try_emplace(ids[v], gold[v]).first->second, gold[v]) << v;
+      EXPECT_EQ(from_gold.try_emplace(gold[v], ids[v]).first->second, ids[v]) << v;
+    }
+  }
+
+  void expectConsistentSizes(alg::graph_components const& c)
+  {
+    std::vector<std::size_t> sizes(c.count(), 0);
+    for (auto id : c.component) {
+      ASSERT_LT(id, c.count());
+      ++sizes[id];
+    }
+    EXPECT_EQ(sizes, c.sizes);
+  }
+}   // namespace
+
+
+TEST(MyConnectedComponentsTest, strongComponentsMatchBoost)
+{
+  auto const g = gen::randomGraph<Graph>(3000, 4000, 21);
+
+  std::vector<int> gold(boost::num_vertices(g));
+  boost::strong_components(g, boost::make_iterator_property_map(
+                                gold.begin(), boost::get(boost::vertex_index, g)));
+
+  auto const scc = alg::stronglyConnectedComponents(g);
+  expectSamePartition(scc.component, gold);
+  expectConsistentSizes(scc);
+
+  // Sinks of the condensation close first
+  for (auto e : boost::make_iterator_range(boost::edges(g)))
+    EXPECT_GE(scc.component[boost::source(e, g)], scc.component[boost::target(e, g)]);
+}
+
+TEST(MyConnectedComponentsTest, strongComponentsOfSmallDigraph)
+{
+  // {0,1,2} cycle -> {3,4} cycle -> 5, and an isolated 6
+  Graph g(7);
+  for (auto [u, v] : {std::pair{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 3}, {4, 5}})
+    boost::add_edge(u, v, g);
+
+  auto const scc = alg::stronglyConnectedComponents(gutl::makeCsrGraph(g));
+  ASSERT_EQ(scc.count(), 4u);
+  EXPECT_EQ(scc.component[5], 0u);
+  EXPECT_EQ(scc.component[3], 1u);
+  EXPECT_EQ(scc.component[4], 1u);
+  EXPECT_EQ(scc.component[0], 2u);
+  EXPECT_EQ(scc.component[1], 2u);
+  EXPECT_EQ(scc.component[2], 2u);
+  EXPECT_EQ(scc.component[6], 3u);
+  EXPECT_EQ(scc.sizes, (std::vector<std::size_t>{1, 2, 3, 1}));
+}
+
+TEST(MyConnectedComponentsTest, deepCycleNeedsNoRecursion)
+{
+  // A million-vertex ring: one component, DFS depth of a million
+  constexpr std::size_t n = 1'000'000;
+
+  std::vector<gutl::CsrGraph<>::edge_entry> edges;
+  edges.reserve(n);
+  for (std::uint32_t v = 0; v < n; ++v) edges.emplace_back(v, static_cast<std::uint32_t>((v + 1) % n));
+  gutl::CsrGraph<> const ring(n, edges);
+
+  auto const scc = alg::stronglyConnectedComponents(ring);
+  EXPECT_EQ(scc.sizes, std::vector<std::size_t>{n});
+
+  auto const wcc = alg::weaklyConnectedComponents(ring);
+  EXPECT_EQ(wcc.sizes, std::vector<std::size_t>{n});
+}
+
+TEST(MyConnectedComponentsTest, weakComponentsMatchBoost)
+{
+  auto const g = gen::randomGraph<Graph>(5000, 3000, 22);
+
+  Undirected u(boost::num_vertices(g));
+  for (auto e : boost::make_iterator_range(boost::edges(g)))
+    boost::add_edge(boost::source(e, g), boost::target(e, g), u);
+  std::vector<int> gold(boost::num_vertices(u));
+  boost::connected_components(u, gold.data());
+
+  auto const wcc = alg::weaklyConnectedComponents(g);
+  expectSamePartition(wcc.component, gold);
+  expectConsistentSizes(wcc);
+
+  // Numbered by smallest vertex
+  std::vector<std::size_t> first(wcc.count(), wcc.component.size());
+  for (std::size_t v = wcc.component.size(); v-- > 0;) first[wcc.component[v]] = v;
+  EXPECT_TRUE(std::ranges::is_sorted(first));
+}
+
+TEST(MyConnectedComponentsTest, parallelWeakComponentsMatchSerial)
+{
+  dte3611::utils::ThreadPool pool(4);
+
+  auto const g   = gen::randomGraph<Graph>(40'000, 30'000, 23);
+  auto const csr = gutl::makeCsrGraph(g);
+
+  auto const serial = alg::weaklyConnectedComponents(g);
+  for (int run = 0; run < 3; ++run) {
+    auto const parallel = alg::weaklyConnectedComponents(pool, csr);
+    EXPECT_EQ(parallel.component, serial.component);
+    EXPECT_EQ(parallel.sizes, serial.sizes);
+  }
+  EXPECT_EQ(alg::weaklyConnectedComponents(pool, g).component, serial.component);
+}
@@ -0,0 +1,277 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Unit test utils
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Day 4 graph traversal library
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/utils/csr_graph_file.h>
+#include <lib3611/utils/thread_pool.h>
+#include <lib3611/w1d4_graph_traversal/breadth_first_search.h>
+#include <lib3611/w1d5_graph_path_finding/dijkstra_shortest_paths.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// posix
+#include <unistd.h>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace
+{
+  struct EdgeProperties {
+    double distance{0.};
+    int    capacity{0};
+
+    bool operator==(EdgeProperties const&) const = default;
+  };
+
+  struct GraphProperties {
+    int revision{0};
+  };
+
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS,
+                                      boost::no_property, EdgeProperties, GraphProperties>;
+
+  Graph randomGraph(std::size_t n, std::size_t m, unsigned seed)
+  {
+    std::uniform_int_distribution<> weight(1, 9);
+
+    auto g = gen::randomGraph<Graph>(n, m, seed, [&](std::mt19937& rng, std::size_t) {
+      return EdgeProperties{double(weight(rng)), weight(rng)};
+    });
+    g[boost::graph_bundle].revision = 7;
+    return g;
+  }
+
+  std::filesystem::path tempPath(std::string const& name)
+  {
+    return std::filesystem::temp_directory_path()
+           / ("dte3611_" + name + "_" + std::to_string(::getpid()));
+  }
+
+  template <typename A_T, typename B_T>
+  bool sameElements(A_T const& a, B_T const& b)
+  {
+    return std::ranges::equal(a, b);
+  }
+
+  auto const distance_op = [](auto const& e, auto const& g) { return g[e].distance; };
+}   // namespace
+
+
+TEST(MyCsrGraphFileTest, roundTripKeepsStructureAndBundles)
+{
+  auto const csr  = gutl::makeCsrGraph(randomGraph(3000, 20000, 61));
+  auto const path = tempPath("roundtrip.csr");
+  gutl::writeCsrGraph(path, csr);
+
+  {
+    auto const mapped
+      = gutl::loadCsrGraph<boost::no_property, EdgeProperties, GraphProperties>(path);
+
+    ASSERT_EQ(boost::num_vertices(mapped), boost::num_vertices(csr));
+    ASSERT_EQ(boost::num_edges(mapped), boost::num_edges(csr));
+    EXPECT_TRUE(sameElements(mapped.outOffsets(), csr.outOffsets()));
+    EXPECT_TRUE(sameElements(mapped.targets(), csr.targets()));
+    EXPECT_TRUE(sameElements(mapped.inOffsets(), csr.inOffsets()));
+    EXPECT_TRUE(sameElements(mapped.inSources(), csr.inSources()));
+    EXPECT_TRUE(sameElements(mapped.inEdges(), csr.inEdges()));
+    EXPECT_EQ(mapped[boost::graph_bundle].revision, 7);
+
+    for (auto e : boost::make_iterator_range(boost::edges(csr)))
+      EXPECT_EQ(mapped[e], csr[e]);
+
+    // Copies share the mapping
+    auto const copy = mapped;
+    EXPECT_EQ(alg::breadthFirstSearch(copy, 0u), alg::breadthFirstSearch(csr, 0u));
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(MyCsrGraphFileTest, mappedGraphRunsLibraryAlgorithms)
+{
+  auto const g    = randomGraph(500, 2000, 62);
+  auto const path = tempPath("algorithms.csr");
+  gutl::writeCsrGraph(path, gutl::makeCsrGraph(g));
+
+  {
+    auto const mapped
+      = gutl::loadCsrGraph<boost::no_property, EdgeProperties, GraphProperties>(path);
+
+    for (std::uint32_t goal = 1; goal < 500; goal += 37) {
+      auto gold  = alg::dijkstraShortestPaths(g, 0, goal, distance_op);
+      auto paths = alg::dijkstraShortestPaths(mapped, 0u, goal, distance_op);
+      std::ranges::sort(gold);
+      std::ranges::sort(paths);
+      ASSERT_EQ(paths.size(), gold.size()) << goal;
+      for (std::size_t i = 0; i < gold.size(); ++i)
+        EXPECT_TRUE(sameElements(paths[i], gold[i])) << goal;
+    }
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(MyCsrGraphFileTest, emptyGraphRoundTrips)
+{
+  auto const path = tempPath("empty.csr");
+  gutl::writeCsrGraph(path, gutl::CsrGraph<>{});
+
+  auto const mapped = gutl::loadCsrGraph(path);
+  EXPECT_EQ(boost::num_vertices(mapped), 0u);
+  EXPECT_EQ(boost::num_edges(mapped), 0u);
+  std::filesystem::remove(path);
+}
+
+TEST(MyCsrGraphFileTest, incompatibleFilesAreRejected)
+{
+  auto const path = tempPath("reject.csr");
+  gutl::writeCsrGraph(path, gutl::makeCsrGraph(randomGraph(50, 200, 63)));
+
+  // Other bundle types
+  EXPECT_THROW(gutl::loadCsrGraph(path), std::runtime_error);
+
+  // Truncated
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 64);
+  EXPECT_THROW((gutl::loadCsrGraph<boost::no_property, EdgeProperties, GraphProperties>(path)),
+               std::runtime_error);
+
+  // Not a graph file at all
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << std::string(256, 'x');
+  EXPECT_THROW(gutl::loadCsrGraph(path), std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST(MyCsrGraphFileTest, otherByteOrderIsReportedAsSuch)
+{
+  auto const path = tempPath("swapped.csr");
+  gutl::writeCsrGraph(path, gutl::makeCsrGraph(randomGraph(50, 200, 64)));
+
+  // Swap the magic and the byte order mark, as the other byte order writes them
+  {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    char         header[16];
+    file.read(header, sizeof(header));
+    std::reverse(header, header + 8);
+    std::reverse(header + 12, header + 16);
+    file.seekp(0);
+    file.write(header, sizeof(header));
+  }
+
+  try {
+    gutl::loadCsrGraph<boost::no_property, EdgeProperties, GraphProperties>(path);
+    ADD_FAILURE() << "a byte-swapped file was accepted";
+  }
+  catch (std::runtime_error const& e) {
+    EXPECT_NE(std::string(e.what()).find("byte order"), std::string::npos) << e.what();
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(MyCsrGraphFileTest, validationCatchesOutOfRangeIndices)
+{
+  auto const csr  = gutl::makeCsrGraph(randomGraph(100, 400, 65));
+  auto const path = tempPath("corrupt.csr");
+  gutl::writeCsrGraph(path, csr);
+
+  auto load = [&path] {
+    return gutl::loadCsrGraph<boost::no_property, EdgeProperties, GraphProperties>(path);
+  };
+  EXPECT_NO_THROW(gutl::validateCsrGraph(csr));
+  EXPECT_NO_THROW(gutl::validateCsrGraph(load()));
+
+  // Out-offsets start at byte 64, the targets follow at their own offset
+  std::size_t target_at = 0;
+  {
+    auto const mapped = load();
+    target_at         = 64 + static_cast<std::size_t>(
+                         reinterpret_cast<char const*>(mapped.targets().data())
+                         - reinterpret_cast<char const*>(mapped.outOffsets().data()));
+  }
+  {
+    std::uint32_t const past_end = 1'000'000;
+    std::fstream        file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(target_at));
+    file.write(reinterpret_cast<char const*>(&past_end), sizeof(past_end));
+  }
+
+  // The header checks still pass; only validation sees the bad target
+  auto const corrupt = load();
+  EXPECT_THROW(gutl::validateCsrGraph(corrupt), std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST(MyCsrGraphFileTest, importEdgeListParsesLinesAndBundles)
+{
+  auto const path = tempPath("edges.txt");
+  std::ofstream(path) << "# source target distance\n"
+                         "0 1 2.5\n"
+                         "\n"
+                         "  2\t0 1\r\n"
+                         "% another comment\n"
+                         "1 4 7";
+
+  auto const g = gutl::importEdgeList(path, [](std::string_view rest) {
+    double d = 0.;
+    auto const first = rest.find_first_not_of(" \t");
+    if (first != std::string_view::npos)
+      std::from_chars(rest.data() + first, rest.data() + rest.size(), d);
+    return d;
+  });
+
+  ASSERT_EQ(boost::num_vertices(g), 5u);
+  ASSERT_EQ(boost::num_edges(g), 3u);
+
+  std::vector<std::tuple<std::uint32_t, std::uint32_t, double>> edges;
+  for (auto e : boost::make_iterator_range(boost::edges(g)))
+    edges.emplace_back(boost::source(e, g), boost::target(e, g), g[e]);
+  EXPECT_EQ(edges, (std::vector<std::tuple<std::uint32_t, std::uint32_t, double>>{
+                     {0, 1, 2.5}, {1, 4, 7.}, {2, 0, 1.}}));
+
+  std::ofstream(path) << "0 1\n1 x\n";
+  EXPECT_THROW(gutl::importEdgeList(path), std::invalid_argument);
+  std::filesystem::remove(path);
+}
+
+TEST(MyCsrGraphFileTest, parallelImportKeepsFileOrder)
+{
+  // ~3 MiB, so the file spans several chunks
+  std::mt19937                            rng(64);
+  std::uniform_int_distribution<unsigned> vertex(0, 99'999);
+
+  std::vector<gutl::CsrGraph<>::edge_entry> gold;
+  auto const path = tempPath("large_edges.txt");
+  {
+    std::ofstream out(path);
+    for (int i = 0; i < 250'000; ++i) {
+      gold.emplace_back(vertex(rng), vertex(rng));
+      out << gold.back().first << ' ' << gold.back().second << '\n';
+    }
+  }
+  auto const n = 1 + std::max(std::ranges::max(gold, {}, &gutl::CsrGraph<>::edge_entry::first).first,
+                              std::ranges::max(gold, {}, &gutl::CsrGraph<>::edge_entry::second).second);
+  gutl::CsrGraph<> const expected(n, gold);
+
+  dte3611::utils::ThreadPool pool(4);
+  auto const                 imported = gutl::importEdgeList(pool, path);
+
+  ASSERT_EQ(boost::num_vertices(imported), boost::num_vertices(expected));
+  EXPECT_TRUE(sameElements(imported.outOffsets(), expected.outOffsets()));
+  EXPECT_TRUE(sameElements(imported.targets(), expected.targets()));
+  EXPECT_TRUE(sameElements(imported.inSources(), expected.inSources()));
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,201 @@
+// Unit test utils -- ahead of the library headers, which expect the full adjacency_list
+#include <predefined_utils/testing/fixtures/flow_testing_fixtures.h>
+#include <predefined_utils/testing/fixtures/graph_testing_fixtures.h>
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Graph libraries
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/w1d4_graph_traversal/breadth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/depth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/direction_optimizing_bfs.h>
+#include <lib3611/w1d4_graph_traversal/parallel_bfs.h>
+#include <lib3611/w1d5_graph_path_finding/astar_search.h>
+#include <lib3611/w1d5_graph_path_finding/dijkstra_shortest_paths.h>
+#include <lib3611/w3_network_flow/network_flow.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+using DAGOneF               = dte3611::predef::testing::graph::fixtures::DAGOneF;
+using DAGThreeF               = dte3611::predef::testing::graph::fixtures::DAGThreeF;
+using FordFulkersonDemoDAGF = dte3611::predef::testing::flow::fixtures::FordFulkersonDemoDAGF;
+
+namespace
+{
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS,
+                                      boost::no_property, int>;
+
+  // Edge bundles number the edges in insertion order
+  Graph randomGraph(std::size_t n, std::size_t m, unsigned seed)
+  {
+    return gen::randomGraph<Graph>(
+      n, m, seed, [](std::mt19937&, std::size_t i) { return static_cast<int>(i); });
+  }
+
+  // (neighbour, bundle) of every out- or in-edge of v
+  template <typename Graph_T>
+  std::vector<std::pair<std::size_t, int>> outEdges(Graph_T const& g, std::size_t v)
+  {
+    std::vector<std::pair<std::size_t, int>> out;
+    for (auto e : boost::make_iterator_range(boost::out_edges(v, g)))
+      out.emplace_back(boost::target(e, g), g[e]);
+    return out;
+  }
+
+  template <typename Graph_T>
+  std::vector<std::pair<std::size_t, int>> inEdges(Graph_T const& g, std::size_t v)
+  {
+    std::vector<std::pair<std::size_t, int>> in;
+    for (auto e : boost::make_iterator_range(boost::in_edges(v, g)))
+      in.emplace_back(boost::source(e, g), g[e]);
+    return in;
+  }
+
+  template <typename VertexDescriptor_T>
+  std::vector<std::vector<std::size_t>>
+  sortedPaths(std::vector<std::vector<VertexDescriptor_T>> const& paths)
+  {
+    std::vector<std::vector<std::size_t>> wide;
+    for (auto const& path : paths) wide.emplace_back(path.begin(), path.end());
+    std::sort(wide.begin(), wide.end());
+    return wide;
+  }
+
+  template <typename VertexDescriptor_T>
+  std::vector<std::size_t> widen(std::vector<VertexDescriptor_T> const& vertices)
+  {
+    return {vertices.begin(), vertices.end()};
+  }
+}   // namespace
+
+
+TEST(MyCsrGraphTest, mirrorsTheAdjacencyList)
+{
+  auto const g   = randomGraph(500, 3000, 1);
+  auto const csr = gutl::makeCsrGraph(g);
+
+  static_assert(dte3611::predef::concepts::graph::BidirectionalGraph<decltype(csr)>);
+
+  ASSERT_EQ(boost::num_vertices(csr), boost::num_vertices(g));
+  ASSERT_EQ(boost::num_edges(csr), boost::num_edges(g));
+
+  // Same edges, bundles and per-vertex order in both directions
+  for (std::size_t v = 0; v < boost::num_vertices(g); ++v) {
+    EXPECT_EQ(outEdges(csr, v), outEdges(g, v)) << v;
+    EXPECT_EQ(inEdges(csr, v), inEdges(g, v)) << v;
+    EXPECT_EQ(boost::out_degree(v, csr), boost::out_degree(v, g));
+    EXPECT_EQ(boost::in_degree(v, csr), boost::in_degree(v, g));
+  }
+
+  // boost::edges lists every edge once, source-major
+  std::vector<int> bundles;
+  std::size_t      last_source = 0;
+  for (auto e : boost::make_iterator_range(boost::edges(csr))) {
+    EXPECT_LE(last_source, boost::source(e, csr));
+    last_source = boost::source(e, csr);
+    bundles.push_back(csr[e]);
+  }
+  std::sort(bundles.begin(), bundles.end());
+  for (std::size_t i = 0; i < bundles.size(); ++i) EXPECT_EQ(bundles[i], int(i));
+
+  for (auto e : boost::make_iterator_range(boost::edges(g))) {
+    auto const [found, exists] = boost::edge(std::uint32_t(boost::source(e, g)),
+                                             std::uint32_t(boost::target(e, g)), csr);
+    EXPECT_TRUE(exists);
+    EXPECT_EQ(boost::target(found, csr), boost::target(e, g));
+  }
+}
+
+TEST(MyCsrGraphTest, edgeListBuilder)
+{
+  using Csr = gutl::CsrGraph<boost::no_property, double>;
+
+  std::vector<Csr::edge_entry> const edges{{2, 0}, {0, 1}, {2, 1}, {0, 2}};
+  Csr const csr(4, edges, {1., 2., 3., 4.});
+
+  EXPECT_EQ(boost::num_vertices(csr), 4u);
+  EXPECT_EQ(boost::out_degree(3, csr), 0u);
+  EXPECT_EQ(boost::in_degree(1, csr), 2u);
+
+  auto const [e, exists] = boost::edge(2, 1, csr);
+  ASSERT_TRUE(exists);
+  EXPECT_EQ(csr[e], 3.);
+  EXPECT_FALSE(boost::edge(1, 2, csr).second);
+
+  // 0's out-edges in list order, 1's in-edges likewise
+  auto const [ai, aend] = boost::adjacent_vertices(0, csr);
+  EXPECT_EQ((std::vector<std::uint32_t>(ai, aend)), (std::vector<std::uint32_t>{1, 2}));
+  auto const [ii, iend] = boost::inv_adjacent_vertices(1, csr);
+  EXPECT_EQ((std::vector<std::uint32_t>(ii, iend)), (std::vector<std::uint32_t>{0, 2}));
+
+  EXPECT_THROW(Csr(2, edges), std::invalid_argument);
+  EXPECT_THROW(Csr(4, edges, {1.}), std::invalid_argument);
+
+  Csr const empty;
+  EXPECT_EQ(boost::num_vertices(empty), 0u);
+  EXPECT_EQ(boost::num_edges(empty), 0u);
+}
+
+TEST(MyCsrGraphTest, traversalsMatchTheAdjacencyList)
+{
+  auto const g   = randomGraph(3000, 9000, 2);
+  using Csr = gutl::CsrGraph<boost::no_property, int>;
+  Csr const csr = gutl::makeCsrGraph(g);
+
+  for (std::size_t start : {0u, 1777u}) {
+    EXPECT_EQ(widen(alg::breadthFirstSearch(csr, start)), alg::breadthFirstSearch(g, start));
+    EXPECT_EQ(widen(alg::depthFirstSearch(csr, start)), alg::depthFirstSearch(g, start));
+
+    gutl::TraversalWorkspace<Csr> workspace;
+    EXPECT_EQ(widen(alg::breadthFirstSearch(workspace, csr, start)),
+              alg::breadthFirstSearch(g, start));
+
+    auto const levels = alg::directionOptimizingBfs(g, start).level;
+    EXPECT_EQ(alg::directionOptimizingBfs(csr, start).level, levels);
+    EXPECT_EQ(alg::parallelBfs(csr, start).level, levels);
+  }
+}
+
+TEST_F(DAGOneF, csrGraph_ShortestPaths)
+{
+  auto const csr = gutl::makeCsrGraph(gold->graph());
+  auto const zero_heuristic = [](auto const&, auto const&, auto const&) { return 0.; };
+
+  EXPECT_EQ(sortedPaths(alg::dijkstraShortestPaths(csr, gold->a(), gold->e(),
+                                                   dte3611::predef::testing::graph::fixtures::distance_op)),
+            sortedPaths(gold->shortestPathsAEGold()));
+  EXPECT_EQ(sortedPaths(alg::aStarSearch(csr, gold->a(), gold->e(), zero_heuristic,
+                                         dte3611::predef::testing::graph::fixtures::distance_op)),
+            sortedPaths(gold->shortestPathsAEGold()));
+}
+
+TEST_F(DAGThreeF, csrGraph_ShortestPaths)
+{
+  auto const csr = gutl::makeCsrGraph(gold->graph());
+
+  EXPECT_EQ(sortedPaths(alg::dijkstraShortestPaths(csr, gold->a(), gold->e(),
+                                                   dte3611::predef::testing::graph::fixtures::distance_op)),
+            sortedPaths(gold->shortestPathsAEGold()));
+}
+
+TEST_F(FordFulkersonDemoDAGF, csrGraph_MaxFlow)
+{
+  auto csr = gutl::makeCsrGraph(gold->graph());
+  EXPECT_EQ(dte3611::np::algorithms::maxFlow(csr, gold->s(), gold->t()), gold->maxFlowSTGold());
+
+  // The flow lands in the CSR graph's own edge bundles
+  int out_of_source = 0;
+  for (auto e : boost::make_iterator_range(boost::out_edges(gold->s(), csr)))
+    out_of_source += csr[e].flow;
+  EXPECT_EQ(out_of_source, gold->maxFlowSTGold());
+}
@@ -0,0 +1,96 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Unit test utils
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Day 4 graph traversal library
+#include <lib3611/w1d4_graph_traversal/breadth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/direction_optimizing_bfs.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace
+{
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS>;
+  using Tree  = alg::bfs_tree<std::size_t>;
+
+  std::vector<std::size_t> goldLevels(Graph const& g, std::size_t start)
+  {
+    std::vector<std::size_t> level(boost::num_vertices(g), Tree::unreached);
+    std::queue<std::size_t>  q;
+    level[start] = 0;
+    for (q.push(start); !q.empty(); q.pop())
+      for (auto v : boost::make_iterator_range(boost::adjacent_vertices(q.front(), g)))
+        if (level[v] == Tree::unreached) level[v] = level[q.front()] + 1, q.push(v);
+    return level;
+  }
+
+  // Every reached vertex but the start hangs off an edge from the level above
+  void expectValidParents(Graph const& g, std::size_t start, Tree const& tree)
+  {
+    for (std::size_t v = 0; v < boost::num_vertices(g); ++v) {
+      if (v == start or tree.level[v] == Tree::unreached) {
+        EXPECT_EQ(tree.parent[v], v);
+        continue;
+      }
+      auto const p = tree.parent[v];
+      EXPECT_EQ(tree.level[p] + 1, tree.level[v]) << v;
+      EXPECT_TRUE(boost::edge(p, v, g).second) << p << " -> " << v;
+    }
+  }
+}   // namespace
+
+
+TEST(MyDirectionOptimizingBfsTest, levelsAndParentsInEveryDirection)
+{
+  // Sparse (long tail of small frontiers) and dense (bottom-up middle)
+  for (auto const& [n, m] : {std::pair{2000u, 2500u}, std::pair{2000u, 32000u}}) {
+    auto const g = gen::randomGraph<Graph>(n, m, n + m);
+    for (std::size_t start : {0u, 999u}) {
+      auto const gold = goldLevels(g, start);
+      for (auto direction : {alg::bfs_direction::automatic, alg::bfs_direction::top_down,
+                             alg::bfs_direction::bottom_up}) {
+        auto const tree = alg::directionOptimizingBfs(g, start, {.direction = direction});
+        EXPECT_EQ(tree.level, gold);
+        expectValidParents(g, start, tree);
+      }
+    }
+  }
+}
+
+TEST(MyDirectionOptimizingBfsTest, automaticSwitchesOnDenseGraphs)
+{
+  auto const g    = gen::randomGraph<Graph>(4000, 64000, 7);
+  auto const tree = alg::directionOptimizingBfs(g, 0);
+
+  EXPECT_GT(tree.bottom_up_steps, 0u);
+  EXPECT_GT(tree.top_down_steps, 0u);
+}
+
+TEST(MyDirectionOptimizingBfsTest, topDownOrderMatchesBreadthFirstSearch)
+{
+  auto const g = gen::randomGraph<Graph>(1500, 6000, 11);
+
+  for (std::size_t start : {0u, 42u, 1499u}) {
+    auto const tree = alg::directionOptimizingBfs(
+      g, start, {.direction = alg::bfs_direction::top_down, .record_order = true});
+    EXPECT_EQ(tree.order, alg::breadthFirstSearch(g, start));
+    EXPECT_EQ(tree.bottom_up_steps, 0u);
+  }
+
+  // Any direction lists the reached vertices by nondecreasing level
+  auto const tree = alg::directionOptimizingBfs(g, 0, {.record_order = true});
+  EXPECT_EQ(tree.order.size(), alg::breadthFirstSearch(g, 0).size());
+  for (std::size_t i = 1; i < tree.order.size(); ++i)
+    EXPECT_LE(tree.level[tree.order[i - 1]], tree.level[tree.order[i]]);
+}
@@ -0,0 +1,142 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Day 4 graph traversal library
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/utils/graph_reordering.h>
+#include <lib3611/w1d4_graph_traversal/direction_optimizing_bfs.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+
+namespace
+{
+  struct EdgeProperties {
+    int id{0};
+  };
+
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS,
+                                      boost::no_property, EdgeProperties>;
+
+  constexpr gutl::vertex_order all_orders[] = {gutl::vertex_order::reverse_cuthill_mckee,
+                                               gutl::vertex_order::breadth_first,
+                                               gutl::vertex_order::degree};
+
+  // side x side grid, right and down edges, vertex ids shuffled
+  Graph shuffledGrid(std::size_t side, unsigned seed)
+  {
+    std::vector<std::size_t> id(side * side);
+    std::iota(id.begin(), id.end(), std::size_t{0});
+    std::shuffle(id.begin(), id.end(), std::mt19937(seed));
+
+    Graph g(side * side);
+    int   edge = 0;
+    for (std::size_t r = 0; r < side; ++r)
+      for (std::size_t c = 0; c < side; ++c) {
+        if (c + 1 < side) boost::add_edge(id[r * side + c], id[r * side + c + 1], {edge++}, g);
+        if (r + 1 < side) boost::add_edge(id[r * side + c], id[(r + 1) * side + c], {edge++}, g);
+      }
+    return g;
+  }
+
+  template <typename Graph_T>
+  std::size_t bandwidth(Graph_T const& g)
+  {
+    std::size_t widest = 0;
+    for (auto e : boost::make_iterator_range(boost::edges(g))) {
+      auto const u = std::size_t(boost::source(e, g)), v = std::size_t(boost::target(e, g));
+      widest = std::max(widest, u > v ? u - v : v - u);
+    }
+    return widest;
+  }
+}   // namespace
+
+
+TEST(MyGraphReorderingTest, everyOrderIsAPermutation)
+{
+  auto const g = shuffledGrid(30, 51);
+
+  for (auto kind : all_orders) {
+    auto const r = gutl::computeVertexOrder(g, kind);
+    ASSERT_EQ(r.size(), 900u);
+    for (std::uint32_t v = 0; v < 900; ++v) EXPECT_EQ(r.old_id[r.new_id[v]], v);
+  }
+}
+
+TEST(MyGraphReorderingTest, relabeledGraphKeepsEdgesAndBundles)
+{
+  auto const g = shuffledGrid(20, 52);
+
+  for (auto kind : all_orders) {
+    auto const r   = gutl::computeVertexOrder(g, kind);
+    auto const csr = gutl::relabelGraph(g, r);
+    ASSERT_EQ(boost::num_edges(csr), boost::num_edges(g));
+
+    for (auto e : boost::make_iterator_range(boost::edges(g))) {
+      auto const [f, found] = boost::edge(r.new_id[boost::source(e, g)],
+                                          r.new_id[boost::target(e, g)], csr);
+      ASSERT_TRUE(found);
+      EXPECT_EQ(csr[f].id, g[e].id);
+    }
+  }
+}
+
+TEST(MyGraphReorderingTest, cuthillMcKeeNarrowsBandwidth)
+{
+  auto const g = shuffledGrid(40, 53);
+
+  auto const rcm = gutl::relabelGraph(
+    g, gutl::computeVertexOrder(g, gutl::vertex_order::reverse_cuthill_mckee));
+  auto const bfs
+    = gutl::relabelGraph(g, gutl::computeVertexOrder(g, gutl::vertex_order::breadth_first));
+
+  // A 40 x 40 grid has bandwidth 40 at best, ~1600 shuffled
+  EXPECT_LE(bandwidth(rcm), 80u);
+  EXPECT_LE(bandwidth(bfs), 80u);
+  EXPECT_GT(bandwidth(g), 1000u);
+}
+
+TEST(MyGraphReorderingTest, degreeOrderPutsHubsFirst)
+{
+  Graph g(6);
+  for (auto [u, v] : {std::pair{0, 1}, {5, 1}, {5, 2}, {5, 3}, {5, 4}, {3, 1}})
+    boost::add_edge(u, v, g);
+
+  auto const r = gutl::computeVertexOrder(g, gutl::vertex_order::degree);
+  EXPECT_EQ(r.old_id, (std::vector<std::uint32_t>{5, 1, 3, 0, 2, 4}));
+}
+
+TEST(MyGraphReorderingTest, resultsTranslateBackToOriginalIds)
+{
+  auto const g = shuffledGrid(25, 54);
+  auto const r = gutl::computeVertexOrder(g, gutl::vertex_order::reverse_cuthill_mckee);
+  auto const relabeled = gutl::relabelGraph(g, r);
+
+  auto const gold = alg::directionOptimizingBfs(g, 7);
+  auto const tree = alg::directionOptimizingBfs(relabeled, r.new_id[7]);
+
+  EXPECT_EQ(r.toOriginal(tree.level), gold.level);
+
+  // Parents: reindex, then map the ids themselves
+  auto const parents = r.verticesToOriginal(r.toOriginal(tree.parent));
+  for (std::size_t v = 0; v < parents.size(); ++v) {
+    if (parents[v] == v) continue;   // start, or not reached
+    EXPECT_EQ(gold.level[parents[v]] + 1, gold.level[v]) << v;
+  }
+}
+
+TEST(MyGraphReorderingTest, mismatchedRelabelingThrows)
+{
+  auto const r = gutl::computeVertexOrder(shuffledGrid(5, 55), gutl::vertex_order::degree);
+  EXPECT_THROW(gutl::relabelGraph(shuffledGrid(6, 55), r), std::invalid_argument);
+}
@@ -0,0 +1,149 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Day 4 graph traversal library
+#include <lib3611/w1d4_graph_traversal/breadth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/depth_first_search.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <queue>
+#include <random>
+#include <set>
+#include <stack>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+
+namespace
+{
+  struct NodeProperties {
+    std::size_t index{0};
+  };
+
+  // Index descriptors -- dense containers
+  using VecGraph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS,
+                                         NodeProperties>;
+  // Pointer descriptors -- hashed fallback
+  using ListGraph = boost::adjacency_list<boost::vecS, boost::listS, boost::bidirectionalS,
+                                          NodeProperties>;
+
+  static_assert(gutl::detail::IndexedVertices<VecGraph>);
+  static_assert(not gutl::detail::IndexedVertices<ListGraph>);
+
+  // Random multigraph with self loops, as an index edge list
+  std::vector<std::pair<std::size_t, std::size_t>> randomEdges(std::size_t n,
+                                                               std::size_t m)
+  {
+    std::mt19937                               rng(3611);
+    std::uniform_int_distribution<std::size_t> vertex(0, n - 1);
+
+    std::vector<std::pair<std::size_t, std::size_t>> edges(m);
+    for (auto& [u, v] : edges) u = vertex(rng), v = vertex(rng);
+    return edges;
+  }
+
+  template <typename Graph_T>
+  std::vector<typename Graph_T::vertex_descriptor>
+  build(Graph_T& g, std::size_t n,
+        std::vector<std::pair<std::size_t, std::size_t>> const& edges)
+  {
+    std::vector<typename Graph_T::vertex_descriptor> vd;
+    for (std::size_t i = 0; i < n; ++i) vd.push_back(boost::add_vertex({i}, g));
+    for (auto const& [u, v] : edges) boost::add_edge(vd[u], vd[v], g);
+    return vd;
+  }
+
+  template <typename Graph_T>
+  std::vector<std::size_t>
+  indices(Graph_T const& g, std::vector<typename Graph_T::vertex_descriptor> const& vs)
+  {
+    std::vector<std::size_t> out;
+    for (auto v : vs) out.push_back(g[v].index);
+    return out;
+  }
+
+  // Reference traversals on std::set/std::queue/std::stack
+  std::vector<std::size_t> goldBfs(VecGraph const& g, std::size_t start)
+  {
+    std::vector<std::size_t> order;
+    std::set<std::size_t>    visited{start};
+    std::queue<std::size_t>  q;
+    for (q.push(start); !q.empty(); q.pop()) {
+      order.push_back(q.front());
+      for (auto v : boost::make_iterator_range(boost::adjacent_vertices(q.front(), g)))
+        if (visited.insert(v).second) q.push(v);
+    }
+    order.erase(order.begin());
+    return order;
+  }
+
+  std::vector<std::size_t> goldDfs(VecGraph const& g, std::size_t start)
+  {
+    std::vector<std::size_t> order;
+    std::set<std::size_t>    visited;
+    std::stack<std::size_t>  s;
+    for (s.push(start); !s.empty();) {
+      auto const u = s.top();
+      s.pop();
+      if (not visited.insert(u).second) continue;
+      order.push_back(u);
+      std::vector<std::size_t> next;
+      for (auto v : boost::make_iterator_range(boost::adjacent_vertices(u, g)))
+        if (not visited.contains(v)) next.push_back(v);
+      for (auto it = next.rbegin(); it != next.rend(); ++it) s.push(*it);
+    }
+    order.erase(order.begin());
+    return order;
+  }
+}   // namespace
+
+
+TEST(MyGraphTraversalTest, denseVisitedSetMarksEachBitOnce)
+{
+  gutl::detail::dense_visited_set visited(130);
+  EXPECT_TRUE(visited.insert(0));
+  EXPECT_TRUE(visited.insert(64));
+  EXPECT_TRUE(visited.insert(129));
+  EXPECT_FALSE(visited.insert(64));
+  EXPECT_TRUE(visited.contains(129));
+  EXPECT_FALSE(visited.contains(63));
+  EXPECT_FALSE(visited.contains(65));
+}
+
+TEST(MyGraphTraversalTest, vertexQueueIsFifo)
+{
+  gutl::detail::vertex_queue<int> q;
+  q.push(1);
+  q.push(2);
+  EXPECT_EQ(q.pop(), 1);
+  q.push(3);
+  EXPECT_EQ(q.pop(), 2);
+  EXPECT_EQ(q.pop(), 3);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(MyGraphTraversalTest, denseAndHashedTraversalsMatchReference)
+{
+  std::size_t const n     = 400;
+  auto const        edges = randomEdges(n, 900);
+
+  VecGraph  vec_graph;
+  ListGraph list_graph;
+  build(vec_graph, n, edges);
+  auto const list_vd = build(list_graph, n, edges);
+
+  for (std::size_t start : {0u, 7u, 123u, 399u}) {
+    auto const bfs = goldBfs(vec_graph, start);
+    EXPECT_EQ(alg::breadthFirstSearch(vec_graph, start), bfs);
+    EXPECT_EQ(indices(list_graph, alg::breadthFirstSearch(list_graph, list_vd[start])), bfs);
+
+    auto const dfs = goldDfs(vec_graph, start);
+    EXPECT_EQ(alg::depthFirstSearch(vec_graph, start), dfs);
+    EXPECT_EQ(indices(list_graph, alg::depthFirstSearch(list_graph, list_vd[start])), dfs);
+  }
+}
@@ -0,0 +1,104 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Unit test utils
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Day 4 graph traversal library
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/w1d4_graph_traversal/direction_optimizing_bfs.h>
+#include <lib3611/w1d4_graph_traversal/multi_source_bfs.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <random>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace
+{
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS>;
+
+  std::vector<std::size_t> randomSources(std::size_t n, std::size_t count, unsigned seed)
+  {
+    std::mt19937                               rng(seed);
+    std::uniform_int_distribution<std::size_t> vertex(0, n - 1);
+
+    std::vector<std::size_t> sources(count);
+    for (auto& s : sources) s = vertex(rng);
+    return sources;
+  }
+}   // namespace
+
+
+TEST(MyMultiSourceBfsTest, distancesMatchSingleSourceBfs)
+{
+  auto const g = gen::randomGraph<Graph>(2000, 5000, 8);
+
+  // Two and a half 64-source batches, with repeated sources
+  auto sources = randomSources(2000, 160, 9);
+  sources[100] = sources[3];
+
+  auto const narrow = alg::multiSourceBfsDistances(g, sources);
+  auto const wide   = alg::multiSourceBfsDistances<4>(g, sources);
+
+  ASSERT_EQ(narrow.size(), sources.size());
+  for (std::size_t i = 0; i < sources.size(); ++i) {
+    auto const gold = alg::directionOptimizingBfs(g, sources[i]).level;
+    EXPECT_EQ(narrow[i], gold) << i;
+    EXPECT_EQ(wide[i], gold) << i;
+  }
+}
+
+TEST(MyMultiSourceBfsTest, longPathKeepsSparseLevels)
+{
+  // Every level of a directed path reaches one vertex per source, far
+  // below the dense threshold, over thousands of levels
+  std::size_t const n = 3000;
+  Graph             g(n);
+  for (std::size_t v = 0; v + 1 < n; ++v) boost::add_edge(v, v + 1, g);
+
+  auto const sources = std::vector<std::size_t>{0, 1500, 2999, 1500};
+  auto const dist    = alg::multiSourceBfsDistances(g, sources);
+  for (std::size_t i = 0; i < sources.size(); ++i)
+    EXPECT_EQ(dist[i], alg::directionOptimizingBfs(g, sources[i]).level) << i;
+}
+
+TEST(MyMultiSourceBfsTest, callbackStreamsLevelByLevel)
+{
+  auto const g       = gutl::makeCsrGraph(gen::randomGraph<Graph>(500, 1500, 10));
+  auto const sources = std::vector<std::uint32_t>{0, 7, 7, 499};
+
+  std::vector<std::size_t>               last_depth(sources.size(), 0);
+  std::vector<std::vector<std::size_t>> reached(sources.size());
+  alg::multiSourceBfs(g, sources,
+                      [&](std::size_t i, std::uint32_t v, std::size_t d) {
+                        EXPECT_GE(d, last_depth[i]);
+                        last_depth[i] = d;
+                        reached[i].push_back(v);
+                      });
+
+  for (std::size_t i = 0; i < sources.size(); ++i) {
+    ASSERT_FALSE(reached[i].empty());
+    EXPECT_EQ(reached[i].front(), sources[i]);
+
+    auto const tree = alg::directionOptimizingBfs(g, sources[i]);
+    EXPECT_EQ(reached[i].size(),
+              std::size_t(std::ranges::count_if(tree.level, [](auto l) {
+                return l != alg::bfs_tree<std::uint32_t>::unreached;
+              })));
+  }
+  EXPECT_EQ(reached[1], reached[2]);
+}
+
+TEST(MyMultiSourceBfsTest, noSources)
+{
+  auto const               g = gen::randomGraph<Graph>(10, 20, 1);
+  std::vector<std::size_t> none;
+  EXPECT_TRUE(alg::multiSourceBfsDistances(g, none).empty());
+}
@@ -0,0 +1,81 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Unit test utils
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Day 4 graph traversal library
+#include <lib3611/w1d4_graph_traversal/direction_optimizing_bfs.h>
+#include <lib3611/w1d4_graph_traversal/parallel_bfs.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <random>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace
+{
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS>;
+  using Tree  = alg::bfs_tree<std::size_t>;
+
+  void expectValidParents(Graph const& g, std::size_t start, Tree const& tree)
+  {
+    for (std::size_t v = 0; v < boost::num_vertices(g); ++v) {
+      if (v == start or tree.level[v] == Tree::unreached) {
+        EXPECT_EQ(tree.parent[v], v);
+        continue;
+      }
+      auto const p = tree.parent[v];
+      EXPECT_EQ(tree.level[p] + 1, tree.level[v]) << v;
+      EXPECT_TRUE(boost::edge(p, v, g).second) << p << " -> " << v;
+    }
+  }
+}   // namespace
+
+
+TEST(MyParallelBfsTest, levelsMatchSerialBfs)
+{
+  dte3611::utils::ThreadPool pool(4);
+
+  // Frontiers both below and well above one chunk
+  for (auto const& [n, m] : {std::pair{3000u, 3500u}, std::pair{50000u, 400000u}}) {
+    auto const g = gen::randomGraph<Graph>(n, m, n ^ m);
+    for (std::size_t start : {0u, 1234u}) {
+      auto const serial = alg::directionOptimizingBfs(g, start);
+      auto const tree   = alg::parallelBfs(pool, g, start);
+      EXPECT_EQ(tree.level, serial.level);
+      expectValidParents(g, start, tree);
+    }
+  }
+}
+
+TEST(MyParallelBfsTest, unreachedVerticesAndDefaultPool)
+{
+  // Two disjoint paths 0 -> 1 -> 2 and 3 -> 4
+  Graph g(6);
+  boost::add_edge(0, 1, g);
+  boost::add_edge(1, 2, g);
+  boost::add_edge(3, 4, g);
+
+  auto const tree = alg::parallelBfs(g, std::size_t{0});
+
+  EXPECT_EQ(tree.level, (std::vector<std::size_t>{0, 1, 2, Tree::unreached,
+                                                  Tree::unreached, Tree::unreached}));
+  EXPECT_EQ(tree.parent, (std::vector<std::size_t>{0, 0, 1, 3, 4, 5}));
+  EXPECT_EQ(tree.top_down_steps, 3u);
+}
+
+TEST(MyParallelBfsTest, singleThreadPool)
+{
+  dte3611::utils::ThreadPool pool(1);
+  auto const                 g = gen::randomGraph<Graph>(20000, 120000, 3);
+
+  auto const tree = alg::parallelBfs(pool, g, std::size_t{7});
+  EXPECT_EQ(tree.level, alg::directionOptimizingBfs(g, 7).level);
+  expectValidParents(g, 7, tree);
+}
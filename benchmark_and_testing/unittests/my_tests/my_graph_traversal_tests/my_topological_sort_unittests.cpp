@@ -0,0 +1,68 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Unit test utils
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Day 4 graph traversal library
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/w1d4_graph_traversal/topological_sort.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace
+{
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS>;
+
+  template <typename Graph_T>
+  void expectTopological(Graph_T const& g, std::vector<typename Graph_T::vertex_descriptor> const& order)
+  {
+    ASSERT_EQ(order.size(), boost::num_vertices(g));
+    std::vector<std::size_t> position(order.size(), order.size());
+    for (std::size_t i = 0; i < order.size(); ++i) position[order[i]] = i;
+    for (auto e : boost::make_iterator_range(boost::edges(g)))
+      EXPECT_LT(position[boost::source(e, g)], position[boost::target(e, g)]);
+  }
+}   // namespace
+
+
+TEST(MyTopologicalSortTest, ordersEveryEdgeForward)
+{
+  auto const g = gen::randomDag<Graph>(3000, 12000, 41);
+  expectTopological(g, alg::topologicalSort(g));
+
+  auto const csr = gutl::makeCsrGraph(g);
+  expectTopological(csr, alg::topologicalSort(csr));
+}
+
+TEST(MyTopologicalSortTest, sourcesFirstInIndexOrder)
+{
+  // 3 -> 1 -> 0, 2 isolated
+  Graph g(4);
+  boost::add_edge(3, 1, g);
+  boost::add_edge(1, 0, g);
+
+  EXPECT_EQ(alg::topologicalSort(g), (std::vector<std::size_t>{2, 3, 1, 0}));
+}
+
+TEST(MyTopologicalSortTest, cycleThrows)
+{
+  Graph g(4);
+  boost::add_edge(0, 1, g);
+  boost::add_edge(1, 2, g);
+  boost::add_edge(2, 3, g);
+  boost::add_edge(3, 1, g);
+
+  EXPECT_THROW(alg::topologicalSort(g), std::invalid_argument);
+}
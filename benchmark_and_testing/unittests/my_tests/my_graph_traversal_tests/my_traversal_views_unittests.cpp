@@ -0,0 +1,112 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Unit test utils
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Day 4 graph traversal library
+#include <lib3611/w1d4_graph_traversal/breadth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/depth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/traversal_views.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <random>
+#include <ranges>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace
+{
+  using VecGraph  = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS>;
+  using ListGraph = boost::adjacency_list<boost::vecS, boost::listS, boost::bidirectionalS>;
+
+  // Path 0 -> 1 -> ... -> n - 1
+  VecGraph path(std::size_t n)
+  {
+    VecGraph g(n);
+    for (std::size_t v = 0; v + 1 < n; ++v) boost::add_edge(v, v + 1, g);
+    return g;
+  }
+
+  template <std::ranges::input_range Range_T>
+  auto collect(Range_T&& range)
+  {
+    std::vector<std::ranges::range_value_t<Range_T>> out;
+    for (auto v : range) out.push_back(v);
+    return out;
+  }
+}   // namespace
+
+
+TEST(MyTraversalViewsTest, yieldTheEagerOrder)
+{
+  static_assert(std::ranges::view<decltype(alg::breadthFirstView(std::declval<VecGraph const&>(), 0))>);
+  static_assert(std::ranges::input_range<decltype(alg::depthFirstView(std::declval<VecGraph const&>(), 0))>);
+
+  auto const g = gen::randomGraph<VecGraph>(800, 2400, 5);
+  for (std::size_t start : {0u, 17u, 799u}) {
+    EXPECT_EQ(collect(alg::breadthFirstView(g, start)), alg::breadthFirstSearch(g, start));
+    EXPECT_EQ(collect(alg::depthFirstView(g, start)), alg::depthFirstSearch(g, start));
+
+    gutl::TraversalWorkspace<VecGraph> workspace;
+    EXPECT_EQ(collect(alg::breadthFirstView(workspace, g, start)),
+              alg::breadthFirstSearch(g, start));
+    EXPECT_EQ(collect(alg::depthFirstView(workspace, g, start)),
+              alg::depthFirstSearch(g, start));
+  }
+
+  // Hashed visited set for non-index descriptors
+  auto const lg    = gen::randomGraph<ListGraph>(300, 900, 6);
+  auto const start = *boost::vertices(lg).first;
+  EXPECT_EQ(collect(alg::breadthFirstView(lg, start)), alg::breadthFirstSearch(lg, start));
+  EXPECT_EQ(collect(alg::depthFirstView(lg, start)), alg::depthFirstSearch(lg, start));
+}
+
+TEST(MyTraversalViewsTest, composeWithRangeAdaptors)
+{
+  auto const g = gen::randomGraph<VecGraph>(500, 2000, 9);
+
+  auto const bfs  = alg::breadthFirstSearch(g, 3);
+  auto       even = [](std::size_t v) { return v % 2 == 0; };
+
+  std::vector<std::size_t> expected;
+  std::ranges::copy(bfs | std::views::filter(even) | std::views::take(5),
+                    std::back_inserter(expected));
+
+  EXPECT_EQ(collect(alg::breadthFirstView(g, 3) | std::views::filter(even) | std::views::take(5)),
+            expected);
+
+  auto view  = alg::depthFirstView(g, 3);
+  auto found = std::ranges::find(view, alg::depthFirstSearch(g, 3)[10]);
+  ASSERT_NE(found, view.end());
+  EXPECT_EQ(*found, alg::depthFirstSearch(g, 3)[10]);
+}
+
+TEST(MyTraversalViewsTest, stopsWhereIterationStops)
+{
+  auto const                         g = path(10000);
+  gutl::TraversalWorkspace<VecGraph> workspace;
+
+  // Three vertices taken -- the traversal has seen one step further, no more
+  for (auto v : alg::breadthFirstView(workspace, g, 0) | std::views::take(3)) (void)v;
+  EXPECT_TRUE(workspace.contains(4));
+  EXPECT_FALSE(workspace.contains(5));
+  EXPECT_FALSE(workspace.contains(9999));
+
+  for (auto v : alg::depthFirstView(workspace, g, 0)) {
+    if (v == 100) break;
+  }
+  EXPECT_TRUE(workspace.contains(100));
+  EXPECT_FALSE(workspace.contains(101));
+
+  // Nothing reachable but the start
+  auto last = alg::breadthFirstView(g, 9999);
+  EXPECT_TRUE(last.begin() == last.end());
+}
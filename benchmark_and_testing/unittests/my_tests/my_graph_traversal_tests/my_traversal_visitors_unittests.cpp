@@ -0,0 +1,174 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Unit test utils
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Day 4 graph traversal library
+#include <lib3611/utils/csr_graph_bgl.h>
+#include <lib3611/w1d4_graph_traversal/breadth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/depth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/traversal_visitors.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <random>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace
+{
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS>;
+
+  struct DiscoveryOrder {
+    std::vector<std::size_t> order;
+
+    template <typename Graph_T>
+    void discover_vertex(typename Graph_T::vertex_descriptor v, Graph_T const&)
+    {
+      order.push_back(v);
+    }
+  };
+
+  // Number of trees in a *VisitAll forest
+  struct RootCounter {
+    std::size_t roots{0};
+
+    template <typename V_T, typename G_T>
+    void start_vertex(V_T const&, G_T const&)
+    {
+      ++roots;
+    }
+  };
+
+  struct CycleDetector {
+    bool cyclic{false};
+
+    template <typename E_T, typename G_T>
+    void back_edge(E_T const&, G_T const&)
+    {
+      cyclic = true;
+    }
+  };
+
+  // Depth of every vertex in its BFS tree
+  struct LevelRecorder {
+    std::vector<std::size_t> level;
+
+    template <typename E_T, typename G_T>
+    void tree_edge(E_T const& e, G_T const& g)
+    {
+      level[boost::target(e, g)] = level[boost::source(e, g)] + 1;
+    }
+  };
+
+  struct EdgeCounter {
+    std::size_t examined{0}, tree{0}, back{0}, forward_or_cross{0}, non_tree{0}, finished{0};
+
+    template <typename E_T, typename G_T> void examine_edge(E_T const&, G_T const&) { ++examined; }
+    template <typename E_T, typename G_T> void tree_edge(E_T const&, G_T const&) { ++tree; }
+    template <typename E_T, typename G_T> void back_edge(E_T const&, G_T const&) { ++back; }
+    template <typename E_T, typename G_T> void forward_or_cross_edge(E_T const&, G_T const&)
+    {
+      ++forward_or_cross;
+    }
+    template <typename E_T, typename G_T> void non_tree_edge(E_T const&, G_T const&) { ++non_tree; }
+    template <typename V_T, typename G_T> void finish_vertex(V_T const&, G_T const&) { ++finished; }
+  };
+
+  template <typename VertexDescriptor_T>
+  std::vector<std::size_t> withStart(std::size_t start, std::vector<VertexDescriptor_T> const& rest)
+  {
+    std::vector<std::size_t> order{start};
+    order.insert(order.end(), rest.begin(), rest.end());
+    return order;
+  }
+}   // namespace
+
+
+TEST(MyTraversalVisitorsTest, discoveryOrderMatchesTraversals)
+{
+  auto const g   = gen::randomGraph<Graph>(1000, 3000, 4);
+  auto const csr = gutl::makeCsrGraph(g);
+
+  for (std::size_t start : {0u, 500u}) {
+    DiscoveryOrder bfs, dfs, csr_bfs, csr_dfs, ws_dfs;
+    alg::breadthFirstVisit(g, start, bfs);
+    alg::depthFirstVisit(g, start, dfs);
+    alg::breadthFirstVisit(csr, std::uint32_t(start), csr_bfs);
+    alg::depthFirstVisit(csr, std::uint32_t(start), csr_dfs);
+
+    gutl::TraversalWorkspace<Graph> workspace;
+    alg::depthFirstVisit(workspace, g, start, ws_dfs);
+
+    EXPECT_EQ(bfs.order, withStart(start, alg::breadthFirstSearch(g, start)));
+    EXPECT_EQ(dfs.order, withStart(start, alg::depthFirstSearch(g, start)));
+    EXPECT_EQ(csr_bfs.order, bfs.order);
+    EXPECT_EQ(csr_dfs.order, dfs.order);
+    EXPECT_EQ(ws_dfs.order, dfs.order);
+  }
+}
+
+TEST(MyTraversalVisitorsTest, edgeClassification)
+{
+  // 0 -> 1 -> 2 -> 0 (cycle), 0 -> 2 (forward), 3 -> 2 (cross, from a later root)
+  Graph g(4);
+  boost::add_edge(0, 1, g);
+  boost::add_edge(1, 2, g);
+  boost::add_edge(2, 0, g);
+  boost::add_edge(0, 2, g);
+  boost::add_edge(3, 2, g);
+
+  EdgeCounter dfs;
+  alg::depthFirstVisitAll(g, dfs);
+  EXPECT_EQ(dfs.examined, 5u);
+  EXPECT_EQ(dfs.tree, 2u);
+  EXPECT_EQ(dfs.back, 1u);
+  EXPECT_EQ(dfs.forward_or_cross, 2u);
+  EXPECT_EQ(dfs.finished, 4u);
+  EXPECT_EQ(dfs.non_tree, 0u);
+
+  EdgeCounter bfs;
+  alg::breadthFirstVisitAll(g, bfs);
+  EXPECT_EQ(bfs.examined, 5u);
+  EXPECT_EQ(bfs.tree, 2u);   // 0 -> 1, 0 -> 2
+  EXPECT_EQ(bfs.non_tree, 3u);
+  EXPECT_EQ(bfs.back, 0u);
+  EXPECT_EQ(bfs.finished, 4u);
+}
+
+TEST(MyTraversalVisitorsTest, severalAnalysesInOnePass)
+{
+  // Two chains 0 -> 1 -> 2 and 3 -> 4 -> 5, then close a cycle in the second
+  Graph g(6);
+  boost::add_edge(0, 1, g);
+  boost::add_edge(1, 2, g);
+  boost::add_edge(3, 4, g);
+  boost::add_edge(4, 5, g);
+
+  RootCounter   roots;
+  CycleDetector cycles;
+  alg::depthFirstVisitAll(g, alg::visitor_list(roots, cycles));
+  EXPECT_EQ(roots.roots, 2u);
+  EXPECT_FALSE(cycles.cyclic);
+
+  boost::add_edge(5, 3, g);
+  RootCounter   roots2;
+  CycleDetector cycles2;
+  LevelRecorder levels{std::vector<std::size_t>(6, 0)};
+  alg::depthFirstVisitAll(g, alg::visitor_list(roots2, cycles2));
+  alg::breadthFirstVisitAll(g, alg::visitor_list(levels));
+  EXPECT_EQ(roots2.roots, 2u);
+  EXPECT_TRUE(cycles2.cyclic);
+  EXPECT_EQ(levels.level, (std::vector<std::size_t>{0, 1, 2, 0, 1, 2}));
+
+  // A visitor without hooks is a plain traversal
+  struct Nothing {};
+  alg::breadthFirstVisit(g, 0, Nothing{});
+  alg::depthFirstVisit(g, 0, Nothing{});
+}
@@ -0,0 +1,112 @@
+// boost -- ahead of the library headers, which expect the full adjacency_list
+#include <boost/graph/adjacency_list.hpp>
+
+// Unit test utils
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+// Day 4 graph traversal library
+#include <lib3611/w1d4_graph_traversal/breadth_first_search.h>
+#include <lib3611/w1d4_graph_traversal/depth_first_search.h>
+
+// Day 5 graph path finding library
+#include <lib3611/w1d5_graph_path_finding/dijkstra_shortest_paths.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace alg  = dte3611::graph::algorithms;
+namespace gutl = dte3611::graph::utils;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace
+{
+  struct EdgeProperties {
+    double distance{1.};
+  };
+
+  using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS,
+                                      boost::no_property, EdgeProperties>;
+
+  // Sparse random graph: many small components, small integral weights
+  Graph randomGraph(std::size_t n, std::size_t m)
+  {
+    std::uniform_int_distribution<> weight(1, 3);
+
+    return gen::randomGraph<Graph>(n, m, 3611, [&](std::mt19937& rng, std::size_t) {
+      return EdgeProperties{double(weight(rng))};
+    });
+  }
+
+  auto sorted(std::vector<std::vector<std::size_t>> paths)
+  {
+    std::ranges::sort(paths);
+    return paths;
+  }
+
+  auto const distance_op = [](auto const& e, auto const& g) { return g[e].distance; };
+}   // namespace
+
+
+TEST(MyTraversalWorkspaceTest, resetForgetsEverySeenVertex)
+{
+  Graph                           g(100);
+  gutl::TraversalWorkspace<Graph> workspace(g);
+
+  EXPECT_TRUE(workspace.insert(5));
+  EXPECT_FALSE(workspace.insert(5));
+  EXPECT_TRUE(workspace.settle(5));
+  EXPECT_TRUE(workspace.contains(5));
+  EXPECT_TRUE(workspace.settled(5));
+
+  for (int query = 0; query < 1000; ++query) {
+    workspace.reset(g);
+    ASSERT_FALSE(workspace.contains(5));
+    ASSERT_FALSE(workspace.settled(5));
+    ASSERT_TRUE(workspace.insert(static_cast<std::size_t>(query % 100)));
+  }
+
+  // A different vertex count resizes
+  boost::add_vertex(g);
+  workspace.reset(g);
+  EXPECT_EQ(workspace.size(), 101u);
+  EXPECT_TRUE(workspace.insert(100));
+}
+
+TEST(MyTraversalWorkspaceTest, reusedWorkspaceMatchesFreshTraversals)
+{
+  auto const                      g = randomGraph(3000, 2500);
+  gutl::TraversalWorkspace<Graph> workspace;
+
+  for (std::size_t start = 0; start < 3000; start += 37) {
+    ASSERT_EQ(alg::breadthFirstSearch(workspace, g, start),
+              alg::breadthFirstSearch(g, start));
+    ASSERT_EQ(alg::depthFirstSearch(workspace, g, start),
+              alg::depthFirstSearch(g, start));
+
+    auto const goal = (start * 7 + 11) % 3000;
+    ASSERT_EQ(sorted(alg::dijkstraShortestPaths(workspace, g, start, goal, distance_op)),
+              sorted(alg::dijkstraShortestPaths(g, start, goal, distance_op)))
+      << start << " -> " << goal;
+  }
+}
+
+TEST(MyTraversalWorkspaceTest, dijkstraFindsEveryTiedPath)
+{
+  // Diamond 0 -> {1, 2} -> 3, both sides of equal length
+  Graph g(4);
+  boost::add_edge(0, 1, g);
+  boost::add_edge(0, 2, g);
+  boost::add_edge(1, 3, g);
+  boost::add_edge(2, 3, g);
+
+  gutl::TraversalWorkspace<Graph> workspace;
+  for (int query = 0; query < 3; ++query)
+    EXPECT_EQ(sorted(alg::dijkstraShortestPaths(workspace, g, 0, 3, distance_op)),
+              (std::vector<std::vector<std::size_t>>{{1, 3}, {2, 3}}));
+  EXPECT_TRUE(alg::dijkstraShortestPaths(workspace, g, 3, 0, distance_op).empty());
+}
@@ -0,0 +1,86 @@
+#include <predefined_utils/testing/fixtures/flow_testing_fixtures.h>
+#include <predefined_utils/testing/fixtures/random_graph_testing_fixtures.h>
+
+#include <lib3611/w3_network_flow/network_flow.h>
+
+// gtest
+#include <gtest/gtest.h>
+
+// stl
+#include <random>
+#include <vector>
+
+using namespace dte3611::predef::testing::flow::fixtures;
+using namespace dte3611::predef::testing::flow::detail;
+
+namespace alg  = dte3611::np::algorithms;
+namespace gutl = dte3611::graph::utils;
+namespace gen  = dte3611::predef::testing::graph::generators;
+
+namespace {
+
+using Graph = types::BidirectionalGraph;
+
+Graph randomNetwork(std::size_t n, std::size_t m, unsigned seed)
+{
+  std::uniform_int_distribution<> capacity(1, 20);
+
+  return gen::randomLooplessGraph<Graph>(n, m, seed, [&](std::mt19937& rng, std::size_t) {
+    return types::properties::EdgeProperties{0, capacity(rng), 0};
+  });
+}
+
+// Max-flow min-cut: the vertices reachable in the residual graph form a
+// cut whose capacity is the flow value, and the sink is not among them
+int residualCutCapacity(Graph const& g, std::size_t source, std::size_t sink)
+{
+  std::vector<bool>        reached(boost::num_vertices(g), false);
+  std::vector<std::size_t> stack{source};
+  reached[source] = true;
+  while (!stack.empty()) {
+    auto const u = stack.back();
+    stack.pop_back();
+    for (auto e : boost::make_iterator_range(boost::out_edges(u, g)))
+      if (g[e].capacity > g[e].flow && !reached[boost::target(e, g)])
+        reached[boost::target(e, g)] = true, stack.push_back(boost::target(e, g));
+    for (auto e : boost::make_iterator_range(boost::in_edges(u, g)))
+      if (g[e].flow > 0 && !reached[boost::source(e, g)])
+        reached[boost::source(e, g)] = true, stack.push_back(boost::source(e, g));
+  }
+  if (reached[sink]) return -1;
+
+  int cut = 0;
+  for (auto e : boost::make_iterator_range(boost::edges(g)))
+    if (reached[boost::source(e, g)] && !reached[boost::target(e, g)])
+      cut += g[e].capacity;
+  return cut;
+}
+
+}  // namespace
+
+
+TEST_F(FordFulkersonDemoDAGF, maxFlowWithWorkspace)
+{
+  gutl::TraversalWorkspace<Graph> workspace;
+  EXPECT_EQ(alg::maxFlow(workspace, gold->graph(), gold->s(), gold->t()),
+            gold->maxFlowSTGold());
+  // Reused for a second run on the same graph
+  EXPECT_EQ(alg::maxFlow(workspace, gold->graph(), gold->s(), gold->t()),
+            gold->maxFlowSTGold());
+}
+
+TEST(MyMaxFlowWorkspaceTest, sharedWorkspaceMatchesMinCut)
+{
+  // One workspace across graphs of different sizes
+  gutl::TraversalWorkspace<Graph> workspace;
+
+  for (unsigned seed = 0; seed < 20; ++seed) {
+    auto const n = 10 + 7 * std::size_t{seed};
+    auto       g     = randomNetwork(n, 4 * n, seed);
+    auto       fresh = randomNetwork(n, 4 * n, seed);
+
+    int const flow = alg::maxFlow(workspace, g, 0, n - 1);
+    EXPECT_EQ(residualCutCapacity(g, 0, n - 1), flow) << seed;
+    EXPECT_EQ(alg::maxFlow(fresh, 0, n - 1), flow) << seed;
+  }
+}
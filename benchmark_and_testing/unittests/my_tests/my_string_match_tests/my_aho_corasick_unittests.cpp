@@ -0,0 +1,177 @@
+// Day3 string match library
+#include <lib3611/w1d3_string_match/aho_corasick_search.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+
+namespace
+{
+  // Brute force gold -- every occurrence of every pattern, ordered as the
+  // automaton reports them (by match end, then pattern id)
+  template <typename Haystack_T, typename Patterns_T>
+  std::vector<alg::aho_corasick_match> bruteForceHits(Haystack_T const& haystack,
+                                                      Patterns_T const& patterns)
+  {
+    std::vector<alg::aho_corasick_match> hits;
+    for (std::size_t id = 0; id < patterns.size(); ++id) {
+      auto const& p = patterns[id];
+      if (p.empty()) continue;
+      for (auto it = haystack.begin();; ++it) {
+        it = std::search(it, haystack.end(), p.begin(), p.end());
+        if (it == haystack.end()) break;
+        hits.push_back(
+          {id, static_cast<std::size_t>(std::distance(haystack.begin(), it))});
+      }
+    }
+    std::ranges::sort(hits, [&patterns](auto const& a, auto const& b) {
+      auto const end_a = a.offset + patterns[a.pattern_id].size();
+      auto const end_b = b.offset + patterns[b.pattern_id].size();
+      return end_a != end_b ? end_a < end_b : a.pattern_id < b.pattern_id;
+    });
+    return hits;
+  }
+
+  template <typename Hits_T>
+  void sortHits(Hits_T& hits)
+  {
+    std::ranges::sort(hits);
+  }
+}   // namespace
+
+
+TEST(MyAhoCorasickTest, classicDictionary)
+{
+  std::vector<std::string> const patterns{"he", "she", "his", "hers"};
+  std::string const              haystack = "ushers";
+
+  auto hits = alg::aho_corasick_search(haystack, patterns);
+  sortHits(hits);
+
+  std::vector<alg::aho_corasick_match> const gold{{0, 2}, {1, 1}, {3, 2}};
+  EXPECT_EQ(hits, gold);
+}
+
+TEST(MyAhoCorasickTest, emptyInputs)
+{
+  std::vector<std::string> const patterns{"", "a"};
+
+  EXPECT_TRUE(alg::aho_corasick_search(std::string{}, patterns).empty());
+  EXPECT_TRUE(
+    alg::aho_corasick_search(std::string{"bbb"}, std::vector<std::string>{})
+      .empty());
+
+  auto const hits = alg::aho_corasick_search(std::string{"aa"}, patterns);
+  EXPECT_EQ(hits.size(), 2u);
+}
+
+TEST(MyAhoCorasickTest, randomDenseMatchesBruteForce)
+{
+  std::mt19937                    rng(3611);
+  std::uniform_int_distribution<> ch_dist('a', 'd');
+  std::uniform_int_distribution<> len_dist(1, 6);
+
+  auto random_string = [&](std::size_t len) {
+    std::string s(len, ' ');
+    for (auto& ch : s) ch = static_cast<char>(ch_dist(rng));
+    return s;
+  };
+
+  std::vector<std::string> patterns;
+  for (int i = 0; i < 64; ++i)
+    patterns.push_back(random_string(static_cast<std::size_t>(len_dist(rng))));
+  patterns.push_back(patterns.front());   // duplicate pattern
+
+  alg::aho_corasick_automaton<char> const automaton(patterns);
+  EXPECT_EQ(automaton.patternCount(), patterns.size());
+
+  for (int i = 0; i < 20; ++i) {
+    auto const haystack = random_string(500);
+    auto       hits     = automaton.findAll(haystack);
+    auto       gold     = bruteForceHits(haystack, patterns);
+    sortHits(hits);
+    sortHits(gold);
+    EXPECT_EQ(hits, gold);
+  }
+}
+
+TEST(MyAhoCorasickTest, sparseWordAlphabet)
+{
+  // Non-byte keys -- tokens as symbols
+  using Words = std::vector<std::string>;
+
+  std::vector<Words> const patterns{
+    {"the", "quick"}, {"quick", "brown", "fox"}, {"fox"}, {"lazy", "dog"}};
+  Words const haystack{"the", "quick", "brown", "fox", "jumps", "over",
+                       "the", "lazy",  "dog"};
+
+  auto hits = alg::aho_corasick_search(haystack, patterns);
+  auto gold = bruteForceHits(haystack, patterns);
+  sortHits(hits);
+  sortHits(gold);
+  EXPECT_EQ(hits, gold);
+  EXPECT_EQ(hits.size(), 4u);
+}
+
+TEST(MyAhoCorasickTest, widerTextValuesDoNotAliasKeys)
+{
+  // U+10041 truncates to u'A'; it must match nothing, not the pattern "A"
+  std::vector<std::u16string> const patterns{u"A", u"xA"};
+  std::vector<char32_t> const       haystack{U'\U00010041', U'x', U'A', U'\U00010041'};
+
+  auto hits = alg::aho_corasick_search(haystack, patterns);
+  auto gold = bruteForceHits(haystack, patterns);
+  sortHits(hits);
+  sortHits(gold);
+  EXPECT_EQ(hits, gold);
+  EXPECT_EQ(hits.size(), 2u);
+
+  std::vector<char32_t> const lone{U'\U00010041', U'x'};
+  EXPECT_TRUE(alg::aho_corasick_search(lone, patterns).empty());
+}
+
+TEST(MyAhoCorasickTest, streamingAcrossChunks)
+{
+  std::vector<std::string_view> const patterns{"abc", "cab", "bca"};
+  std::string_view const              haystack = "xxabcabcaxx";
+
+  alg::aho_corasick_automaton<char> const automaton(patterns);
+
+  std::vector<alg::aho_corasick_match> streamed;
+  auto sink = [&streamed](alg::aho_corasick_match const& hit) {
+    streamed.push_back(hit);
+  };
+
+  // Matches straddle the chunk borders
+  alg::aho_corasick_automaton<char>::scanner scanner(automaton);
+  scanner.feed(haystack.substr(0, 4), sink);
+  scanner.feed(haystack.substr(4, 3), sink);
+  scanner.feed(haystack.substr(7), sink);
+
+  EXPECT_EQ(streamed, automaton.findAll(haystack));
+  EXPECT_EQ(streamed.size(), 5u);
+}
+
+TEST(MyAhoCorasickTest, projections)
+{
+  auto const fold = [](char ch) {
+    return static_cast<char>(ch >= 'A' && ch <= 'Z' ? ch - 'A' + 'a' : ch);
+  };
+
+  std::vector<std::string> const patterns{"HELLO", "World"};
+  std::string const              haystack = "hello WORLD";
+
+  auto hits = alg::aho_corasick_search(haystack, patterns, fold, fold);
+  sortHits(hits);
+
+  std::vector<alg::aho_corasick_match> const gold{{0, 0}, {1, 6}};
+  EXPECT_EQ(hits, gold);
+}
@@ -0,0 +1,181 @@
+// Day3 string match library
+#include <lib3611/w1d3_string_match/approximate_search.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <cctype>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+
+namespace
+{
+
+  // (end offset, errors) pairs -- easier to compare and print than iterators
+  using Hits = std::vector<std::pair<std::size_t, std::size_t>>;
+
+  template <typename Range_T, typename Match_T>
+  Hits toOffsets(Range_T const& haystack, std::vector<Match_T> const& matches)
+  {
+    Hits hits;
+    for (auto const& match : matches)
+      hits.emplace_back(
+        static_cast<std::size_t>(std::distance(std::begin(haystack), match.end)),
+        match.errors);
+    return hits;
+  }
+
+  // Hamming distance of every length-m window, reported at its end
+  Hits goldMismatches(std::string const& text, std::string const& pat,
+                      std::size_t k)
+  {
+    Hits hits;
+    for (std::size_t i = 0; i + pat.size() <= text.size(); ++i) {
+      std::size_t errors = 0;
+      for (std::size_t j = 0; j < pat.size(); ++j)
+        errors += text[i + j] != pat[j];
+      if (errors <= k) hits.emplace_back(i + pat.size(), errors);
+    }
+    return hits;
+  }
+
+  // Sellers' O(nm) DP: free start in the text, edit distance of the pattern
+  Hits goldEdits(std::string const& text, std::string const& pat, std::size_t k)
+  {
+    std::size_t const        m = pat.size();
+    std::vector<std::size_t> col(m + 1);
+    for (std::size_t i = 0; i <= m; ++i) col[i] = i;
+
+    Hits hits;
+    if (col[m] <= k) hits.emplace_back(0, col[m]);
+    for (std::size_t j = 0; j < text.size(); ++j) {
+      std::size_t diag = col[0];
+      col[0]           = 0;
+      for (std::size_t i = 1; i <= m; ++i) {
+        std::size_t const up = col[i];
+        col[i] = std::min({col[i] + 1, col[i - 1] + 1,
+                           diag + (pat[i - 1] == text[j] ? 0 : 1)});
+        diag   = up;
+      }
+      if (col[m] <= k) hits.emplace_back(j + 1, col[m]);
+    }
+    return hits;
+  }
+
+  std::string randomString(std::mt19937& rng, std::size_t len, char top)
+  {
+    std::uniform_int_distribution<> ch_dist('a', top);
+    std::string                     s(len, ' ');
+    for (auto& ch : s) ch = static_cast<char>(ch_dist(rng));
+    return s;
+  }
+
+}   // namespace
+
+TEST(MyApproximateSearchTest, bitapMatchesHammingGold)
+{
+  std::mt19937                    rng(3611);
+  std::uniform_int_distribution<> len_dist(1, 64);
+
+  for (int i = 0; i < 500; ++i) {
+    auto const text    = randomString(rng, 200, 'd');
+    auto const pattern = randomString(rng, static_cast<std::size_t>(len_dist(rng)), 'd');
+    auto const k       = static_cast<std::size_t>(i % 6);
+
+    ASSERT_EQ(toOffsets(text, alg::bitap_search(text, pattern, k)),
+              goldMismatches(text, pattern, k))
+      << pattern << " k=" << k;
+  }
+}
+
+TEST(MyApproximateSearchTest, myersMatchesSellersGold)
+{
+  // Lengths straddle the 64-bit block boundary
+  std::mt19937                    rng(3611);
+  std::uniform_int_distribution<> len_dist(1, 200);
+
+  for (int i = 0; i < 300; ++i) {
+    auto const text    = randomString(rng, 400, 'c');
+    auto const pattern = randomString(rng, static_cast<std::size_t>(len_dist(rng)), 'c');
+    auto const k       = static_cast<std::size_t>(i % 4) * pattern.size() / 8;
+
+    ASSERT_EQ(toOffsets(text, alg::myers_search(text, pattern, k)),
+              goldEdits(text, pattern, k))
+      << pattern.size() << " k=" << k;
+  }
+}
+
+TEST(MyApproximateSearchTest, exactBudgetFindsExactMatches)
+{
+  std::string const text    = "the cat sat on the mat";
+  std::string const pattern = "at";
+
+  Hits const exact{{7, 0}, {11, 0}, {22, 0}};
+  EXPECT_EQ(toOffsets(text, alg::bitap_search(text, pattern, 0)), exact);
+  EXPECT_EQ(toOffsets(text, alg::myers_search(text, pattern, 0)), exact);
+}
+
+TEST(MyApproximateSearchTest, editsAllowIndels)
+{
+  // "colour" is one insertion away from "color"; with mismatches only,
+  // just the window "colou" is within budget
+  std::string const text = "the colour";
+
+  EXPECT_EQ(toOffsets(text, alg::myers_search(text, std::string{"color"}, 1)),
+            (Hits{{8, 1}, {9, 1}, {10, 1}}));
+  EXPECT_EQ(toOffsets(text, alg::bitap_search(text, std::string{"color"}, 1)),
+            (Hits{{9, 1}}));
+}
+
+TEST(MyApproximateSearchTest, forwardIteratorsPredicatesAndProjections)
+{
+  std::list<char> const   text{'X', 'a', 'B', 'c', 'x'};
+  std::string const       pattern = "abd";
+  auto const              lower   = [](char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  };
+
+  auto const hits = alg::bitap_search(text, pattern, 1, std::ranges::equal_to{},
+                                      lower);
+  ASSERT_EQ(hits.size(), 1u);
+  EXPECT_EQ(hits.front().end, std::next(text.begin(), 4));
+  EXPECT_EQ(hits.front().errors, 1u);
+
+  // A non-equality predicate takes the scanning path
+  auto const caseless = [&lower](char a, char b) { return lower(a) == lower(b); };
+  EXPECT_EQ(toOffsets(text, alg::myers_search(text, std::string{"ABC"}, 0, caseless)),
+            (Hits{{4, 0}}));
+}
+
+TEST(MyApproximateSearchTest, nonByteKeysUseHashedMasks)
+{
+  std::vector<int> const text{100, 200, 300, 400, 999, 600};
+  std::vector<int> const pattern{300, 400, 500, 600};
+
+  EXPECT_EQ(toOffsets(text, alg::bitap_search(text, pattern, 1)), (Hits{{6, 1}}));
+  EXPECT_EQ(toOffsets(text, alg::myers_search(text, pattern, 1)), (Hits{{6, 1}}));
+}
+
+TEST(MyApproximateSearchTest, edgeCases)
+{
+  std::string const text = "abc";
+
+  // Empty pattern ends everywhere
+  EXPECT_EQ(alg::bitap_search(text, std::string{}, 0).size(), 4u);
+  EXPECT_EQ(alg::myers_search(text, std::string{}, 0).size(), 4u);
+
+  // Budget at least m: every window (Hamming) / every position (edits)
+  EXPECT_EQ(alg::bitap_search(text, std::string{"xy"}, 5).size(), 2u);
+  EXPECT_EQ(alg::myers_search(text, std::string{"xy"}, 2).size(), 4u);
+
+  EXPECT_THROW(alg::bitap_search(text, std::string(65, 'a'), 1),
+               std::length_error);
+  EXPECT_EQ(alg::myers_search(std::string(100, 'a'), std::string(65, 'a'), 0).size(),
+            36u);
+}
@@ -0,0 +1,149 @@
+// Day3 string match library
+#include <lib3611/w1d3_string_match/naive_search.h>
+#include <lib3611/w1d3_string_match/kmp_search.h>
+#include <lib3611/w1d3_string_match/compiled_pattern.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <cctype>
+#include <list>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+
+namespace
+{
+
+  // Byte strings over a tiny alphabet around the signed/unsigned boundary
+  template <typename Byte_T>
+  std::vector<Byte_T> randomBytes(std::mt19937& rng, std::size_t len)
+  {
+    static constexpr unsigned char alphabet[] = {0x00, 0x7f, 0x80, 0xff};
+    std::uniform_int_distribution<std::size_t> pick(0, 3);
+    std::vector<Byte_T>                        bytes(len);
+    for (auto& b : bytes) b = static_cast<Byte_T>(alphabet[pick(rng)]);
+    return bytes;
+  }
+
+  template <typename Byte_T>
+  void expectRawPathMatchesStdSearch()
+  {
+    std::mt19937                    rng(3611);
+    std::uniform_int_distribution<> len_dist(0, 9);
+
+    for (int i = 0; i < 2000; ++i) {
+      auto const haystack = randomBytes<Byte_T>(rng, static_cast<std::size_t>(len_dist(rng)) * 6);
+      auto const pattern  = randomBytes<Byte_T>(rng, static_cast<std::size_t>(len_dist(rng)));
+
+      auto const gold = std::search(haystack.begin(), haystack.end(),
+                                    pattern.begin(), pattern.end());
+      ASSERT_EQ(alg::naive_search(haystack, pattern), gold);
+      ASSERT_EQ(alg::kmp_search(haystack, pattern), gold);
+      ASSERT_EQ(alg::compile_pattern<alg::naive_search>(pattern).search(haystack), gold);
+    }
+  }
+
+  char lower(char c)
+  {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  }
+
+}   // namespace
+
+TEST(MyByteFastPathTest, charMatchesStdSearch)
+{
+  expectRawPathMatchesStdSearch<char>();
+}
+
+TEST(MyByteFastPathTest, signedAndUnsignedBytesMatchStdSearch)
+{
+  expectRawPathMatchesStdSearch<signed char>();
+  expectRawPathMatchesStdSearch<unsigned char>();
+}
+
+TEST(MyByteFastPathTest, mixedSignednessKeepsValueEquality)
+{
+  // char(-1) != (unsigned char)255 although the bytes are equal
+  std::string const                haystack{'a', '\xff', 'b'};
+  std::vector<unsigned char> const pattern{0xff, 'b'};
+
+  auto const gold = std::search(haystack.begin(), haystack.end(),
+                                pattern.begin(), pattern.end());
+  EXPECT_EQ(alg::naive_search(haystack, pattern), gold);
+  EXPECT_EQ(alg::kmp_search(haystack, pattern), gold);
+}
+
+TEST(MyByteFastPathTest, caseFoldingThroughTranslationTable)
+{
+  std::string const haystack = "The Quick Brown FOX jumps over the lazy fox";
+  std::list<char> const list_haystack(haystack.begin(), haystack.end());
+  auto const caseless = [](char a, char b) { return lower(a) == lower(b); };
+  auto const folded   = dte3611::string_match::utils::makeByteTranslation<char>(lower);
+
+  for (std::string const pattern : {"fox", "quick brown", "LAZY", "dog"}) {
+    auto const gold
+      = std::search(haystack.begin(), haystack.end(), pattern.begin(),
+                    pattern.end(), caseless);
+
+    EXPECT_EQ(alg::naive_search(haystack, pattern, {}, lower, lower), gold) << pattern;
+    EXPECT_EQ(alg::kmp_search(haystack, pattern, {}, lower, lower), gold) << pattern;
+    EXPECT_EQ(alg::naive_search(haystack, pattern, {}, folded, lower), gold) << pattern;
+    EXPECT_EQ(alg::kmp_search(haystack, pattern, {}, folded, lower), gold) << pattern;
+
+    // Forward-only haystacks take the table too
+    EXPECT_EQ(std::distance(list_haystack.begin(),
+                            alg::kmp_search(list_haystack, pattern, {}, folded, lower)),
+              gold - haystack.begin())
+      << pattern;
+  }
+}
+
+TEST(MyByteFastPathTest, searchCallsProjectionOnlyOnScannedElements)
+{
+  // A per-call table would cost 256 calls, on bytes the haystack lacks too
+  std::size_t calls   = 0;
+  auto const counting = [&calls](char c) {
+    ++calls;
+    return lower(c);
+  };
+
+  std::string const haystack = "xxxxNEEDLExx";
+  auto const naive = alg::compile_pattern<alg::naive_search>(std::string_view{"needle"}, {}, lower);
+  auto const kmp   = alg::compile_pattern<alg::kmp_search>(std::string_view{"needle"}, {}, lower);
+
+  for (int i = 0; i < 3; ++i) {
+    calls = 0;
+    EXPECT_EQ(naive.search(haystack, counting) - haystack.begin(), 4);
+    EXPECT_LE(calls, 2 * haystack.size());
+
+    calls = 0;
+    EXPECT_EQ(kmp.search(haystack, counting) - haystack.begin(), 4);
+    EXPECT_LE(calls, haystack.size());
+  }
+
+  // An explicit table calls it once per byte value, when built
+  calls             = 0;
+  auto const folded = dte3611::string_match::utils::makeByteTranslation<char>(counting);
+  EXPECT_EQ(calls, 256u);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(kmp.search(haystack, folded) - haystack.begin(), 4);
+    EXPECT_EQ(naive.search(haystack, folded) - haystack.begin(), 4);
+  }
+  EXPECT_EQ(calls, 256u);
+}
+
+TEST(MyByteFastPathTest, constantEvaluationTakesGenericPath)
+{
+  using namespace std::string_view_literals;
+
+  static_assert(alg::naive_search("abracadabra"sv, "cad"sv) - "abracadabra"sv.begin() == 4);
+  static_assert(alg::naive_search("abracadabra"sv, "cab"sv) == "abracadabra"sv.end());
+  static_assert(alg::kmp_search("abracadabra"sv, "abra"sv) - "abracadabra"sv.begin() == 0);
+  SUCCEED();
+}
@@ -0,0 +1,216 @@
+// Day3 string match library
+#include <lib3611/w1d3_string_match/compiled_pattern.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <cctype>
+#include <forward_list>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+
+struct MyCompiledPatternTestF : ::testing::Test {
+
+  using ::testing::Test::Test;
+  ~MyCompiledPatternTestF() override {}
+
+  std::vector<std::string> m_records;
+  std::vector<std::string> m_patterns;
+
+  void SetUp() final
+  {
+    // Small alphabet -> many partial matches and repeated prefixes
+    std::mt19937                    rng(3611);
+    std::uniform_int_distribution<> len_dist(0, 40);
+    std::uniform_int_distribution<> ch_dist('a', 'c');
+
+    auto random_string = [&](std::size_t len) {
+      std::string s(len, ' ');
+      for (auto& ch : s) ch = static_cast<char>(ch_dist(rng));
+      return s;
+    };
+
+    for (int i = 0; i < 200; ++i)
+      m_records.push_back(random_string(static_cast<std::size_t>(len_dist(rng))));
+
+    m_patterns = {"a", "ab", "abc", "aaa", "cab", "abcab", "bbbbbb"};
+  }
+  void TearDown() final
+  {
+    m_records.clear();
+    m_patterns.clear();
+  }
+
+  template <auto Engine_V>
+  void expectSameAsStdSearch() const
+  {
+    for (auto const& pattern : m_patterns) {
+      auto const compiled = alg::compile_pattern<Engine_V>(pattern);
+      EXPECT_EQ(compiled.size(), pattern.size());
+
+      for (auto const& record : m_records) {
+        auto const gold = std::search(record.begin(), record.end(),
+                                      pattern.begin(), pattern.end());
+        EXPECT_EQ(compiled.search(record), gold) << record << " / " << pattern;
+      }
+    }
+  }
+
+  template <auto Engine_V>
+  void expectForEachMatchFindsAll() const
+  {
+    for (auto const& pattern : m_patterns) {
+      auto const compiled = alg::compile_pattern<Engine_V>(pattern);
+
+      for (auto const& record : m_records) {
+        std::vector<std::size_t> gold;
+        for (auto pos = record.find(pattern); pos != std::string::npos;
+             pos = record.find(pattern, pos + 1))
+          gold.push_back(pos);
+
+        std::vector<std::size_t> found;
+        compiled.forEachMatch(record.begin(), record.end(), [&](auto it) {
+          found.push_back(static_cast<std::size_t>(it - record.begin()));
+        });
+        EXPECT_EQ(found, gold) << record << " / " << pattern;
+      }
+    }
+  }
+};
+
+
+TEST_F(MyCompiledPatternTestF, naiveMatchesStdSearch)
+{
+  expectSameAsStdSearch<alg::naive_search>();
+}
+
+TEST_F(MyCompiledPatternTestF, kmpMatchesStdSearch)
+{
+  expectSameAsStdSearch<alg::kmp_search>();
+}
+
+TEST_F(MyCompiledPatternTestF, bmhMatchesStdSearch)
+{
+  expectSameAsStdSearch<alg::bmh_search>();
+}
+
+TEST_F(MyCompiledPatternTestF, krMatchesStdSearch)
+{
+  expectSameAsStdSearch<alg::kr_search>();
+}
+
+TEST_F(MyCompiledPatternTestF, twoWayMatchesStdSearch)
+{
+  expectSameAsStdSearch<alg::two_way_search>();
+}
+
+
+TEST(MyCompiledPatternTest, emptyPatternMatchesAtBegin)
+{
+  std::string const haystack = "hello";
+  auto const        compiled = alg::compile_pattern<alg::bmh_search>(std::string{});
+
+  EXPECT_EQ(compiled.search(haystack), haystack.begin());
+}
+
+TEST(MyCompiledPatternTest, forwardIteratorHaystack)
+{
+  std::forward_list<char> const haystack{'x', 'a', 'b', 'a', 'b', 'c', 'y'};
+  std::string_view const        pattern = "abc";
+
+  auto const bmh = alg::compile_pattern<alg::bmh_search>(pattern);
+  auto const kr  = alg::compile_pattern<alg::kr_search>(pattern);
+
+  EXPECT_EQ(std::ranges::distance(haystack.begin(), bmh.search(haystack)), 3);
+  EXPECT_EQ(std::ranges::distance(haystack.begin(), kr.search(haystack)), 3);
+}
+
+TEST(MyCompiledPatternTest, caseFoldingProjection)
+{
+  auto const fold = [](char ch) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+  };
+
+  std::string const haystack = "Hello World !_!";
+  auto const compiled = alg::compile_pattern<alg::bmh_search>(
+    std::string_view{"WORLD"}, {}, fold);
+
+  EXPECT_EQ(compiled.search(haystack, fold) - haystack.begin(), 6);
+  EXPECT_EQ(compiled.search(haystack), haystack.end());
+}
+
+TEST(MyCompiledPatternTest, wildcardPredicate)
+{
+  // Non-equality predicate: '?' in the pattern matches any character
+  auto const wildcard = [](char h, char p) { return p == '?' || h == p; };
+
+  std::string const      haystack = "xxabcabd";
+  std::string_view const pattern  = "ab?";
+
+  auto const gold = std::search(haystack.begin(), haystack.end(),
+                                pattern.begin(), pattern.end(), wildcard);
+
+  EXPECT_EQ(alg::compile_pattern<alg::bmh_search>(pattern, wildcard)
+              .search(haystack),
+            gold);
+  EXPECT_EQ(alg::compile_pattern<alg::kr_search>(pattern, wildcard)
+              .search(haystack),
+            gold);
+  EXPECT_EQ(alg::bmh_search(haystack, pattern, wildcard), gold);
+  EXPECT_EQ(alg::kr_search(haystack, pattern, wildcard), gold);
+}
+
+
+TEST_F(MyCompiledPatternTestF, forEachMatchFindsAllOccurrences)
+{
+  expectForEachMatchFindsAll<alg::naive_search>();
+  expectForEachMatchFindsAll<alg::kmp_search>();
+  expectForEachMatchFindsAll<alg::bmh_search>();
+  expectForEachMatchFindsAll<alg::kr_search>();
+  expectForEachMatchFindsAll<alg::two_way_search>();
+}
+
+TEST(MyCompiledPatternTest, forEachMatchEmptyPattern)
+{
+  std::string const empty;
+  std::string const haystack = "abc";
+  auto const compiled = alg::compile_pattern<alg::kmp_search>(std::string{});
+
+  std::size_t hits = 0;
+  compiled.forEachMatch(empty.begin(), empty.end(), [&](auto) { ++hits; });
+  EXPECT_EQ(hits, 0u);
+  compiled.forEachMatch(haystack.begin(), haystack.end(), [&](auto) { ++hits; });
+  EXPECT_EQ(hits, 1u);
+}
+
+TEST(MyCompiledPatternTest, forEachMatchStaysLinearOnPeriodicText)
+{
+  // Every position of "aaa...a" matches; restarting after each hit would
+  // project O(n * m) haystack elements
+  std::string const haystack(4096, 'a');
+  std::string const pattern(64, 'a');
+
+  std::size_t projections = 0;
+  auto const  counting    = [&projections](char ch) {
+    ++projections;
+    return ch;
+  };
+
+  auto const expect_linear = [&](auto const& compiled) {
+    projections      = 0;
+    std::size_t hits = 0;
+    compiled.forEachMatch(haystack.begin(), haystack.end(),
+                          [&](auto) { ++hits; }, counting);
+    EXPECT_EQ(hits, haystack.size() - pattern.size() + 1);
+    EXPECT_LE(projections, 2 * (haystack.size() + pattern.size()));
+  };
+
+  expect_linear(alg::compile_pattern<alg::kmp_search>(pattern));
+  expect_linear(alg::compile_pattern<alg::two_way_search>(pattern));
+}
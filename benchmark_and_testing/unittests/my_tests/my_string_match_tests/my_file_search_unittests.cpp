@@ -0,0 +1,155 @@
+// Day3 string match library
+#include <lib3611/w1d3_string_match/file_search.h>
+#include <lib3611/w1d3_string_match/kr_prefix_hash.h>
+#include <lib3611/w1d3_string_match/parallel_search.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// posix
+#include <unistd.h>
+
+namespace alg = dte3611::string_match::algorithms;
+namespace utl = dte3611::utils;
+namespace fs  = std::filesystem;
+
+namespace
+{
+  // Scratch file removed again when the test ends
+  struct TempFile {
+    explicit TempFile(std::string const& content)
+      : m_path{fs::temp_directory_path()
+               / ("dte3611_file_search_" + std::to_string(::getpid()) + "_"
+                  + std::to_string(s_counter++))}
+    {
+      std::ofstream(m_path, std::ios::binary) << content;
+    }
+    ~TempFile() { fs::remove(m_path); }
+
+    fs::path const& path() const { return m_path; }
+
+    static inline int s_counter = 0;
+    fs::path          m_path;
+  };
+}   // namespace
+
+
+TEST(MyFileSearchTest, mappedFileIsAContiguousRange)
+{
+  std::string const content = "the quick brown fox";
+  TempFile const    file(content);
+
+  utl::MappedFile mapped(file.path());
+  EXPECT_EQ(mapped.size(), content.size());
+  EXPECT_EQ(mapped.view(), content);
+
+  // Any engine runs straight over the mapping
+  auto const it = alg::kmp_search(mapped, std::string{"brown"});
+  EXPECT_EQ(it - mapped.begin(), 10);
+
+  utl::MappedFile moved = std::move(mapped);
+  EXPECT_EQ(moved.view(), content);
+  EXPECT_TRUE(mapped.empty());
+}
+
+TEST(MyFileSearchTest, firstMatchOffsetForEveryEngine)
+{
+  std::string content(200'000, 'a');
+  content.replace(123'456, 6, "needle");
+  TempFile const file(content);
+
+  std::string const pattern = "needle";
+  EXPECT_EQ(alg::file_search<alg::naive_search>(file.path(), pattern), 123'456u);
+  EXPECT_EQ(alg::file_search<alg::kmp_search>(file.path(), pattern), 123'456u);
+  EXPECT_EQ(alg::file_search<alg::bmh_search>(file.path(), pattern), 123'456u);
+  EXPECT_EQ(alg::file_search<alg::kr_search>(file.path(), pattern), 123'456u);
+  EXPECT_EQ(alg::file_search<>(file.path(), std::string{"haystack"}), std::nullopt);
+
+  utl::MapHints const hints{.sequential = true, .huge_pages = true, .populate = true};
+  EXPECT_EQ(alg::file_search<>(file.path(), hints, pattern), 123'456u);
+}
+
+TEST(MyFileSearchTest, findAllSinkSeesEveryMatch)
+{
+  std::string const content = "abababa-aba";
+  TempFile const    file(content);
+
+  std::vector<std::size_t> offsets;
+  auto const count = alg::file_search_all<alg::kmp_search>(
+    file.path(), std::string{"aba"},
+    [&offsets](std::size_t offset) { offsets.push_back(offset); });
+
+  std::vector<std::size_t> const gold{0, 2, 4, 8};
+  EXPECT_EQ(count, gold.size());
+  EXPECT_EQ(offsets, gold);
+}
+
+TEST(MyFileSearchTest, emptyAndMissingFiles)
+{
+  TempFile const empty("");
+
+  utl::MappedFile const mapped(empty.path());
+  EXPECT_TRUE(mapped.empty());
+  EXPECT_EQ(alg::file_search<>(empty.path(), std::string{"x"}), std::nullopt);
+  EXPECT_EQ(alg::file_search_all<>(empty.path(), std::string{"x"},
+                                   [](std::size_t) {}),
+            0u);
+
+  EXPECT_THROW(alg::file_search<>(fs::path{"/nonexistent/dte3611"}, std::string{"x"}),
+               std::system_error);
+}
+
+TEST(MyFileSearchTest, emptyPatternAgreesAcrossFileSearches)
+{
+  std::vector<std::size_t> offsets;
+  auto const sink = [&offsets](std::size_t at) { offsets.push_back(at); };
+
+  TempFile const empty("");
+  EXPECT_EQ(alg::file_search<>(empty.path(), std::string{}), std::nullopt);
+  EXPECT_EQ(alg::file_search_all<>(empty.path(), std::string{}, sink), 0u);
+  EXPECT_TRUE(offsets.empty());
+
+  TempFile const text("abc");
+  EXPECT_EQ(alg::file_search<>(text.path(), std::string{}), std::optional<std::size_t>{0});
+  EXPECT_EQ(alg::file_search_all<>(text.path(), std::string{}, sink), 1u);
+  EXPECT_EQ(offsets, std::vector<std::size_t>{0});
+}
+
+TEST(MyFileSearchTest, emptyPatternAgreesAcrossFrontEnds)
+{
+  // One rule everywhere: a single match at offset 0, none in an empty text
+  utl::ThreadPool pool(2);
+  std::string const none;
+
+  for (std::string const content : {"", "abc"}) {
+    std::vector<std::size_t> const gold
+      = content.empty() ? std::vector<std::size_t>{} : std::vector<std::size_t>{0};
+
+    TempFile const           file(content);
+    std::vector<std::size_t> from_file;
+    alg::file_search_all<>(file.path(), none,
+                           [&from_file](std::size_t at) { from_file.push_back(at); });
+    EXPECT_EQ(from_file, gold) << '"' << content << '"';
+
+    std::vector<std::size_t> from_parallel;
+    for (auto const it : alg::parallel_search_all<>(pool, content, none))
+      from_parallel.push_back(static_cast<std::size_t>(it - content.begin()));
+    EXPECT_EQ(from_parallel, gold) << '"' << content << '"';
+
+    EXPECT_EQ(alg::kr_prefix_hashes(pool, content).findAll(none), gold)
+      << '"' << content << '"';
+
+    // The single-match front-ends agree: first, i.e. last when empty
+    EXPECT_EQ(alg::parallel_search<>(pool, content, none), content.begin());
+    EXPECT_EQ(alg::file_search<>(file.path(), none).has_value(), not content.empty());
+  }
+}
@@ -0,0 +1,152 @@
+// Day3 string match library
+#include <lib3611/w1d3_string_match/kr_prefix_hash.h>
+#include <lib3611/w1d3_string_match/parallel_search.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+namespace utl = dte3611::utils;
+
+namespace
+{
+  std::string randomText(std::size_t n, char hi)
+  {
+    std::mt19937                    rng(3611);
+    std::uniform_int_distribution<> ch_dist('a', hi);
+
+    std::string s(n, ' ');
+    for (auto& ch : s) ch = static_cast<char>(ch_dist(rng));
+    return s;
+  }
+
+  // Every (overlapping) occurrence offset
+  std::vector<std::size_t> serialAll(std::string const& text,
+                                     std::string const& pattern)
+  {
+    std::vector<std::size_t> hits;
+    for (auto it = text.begin();; ++it) {
+      it = std::search(it, text.end(), pattern.begin(), pattern.end());
+      if (it == text.end()) break;
+      hits.push_back(static_cast<std::size_t>(it - text.begin()));
+    }
+    return hits;
+  }
+}   // namespace
+
+
+TEST(MyKrPrefixHashTest, windowHashesEqualKarpRabinPatternHashes)
+{
+  std::string const       text = randomText(500, 'z');
+  alg::kr_prefix_hashes const table(text);
+
+  ASSERT_EQ(table.size(), text.size());
+  EXPECT_EQ(table.prefix(0), 0u);
+  for (std::size_t m : {1u, 2u, 7u, 64u})
+    for (std::size_t pos = 0; pos + m <= text.size(); pos += 13) {
+      auto const window = text.substr(pos, m);
+      alg::detail::kr_matcher<char> const matcher(window.begin(), window.end());
+      ASSERT_EQ(table.windowHash(pos, m), matcher.hash()) << pos << ' ' << m;
+    }
+}
+
+TEST(MyKrPrefixHashTest, segmentedBuildMatchesSerialBuild)
+{
+  // Several segments per thread; the single-thread pool builds it in one
+  std::string const text = randomText((std::size_t{1} << 20) + 12345, 'd');
+
+  utl::ThreadPool             pool(3);
+  utl::ThreadPool             single(1);
+  alg::kr_prefix_hashes const parallel(pool, text);
+  alg::kr_prefix_hashes const serial(single, text.begin(), text.size());
+
+  std::uint64_t h = 0;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    h = h * decltype(parallel)::base
+        + dte3611::string_match::utils::detail::keyHash<char>(text[i]);
+    ASSERT_EQ(parallel.prefix(i + 1), h) << i;
+    ASSERT_EQ(serial.prefix(i + 1), h) << i;
+  }
+}
+
+TEST(MyKrPrefixHashTest, findAllAnswersManyQueriesFromOneTable)
+{
+  utl::ThreadPool             pool(4);
+  std::string const           text = randomText(std::size_t{1} << 18, 'c');
+  alg::kr_prefix_hashes const table(pool, text);
+
+  std::mt19937                    rng(42);
+  std::uniform_int_distribution<> len_dist(1, 12);
+  std::uniform_int_distribution<std::size_t> pos_dist(0, text.size() - 12);
+  for (int q = 0; q < 50; ++q) {
+    auto const pattern = text.substr(pos_dist(rng), static_cast<std::size_t>(len_dist(rng)));
+    ASSERT_EQ(table.findAll(pattern), serialAll(text, pattern)) << pattern;
+  }
+
+  EXPECT_TRUE(table.findAll(std::string(text.size() + 1, 'a')).empty());
+  EXPECT_EQ(table.windowHashes(text.size()).size(), 1u);
+}
+
+TEST(MyKrPrefixHashTest, emptyPatternMatchesOnceInNonEmptyText)
+{
+  utl::ThreadPool pool(2);
+  std::string const text = "abcabc";
+  std::vector<char> const none;
+
+  // The parallel_search_all convention: one match at the start
+  auto const gold = alg::parallel_search_all<>(pool, text, none);
+  ASSERT_EQ(gold.size(), 1u);
+  EXPECT_EQ(gold.front(), text.begin());
+
+  std::string const           empty;
+  alg::kr_prefix_hashes const table(pool, text);
+  alg::kr_prefix_hashes const empty_table(pool, empty);
+  EXPECT_EQ(table.findAll(none), std::vector<std::size_t>{0});
+  EXPECT_TRUE(empty_table.findAll(none).empty());
+}
+
+TEST(MyKrPrefixHashTest, findAllOfMatchesEveryPatternInOnePass)
+{
+  utl::ThreadPool             pool(4);
+  std::string const           text = randomText(std::size_t{1} << 18, 'c');
+  alg::kr_prefix_hashes const table(pool, text);
+
+  std::vector<std::string> patterns{"abcab", "ccccc", "aaaaa", "abcab"};
+  for (std::size_t pos = 1000; pos < text.size(); pos += 50'000)
+    patterns.push_back(text.substr(pos, 5));
+
+  std::vector<alg::aho_corasick_match> gold;
+  for (std::size_t offset = 0; offset + 5 <= text.size(); ++offset)
+    for (std::size_t id = 0; id < patterns.size(); ++id)
+      if (text.compare(offset, 5, patterns[id]) == 0) gold.push_back({id, offset});
+
+  EXPECT_EQ(table.findAllOf(patterns), gold);
+  EXPECT_TRUE(table.findAllOf(std::vector<std::string>{}).empty());
+  EXPECT_THROW(table.findAllOf(std::vector<std::string>{"ab", "abc"}),
+               std::invalid_argument);
+}
+
+TEST(MyKrPrefixHashTest, projectionsApplyToTextAndPattern)
+{
+  auto const lower = [](char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  };
+  std::string const           text = "Sea SHELLS sea shells";
+  alg::kr_prefix_hashes const table(text, lower);
+
+  EXPECT_EQ(table.findAll(std::string{"SEA"}, lower), (std::vector<std::size_t>{0, 11}));
+  EXPECT_EQ(table.findAll(std::string{"shells"}), (std::vector<std::size_t>{4, 15}));
+
+  // Duplicate windows hash alike
+  auto const hashes = table.windowHashes(6);
+  EXPECT_EQ(hashes[4], hashes[15]);
+}
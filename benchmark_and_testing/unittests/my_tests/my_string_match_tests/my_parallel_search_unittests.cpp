@@ -0,0 +1,116 @@
+// Day3 string match library
+#include <lib3611/w1d3_string_match/parallel_search.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+namespace utl = dte3611::utils;
+
+namespace
+{
+  // Large enough to be split into many chunks
+  std::string makeHaystack(std::size_t n, std::string const& pattern,
+                           std::size_t stride)
+  {
+    std::mt19937                    rng(3611);
+    std::uniform_int_distribution<> ch_dist('a', 'c');
+
+    std::string s(n, ' ');
+    for (auto& ch : s) ch = static_cast<char>(ch_dist(rng));
+    for (std::size_t pos = stride; pos + pattern.size() <= n; pos += stride)
+      std::ranges::copy(pattern, s.begin() + static_cast<std::ptrdiff_t>(pos));
+    std::ranges::copy(pattern, s.end() - static_cast<std::ptrdiff_t>(pattern.size()));
+    return s;
+  }
+
+  // Serial gold -- every (overlapping) occurrence
+  std::vector<std::string::const_iterator> serialAll(std::string const& haystack,
+                                                     std::string const& pattern)
+  {
+    std::vector<std::string::const_iterator> hits;
+    for (auto it = haystack.begin();; ++it) {
+      it = std::search(it, haystack.end(), pattern.begin(), pattern.end());
+      if (it == haystack.end()) break;
+      hits.push_back(it);
+    }
+    return hits;
+  }
+}   // namespace
+
+
+TEST(MyParallelSearchTest, findAllMatchesSerialForEveryEngine)
+{
+  utl::ThreadPool   pool(4);
+  std::string const pattern  = "dcdcd";   // self-overlapping
+  std::string const haystack = makeHaystack(std::size_t{1} << 20, pattern, 997);
+  auto const        gold     = serialAll(haystack, pattern);
+
+  EXPECT_EQ(alg::parallel_search_all<alg::naive_search>(pool, haystack, pattern), gold);
+  EXPECT_EQ(alg::parallel_search_all<alg::kmp_search>(pool, haystack, pattern), gold);
+  EXPECT_EQ(alg::parallel_search_all<alg::bmh_search>(pool, haystack, pattern), gold);
+  EXPECT_EQ(alg::parallel_search_all<alg::kr_search>(pool, haystack, pattern), gold);
+}
+
+TEST(MyParallelSearchTest, matchesStraddlingChunkBorders)
+{
+  // A match at every offset -- every chunk border is crossed by one
+  utl::ThreadPool   pool(3);
+  std::string const haystack(std::size_t{1} << 19, 'a');
+  std::string const pattern(100, 'a');
+
+  auto const hits = alg::parallel_search_all<alg::bmh_search>(pool, haystack, pattern);
+  ASSERT_EQ(hits.size(), haystack.size() - pattern.size() + 1);
+  for (std::size_t i = 0; i < hits.size(); ++i)
+    ASSERT_EQ(hits[i], haystack.begin() + static_cast<std::ptrdiff_t>(i));
+}
+
+TEST(MyParallelSearchTest, firstMatchIsLeftmost)
+{
+  utl::ThreadPool   pool(4);
+  std::string const pattern  = "dddd";
+  std::string const haystack = makeHaystack(std::size_t{1} << 20, pattern, 300'001);
+
+  EXPECT_EQ(alg::parallel_search<alg::bmh_search>(pool, haystack, pattern),
+            std::ranges::search(haystack, pattern).begin());
+
+  // Only match in the final chunk
+  std::string tail_only(std::size_t{1} << 20, 'a');
+  tail_only.back() = 'z';
+  EXPECT_EQ(alg::parallel_search<>(pool, tail_only, std::string{"az"}),
+            tail_only.end() - 2);
+  EXPECT_EQ(alg::parallel_search<>(pool, tail_only, std::string{"za"}),
+            tail_only.end());
+}
+
+TEST(MyParallelSearchTest, degenerateInputs)
+{
+  std::string const haystack = "abcabc";
+
+  EXPECT_EQ(alg::parallel_search<>(haystack, std::string{}), haystack.begin());
+  EXPECT_EQ(alg::parallel_search<>(haystack, std::string{"abcabcd"}), haystack.end());
+  EXPECT_EQ(alg::parallel_search<>(haystack, std::string{"ca"}), haystack.begin() + 2);
+  EXPECT_TRUE(alg::parallel_search_all<>(std::string{}, std::string{"a"}).empty());
+  EXPECT_EQ(alg::parallel_search_all<>(haystack, std::string{"abc"}).size(), 2u);
+}
+
+TEST(MyParallelSearchTest, projectionsAreHonoured)
+{
+  auto const fold = [](char ch) {
+    return static_cast<char>(ch >= 'A' && ch <= 'Z' ? ch - 'A' + 'a' : ch);
+  };
+
+  utl::ThreadPool pool(2);
+  std::string     haystack(std::size_t{1} << 18, 'x');
+  haystack.replace(200'000, 5, "NeEdL");
+
+  auto const hit = alg::parallel_search<alg::kr_search>(
+    pool, haystack, std::string{"nEEDl"}, std::ranges::equal_to{}, fold, fold);
+  EXPECT_EQ(hit, haystack.begin() + 200'000);
+}
@@ -0,0 +1,140 @@
+// Day3 string match library
+#include <lib3611/w1d3_string_match/search.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <forward_list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+
+namespace
+{
+
+  // Every (offset, pattern_id) by brute force, in the documented order
+  std::vector<alg::aho_corasick_match>
+  goldDictionary(std::string const& text, std::vector<std::string> const& patterns)
+  {
+    std::vector<alg::aho_corasick_match> hits;
+    for (std::size_t offset = 0; offset < text.size(); ++offset)
+      for (std::size_t id = 0; id < patterns.size(); ++id)
+        if (not patterns[id].empty()
+            and text.compare(offset, patterns[id].size(), patterns[id]) == 0)
+          hits.push_back({id, offset});
+    return hits;
+  }
+
+}   // namespace
+
+TEST(MySearchTest, engineChoiceFollowsThresholds)
+{
+  std::string const text(100, 'a');
+
+  EXPECT_EQ(alg::search.engine(text, std::string(4, 'a')), alg::search_engine::naive);
+  EXPECT_EQ(alg::search.engine(text, std::string(16, 'a')), alg::search_engine::bmh);
+
+  // Small alphabets move the BMH crossover down
+  alg::search_hints const dna{.alphabet_size = 4};
+  EXPECT_EQ(alg::search.engine(dna, text, std::string(2, 'a')), alg::search_engine::naive);
+  EXPECT_EQ(alg::search.engine(dna, text, std::string(4, 'a')), alg::search_engine::bmh);
+
+  // Forward-only haystacks never skip
+  std::forward_list<char> const stream(text.begin(), text.end());
+  EXPECT_EQ(alg::search.engine(stream, std::string(64, 'a')), alg::search_engine::kmp);
+
+  // Non-equality predicates only trust the naive scan
+  auto const caseless = [](char a, char b) {
+    return std::tolower(static_cast<unsigned char>(a))
+           == std::tolower(static_cast<unsigned char>(b));
+  };
+  EXPECT_EQ(alg::search.engine(text, std::string(64, 'a'), caseless),
+            alg::search_engine::naive);
+
+  // Wide keys: KR on small alphabets, BMH only for long patterns
+  std::vector<std::uint32_t> const wide(100, 1);
+  EXPECT_EQ(alg::search.engine(wide, std::vector<std::uint32_t>(16, 1)),
+            alg::search_engine::naive);
+  EXPECT_EQ(alg::search.engine(wide, std::vector<std::uint32_t>(32, 1)),
+            alg::search_engine::bmh);
+  EXPECT_EQ(alg::search.engine(dna, wide, std::vector<std::uint32_t>(32, 1)),
+            alg::search_engine::kr);
+
+  EXPECT_EQ(alg::engineName(alg::search_engine::aho_corasick), "aho_corasick");
+}
+
+TEST(MySearchTest, everyChoiceMatchesStdSearch)
+{
+  std::mt19937                    rng(3611);
+  std::uniform_int_distribution<> len_dist(1, 40);
+  std::uniform_int_distribution<> ch_dist('a', 'c');
+
+  auto random_string = [&](std::size_t len) {
+    std::string s(len, ' ');
+    for (auto& ch : s) ch = static_cast<char>(ch_dist(rng));
+    return s;
+  };
+
+  for (int i = 0; i < 500; ++i) {
+    auto const haystack = random_string(200);
+    auto const pattern  = random_string(static_cast<std::size_t>(len_dist(rng)));
+    auto const gold     = std::search(haystack.begin(), haystack.end(),
+                                      pattern.begin(), pattern.end());
+
+    ASSERT_EQ(alg::search(haystack, pattern), gold) << pattern;
+    ASSERT_EQ(alg::search(alg::search_hints{.alphabet_size = 3}, haystack, pattern), gold);
+
+    std::forward_list<char> const stream(haystack.begin(), haystack.end());
+    ASSERT_EQ(std::distance(stream.begin(), alg::search(stream, pattern)),
+              gold - haystack.begin());
+
+    std::vector<int> const wide(haystack.begin(), haystack.end());
+    std::vector<int> const wide_pattern(pattern.begin(), pattern.end());
+    ASSERT_EQ(alg::search(alg::search_hints{.alphabet_size = 3}, wide, wide_pattern)
+                - wide.begin(),
+              gold - haystack.begin());
+    ASSERT_EQ(alg::search(wide, wide_pattern) - wide.begin(), gold - haystack.begin());
+  }
+}
+
+TEST(MySearchTest, multiSearchPicksKarpRabinForEqualLengths)
+{
+  std::string const              text = "she sells sea shells by the sea shore";
+  std::vector<std::string> const same{"sea", "she", "ell", "sea"};
+  std::vector<std::string> const mixed{"he", "she", "hers", "sells", "s"};
+
+  EXPECT_EQ(alg::multi_search.engine(same), alg::search_engine::kr);
+  EXPECT_EQ(alg::multi_search.engine(mixed), alg::search_engine::aho_corasick);
+
+  EXPECT_EQ(alg::multi_search(text, same), goldDictionary(text, same));
+  EXPECT_EQ(alg::multi_search(text, mixed), goldDictionary(text, mixed));
+}
+
+TEST(MySearchTest, multiSearchProjectsBothSides)
+{
+  auto const lower = [](char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  };
+  std::string const              text = "Sea SHELLS";
+  std::vector<std::string> const patterns{"SEA", "ell"};
+
+  EXPECT_EQ(alg::multi_search(text, patterns, lower, lower),
+            (std::vector<alg::aho_corasick_match>{{0, 0}, {1, 6}}));
+}
+
+TEST(MySearchTest, karpRabinSetRejectsMixedLengths)
+{
+  std::vector<std::string> const mixed{"ab", "abc"};
+  EXPECT_THROW(alg::detail::kr_set_matcher<char>(mixed.begin(), mixed.end()),
+               std::invalid_argument);
+
+  std::vector<std::string> const none;
+  EXPECT_TRUE(alg::multi_search(std::string{"abc"}, none).empty());
+}
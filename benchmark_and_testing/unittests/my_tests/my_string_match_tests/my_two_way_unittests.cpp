@@ -0,0 +1,96 @@
+// Day3 string match library
+#include <lib3611/w1d3_string_match/two_way_search.h>
+#include <lib3611/w1d3_string_match/compiled_pattern.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace alg = dte3611::string_match::algorithms;
+
+TEST(MyTwoWayTest, randomSmallAlphabetMatchesStdSearch)
+{
+  // Binary/ternary alphabets hit both the periodic and the non-periodic case
+  std::mt19937                    rng(3611);
+  std::uniform_int_distribution<> len_dist(1, 12);
+
+  for (char const top : {'b', 'c'}) {
+    std::uniform_int_distribution<> ch_dist('a', top);
+    auto random_string = [&](std::size_t len) {
+      std::string s(len, ' ');
+      for (auto& ch : s) ch = static_cast<char>(ch_dist(rng));
+      return s;
+    };
+
+    for (int i = 0; i < 2000; ++i) {
+      auto const haystack = random_string(static_cast<std::size_t>(len_dist(rng)) * 8);
+      auto const pattern  = random_string(static_cast<std::size_t>(len_dist(rng)));
+
+      auto const gold = std::search(haystack.begin(), haystack.end(),
+                                    pattern.begin(), pattern.end());
+      ASSERT_EQ(alg::two_way_search(haystack, pattern), gold)
+        << haystack << " / " << pattern;
+    }
+  }
+}
+
+TEST(MyTwoWayTest, periodicAndAdversarialPatterns)
+{
+  std::string const haystack = std::string(1000, 'a') + "b" + std::string(10, 'a');
+
+  std::vector<std::string> const patterns{
+    "ab", "aab", std::string(50, 'a') + "b", "ba", "abaa", "aaaaaaaaaaa",
+    std::string(12, 'a'), "aba"};
+
+  for (auto const& pattern : patterns) {
+    auto const gold = std::search(haystack.begin(), haystack.end(),
+                                  pattern.begin(), pattern.end());
+    EXPECT_EQ(alg::two_way_search(haystack, pattern), gold) << pattern;
+  }
+}
+
+TEST(MyTwoWayTest, emptyAndOversizedPatterns)
+{
+  std::string const haystack = "abc";
+
+  EXPECT_EQ(alg::two_way_search(haystack, std::string{}), haystack.begin());
+  EXPECT_EQ(alg::two_way_search(haystack, std::string{"abcd"}), haystack.end());
+  std::string const empty;
+  EXPECT_EQ(alg::two_way_search(empty, std::string{"a"}), empty.end());
+}
+
+TEST(MyTwoWayTest, nonCharKeysAndProjections)
+{
+  std::vector<int> const haystack{5, 3, 5, 3, 5, 4, 5, 3, 5, 3, 5, 3, 9};
+  std::vector<int> const pattern{5, 3, 5, 3, 9};
+  EXPECT_EQ(alg::two_way_search(haystack, pattern) - haystack.begin(), 8);
+
+  auto const fold = [](char ch) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+  };
+  std::string const haystack_s = "Hello World";
+  EXPECT_EQ(alg::two_way_search(haystack_s, std::string_view{"WORLD"}, {}, fold, fold)
+              - haystack_s.begin(),
+            6);
+}
+
+TEST(MyTwoWayTest, compiledAndConstexpr)
+{
+  auto const compiled = alg::compile_pattern<alg::two_way_search>(std::string_view{"abab"});
+  std::string const haystack = "aabaabababb";
+  EXPECT_EQ(compiled.search(haystack) - haystack.begin(), 4);
+
+  static_assert([] {
+    constexpr std::array<char, 7> text{'x', 'a', 'b', 'a', 'b', 'c', 'y'};
+    constexpr std::array<char, 3> pat{'a', 'b', 'c'};
+    return alg::two_way_search(text, pat) - text.begin();
+  }() == 3);
+}
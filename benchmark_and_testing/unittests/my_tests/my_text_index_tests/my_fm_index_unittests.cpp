@@ -0,0 +1,176 @@
+// Day3 text index library
+#include <lib3611/w1d3_text_index/fm_index.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// posix
+#include <unistd.h>
+
+namespace txt = dte3611::text_index;
+
+namespace
+{
+  std::string randomString(std::mt19937& rng, std::size_t len, std::string_view alphabet)
+  {
+    std::uniform_int_distribution<std::size_t> dist(0, alphabet.size() - 1);
+    std::string                                s(len, ' ');
+    for (auto& ch : s) ch = alphabet[dist(rng)];
+    return s;
+  }
+
+  std::vector<std::size_t> naiveLocate(std::string_view text, std::string_view pattern)
+  {
+    std::vector<std::size_t> hits;
+    for (std::size_t i = 0; i + pattern.size() <= text.size(); ++i)
+      if (text.substr(i, pattern.size()) == pattern) hits.push_back(i);
+    return hits;
+  }
+
+  std::vector<std::size_t> sorted(std::vector<std::size_t> v)
+  {
+    std::ranges::sort(v);
+    return v;
+  }
+}   // namespace
+
+
+TEST(MyFmIndexTest, mississippi)
+{
+  txt::fm_index const index(std::string_view{"mississippi"}, std::identity{}, 4);
+
+  EXPECT_EQ(index.size(), 11u);
+  EXPECT_EQ(index.count(std::string_view{"ssi"}), 2u);
+  EXPECT_EQ(index.count(std::string_view{"i"}), 4u);
+  EXPECT_EQ(index.count(std::string_view{"pix"}), 0u);
+  EXPECT_EQ(index.count(std::string_view{"x"}), 0u);
+  EXPECT_EQ(sorted(index.locate(std::string_view{"issi"})),
+            (std::vector<std::size_t>{1, 4}));
+  EXPECT_EQ(sorted(index.locate(std::string_view{""})).size(), 11u);
+}
+
+TEST(MyFmIndexTest, randomTextsMatchBruteForce)
+{
+  std::mt19937 rng(3611);
+
+  // Alphabet sizes 2, 4 and 5 give 2- and 3-level wavelet matrices; the
+  // high byte checks signed chars
+  for (std::string_view const alphabet : {"ab", "ACGT", "xyz\xf0\x7f"}) {
+    for (std::size_t const rate : {1u, 3u, 32u}) {
+      for (int i = 0; i < 30; ++i) {
+        auto const text = randomString(rng, static_cast<std::size_t>(i * 37 + 1), alphabet);
+        txt::fm_index const index(text, std::identity{}, rate);
+
+        for (int q = 0; q < 20; ++q) {
+          auto const pattern
+            = randomString(rng, static_cast<std::size_t>(q % 5 + 1), alphabet);
+          auto const gold = naiveLocate(text, pattern);
+
+          ASSERT_EQ(index.count(pattern), gold.size()) << text << " / " << pattern;
+          ASSERT_EQ(sorted(index.locate(pattern)), gold) << text << " / " << pattern;
+        }
+      }
+    }
+  }
+}
+
+TEST(MyFmIndexTest, projectionsAndEmptyText)
+{
+  auto const fold = [](char ch) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+  };
+
+  txt::fm_index const index(std::string_view{"Hello hELLo"}, fold);
+  EXPECT_EQ(index.count(std::string_view{"HELLO"}, fold), 2u);
+  EXPECT_EQ(index.count(std::string_view{"HELLO"}), 0u);
+
+  txt::fm_index const empty(std::string_view{});
+  EXPECT_EQ(empty.count(std::string_view{"a"}), 0u);
+  EXPECT_EQ(empty.count(std::string_view{}), 0u);
+  EXPECT_TRUE(empty.locate(std::string_view{"a"}).empty());
+
+  txt::fm_index const defaulted;
+  EXPECT_EQ(defaulted.count(std::string_view{"a"}), 0u);
+}
+
+TEST(MyFmIndexTest, compressedSpace)
+{
+  // DNA: 3 wavelet levels (4 bases + sentinel), well under a byte per base
+  std::mt19937        rng(42);
+  auto const          text = randomString(rng, std::size_t{1} << 20, "ACGT");
+  txt::fm_index const index(text);
+
+  EXPECT_LT(index.byteSize(), text.size() * 3 / 4);
+}
+
+TEST(MyFmIndexTest, saveAndMapRoundTrip)
+{
+  std::mt19937 rng(7);
+  auto const   text = randomString(rng, 50'000, "ACGT");
+  auto const   path = std::filesystem::temp_directory_path()
+                    / ("dte3611_fm_" + std::to_string(::getpid()) + ".idx");
+
+  txt::fm_index const index(text, std::identity{}, 16);
+  index.save(path);
+
+  {
+    auto const mapped = txt::fm_index::load(path);
+    EXPECT_EQ(mapped.size(), index.size());
+    EXPECT_EQ(mapped.byteSize(), index.byteSize());
+    EXPECT_EQ(mapped.sampleRate(), 16u);
+
+    for (std::string_view const pattern : {"ACGTA", "TTT", "GATTACA"}) {
+      EXPECT_EQ(mapped.count(pattern), index.count(pattern));
+      EXPECT_EQ(sorted(mapped.locate(pattern)), sorted(index.locate(pattern)));
+    }
+
+    // Copies share the mapping
+    auto const copy = mapped;
+    EXPECT_EQ(copy.count(std::string_view{"AC"}), index.count(std::string_view{"AC"}));
+  }
+
+  // Anything else is rejected
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << "not an index....";
+  EXPECT_THROW(txt::fm_index::load(path), std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST(MyFmIndexTest, loadRejectsInconsistentImage)
+{
+  txt::fm_index const index(std::string_view{"GATTACA"});
+  auto const path = std::filesystem::temp_directory_path()
+                    / ("dte3611_fm_corrupt_" + std::to_string(::getpid()) + ".idx");
+  index.save(path);
+
+  std::string saved;
+  {
+    std::ifstream in(path, std::ios::binary);
+    saved.assign(std::istreambuf_iterator<char>(in), {});
+  }
+
+  // Image words: header[8], code[256], C[sigma + 1], ...
+  auto const expect_rejected = [&](std::size_t word, std::uint64_t value) {
+    auto corrupt = saved;
+    corrupt.replace(word * 8, 8, reinterpret_cast<char const*>(&value), 8);
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << corrupt;
+    EXPECT_THROW(txt::fm_index::load(path), std::runtime_error) << word;
+  };
+
+  expect_rejected(3, 64);            // sigma beyond 1 << levels
+  expect_rejected(8 + 'A', 5);       // code past sigma
+  expect_rejected(8 + 256, 1);       // C[0] != 0
+  expect_rejected(8 + 256 + 2, 0);   // C not sorted
+
+  std::filesystem::remove(path);
+}
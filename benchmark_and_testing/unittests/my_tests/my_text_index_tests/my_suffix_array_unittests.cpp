@@ -0,0 +1,210 @@
+// Day3 text index library
+#include <lib3611/w1d3_text_index/suffix_array.h>
+
+// gtest
+#include <gtest/gtest.h>   // googletest header file
+
+// stl
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// posix
+#include <unistd.h>
+
+namespace txt = dte3611::text_index;
+
+namespace
+{
+  // Symbols in [lo, hi] as unsigned byte values
+  std::string randomString(std::mt19937& rng, std::size_t len, int lo, int hi)
+  {
+    std::uniform_int_distribution<> ch_dist(lo, hi);
+    std::string                     s(len, ' ');
+    for (auto& ch : s) ch = static_cast<char>(ch_dist(rng));
+    return s;
+  }
+
+  // Brute force gold -- sort the suffixes, compare in unsigned byte order
+  template <typename Text_T>
+  std::vector<std::uint32_t> naiveSuffixArray(Text_T const& text)
+  {
+    std::vector<std::uint32_t> sa(text.size());
+    std::iota(sa.begin(), sa.end(), 0u);
+    std::ranges::sort(sa, [&text](std::uint32_t a, std::uint32_t b) {
+      return std::lexicographical_compare(
+        text.begin() + a, text.end(), text.begin() + b, text.end(),
+        [](auto x, auto y) {
+          if constexpr (sizeof(x) == 1)
+            return static_cast<unsigned char>(x) < static_cast<unsigned char>(y);
+          else
+            return x < y;
+        });
+    });
+    return sa;
+  }
+
+  std::vector<std::size_t> naiveLocate(std::string_view text, std::string_view pattern)
+  {
+    std::vector<std::size_t> hits;
+    for (std::size_t i = 0; i + pattern.size() <= text.size(); ++i)
+      if (text.substr(i, pattern.size()) == pattern) hits.push_back(i);
+    return hits;
+  }
+}   // namespace
+
+
+TEST(MySuffixArrayTest, banana)
+{
+  txt::suffix_array_index const index(std::string_view{"banana"});
+
+  std::vector<std::uint32_t> const sa{5, 3, 1, 0, 4, 2};
+  std::vector<std::uint32_t> const lcp{0, 1, 3, 0, 0, 2};
+  EXPECT_TRUE(std::ranges::equal(index.suffixArray(), sa));
+  EXPECT_TRUE(std::ranges::equal(index.lcp(), lcp));
+
+  EXPECT_EQ(index.count(std::string_view{"ana"}), 2u);
+  EXPECT_EQ(index.count(std::string_view{"nab"}), 0u);
+  EXPECT_EQ(index.count(std::string_view{""}), 6u);
+
+  auto hits = index.locate(std::string_view{"an"});
+  std::ranges::sort(hits);
+  EXPECT_EQ(hits, (std::vector<std::size_t>{1, 3}));
+}
+
+TEST(MySuffixArrayTest, randomTextsMatchBruteForce)
+{
+  std::mt19937 rng(3611);
+
+  // Tiny alphabets stress the recursion; high bytes check unsigned order
+  std::vector<std::pair<int, int>> const alphabets{{'a', 'b'}, {'a', 'd'}, {0x7e, 0x81}};
+  for (auto const& [lo, hi] : alphabets) {
+    for (int i = 0; i < 100; ++i) {
+      auto const text = randomString(rng, static_cast<std::size_t>(i * 7 + 1), lo, hi);
+      txt::suffix_array_index const index(text);
+
+      ASSERT_TRUE(std::ranges::equal(index.suffixArray(), naiveSuffixArray(text)))
+        << text;
+
+      for (int q = 0; q < 20; ++q) {
+        auto const len     = static_cast<std::size_t>(q % 6 + 1);
+        auto const pattern = randomString(rng, len, lo, hi);
+
+        auto hits = index.locate(pattern);
+        std::ranges::sort(hits);
+        ASSERT_EQ(hits, naiveLocate(text, pattern)) << text << " / " << pattern;
+      }
+    }
+  }
+
+  // Signed chars above 0x7f sort after ASCII
+  std::string const high = "a\xe9z\xe9";
+  txt::suffix_array_index const index(high);
+  EXPECT_TRUE(std::ranges::equal(index.suffixArray(), naiveSuffixArray(high)));
+}
+
+TEST(MySuffixArrayTest, periodicText)
+{
+  std::string const             text(5000, 'a');
+  txt::suffix_array_index const index(text);
+
+  EXPECT_EQ(index.suffixArray().front(), 4999u);
+  EXPECT_EQ(index.count(std::string(100, 'a')), 4901u);
+  EXPECT_EQ(index.count(std::string(5001, 'a')), 0u);
+}
+
+TEST(MySuffixArrayTest, projectionsAndNonByteKeys)
+{
+  auto const fold = [](char ch) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+  };
+
+  txt::suffix_array_index const index(std::string_view{"Hello hELLo"}, fold);
+  EXPECT_EQ(index.count(std::string_view{"HELLO"}, fold), 2u);
+  EXPECT_EQ(index.count(std::string_view{"HELLO"}), 0u);
+
+  std::vector<int> const ints{3, -1, 3, -1, 3, 7, -1, 3};
+  txt::suffix_array_index const int_index(ints);
+  EXPECT_TRUE(std::ranges::equal(int_index.suffixArray(), naiveSuffixArray(ints)));
+  EXPECT_EQ(int_index.count(std::vector<int>{-1, 3}), 3u);
+  EXPECT_EQ(int_index.count(std::vector<int>{3, 7, -1}), 1u);
+}
+
+TEST(MySuffixArrayTest, emptyText)
+{
+  txt::suffix_array_index const index(std::string_view{});
+  EXPECT_EQ(index.size(), 0u);
+  EXPECT_EQ(index.count(std::string_view{"a"}), 0u);
+  EXPECT_EQ(index.count(std::string_view{}), 0u);
+}
+
+TEST(MySuffixArrayTest, saveAndLoadRoundTrip)
+{
+  std::mt19937 rng(42);
+  auto const   text = randomString(rng, 10'000, 'a', 'e');
+
+  txt::suffix_array_index const index(text);
+  auto const path = std::filesystem::temp_directory_path()
+                    / ("dte3611_sa_" + std::to_string(::getpid()) + ".idx");
+
+  index.save(path);
+  auto const loaded = txt::suffix_array_index<char>::load(path);
+  std::filesystem::remove(path);
+
+  EXPECT_TRUE(std::ranges::equal(loaded.text(), index.text()));
+  EXPECT_TRUE(std::ranges::equal(loaded.suffixArray(), index.suffixArray()));
+  EXPECT_TRUE(std::ranges::equal(loaded.lcp(), index.lcp()));
+  EXPECT_EQ(loaded.locate(std::string_view{"abc"}),
+            index.locate(std::string_view{"abc"}));
+
+  // Wrong key width is rejected
+  index.save(path);
+  EXPECT_THROW(txt::suffix_array_index<int>::load(path), std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST(MySuffixArrayTest, loadRejectsCorruptSizes)
+{
+  txt::suffix_array_index const index(std::string_view{"mississippi"});
+  auto const path = std::filesystem::temp_directory_path()
+                    / ("dte3611_sa_corrupt_" + std::to_string(::getpid()) + ".idx");
+
+  // Header padding is written as zeros, so saves are byte-reproducible
+  auto const bytes = [&path] {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), {});
+  };
+  index.save(path);
+  auto const saved = bytes();
+  index.save(path);
+  EXPECT_EQ(bytes(), saved);
+  EXPECT_EQ(saved.substr(20, 4), std::string(4, '\0'));
+
+  // Truncated payload
+  std::filesystem::resize_file(path, saved.size() - 1);
+  EXPECT_THROW(txt::suffix_array_index<char>::load(path), std::runtime_error);
+
+  // Huge n in the header must not be allocated
+  auto corrupt = saved;
+  std::uint64_t const huge = std::uint64_t{1} << 60;
+  corrupt.replace(24, sizeof(huge), reinterpret_cast<char const*>(&huge), sizeof(huge));
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << corrupt;
+  EXPECT_THROW(txt::suffix_array_index<char>::load(path), std::runtime_error);
+
+  // Suffix array entry past the text -- header (32 bytes), then the text
+  corrupt = saved;
+  std::uint32_t const past = 11;
+  corrupt.replace(32 + 11, sizeof(past), reinterpret_cast<char const*>(&past),
+                  sizeof(past));
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << corrupt;
+  EXPECT_THROW(txt::suffix_array_index<char>::load(path), std::runtime_error);
+
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,369 @@
+#ifndef DTE3611_UTILS_CSR_GRAPH_H
+#define DTE3611_UTILS_CSR_GRAPH_H
+
+// boost
+#include <boost/graph/detail/adjacency_list.hpp>
+#include <boost/graph/graph_selectors.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/pending/property.hpp>
+
+// stl
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace dte3611::graph::utils
+{
+
+  namespace detail
+  {
+
+    // Edge of a CsrGraph: its endpoints and its slot in the forward arrays
+    struct csr_edge {
+      std::uint32_t source{0};
+      std::uint32_t target{0};
+      std::uint32_t index{0};
+
+      bool operator==(csr_edge const&) const = default;
+    };
+
+    // CsrGraph storage: arrays the graph builds and owns itself
+    struct csr_owned_storage {
+      template <typename T>
+      using array = std::vector<T>;
+      template <typename T>
+      using bundles = std::vector<T>;
+
+      struct backing {
+      };
+    };
+
+  }   // namespace detail
+
+
+  /**
+   * Immutable compressed-sparse-row graph with 32-bit indices, modelling
+   * predef::concepts::graph::BidirectionalGraph.
+   *
+   * Out-edges are stored source-major: vertex u's targets are
+   * target[out_offset[u], out_offset[u + 1]), and edge bundles live in one
+   * array in the same order, so an edge's index is its forward slot. The
+   * reverse CSR holds every vertex's in-edges as (source, edge index)
+   * pairs. Both directions keep the order of the edge list the graph was
+   * built from; built from an adjacency_list via makeCsrGraph, out-edges
+   * and in-edges therefore come in the same order as in the original.
+   *
+   * The structure is fixed at construction; vertex, edge and graph bundles
+   * stay mutable through operator[]. About 12 bytes per edge plus the
+   * bundles, against roughly 50 for a bidirectional adjacency_list.
+   *
+   * Storage_T decides where the arrays live. The default owns them in
+   * vectors; MappedCsrGraph (csr_graph_file.h) reads them in place from a
+   * mapped file, with read-only bundles.
+   */
+  template <typename VertexBundle_T = boost::no_property,
+            typename EdgeBundle_T   = boost::no_property,
+            typename GraphBundle_T  = boost::no_property,
+            typename Storage_T      = detail::csr_owned_storage>
+  class CsrGraph {
+    template <typename T>
+    using array = typename Storage_T::template array<T>;
+    template <typename T>
+    using bundles = typename Storage_T::template bundles<T>;
+
+    static constexpr bool owns_storage = std::same_as<Storage_T, detail::csr_owned_storage>;
+
+  public:
+    using vertex_descriptor = std::uint32_t;
+    using edge_descriptor   = detail::csr_edge;
+
+    using vertex_bundled    = VertexBundle_T;
+    using edge_bundled      = EdgeBundle_T;
+    using graph_bundled     = GraphBundle_T;
+    using directed_selector = boost::bidirectionalS;
+
+    using vertices_size_type = std::size_t;
+    using edges_size_type    = std::size_t;
+    using degree_size_type   = std::size_t;
+
+    using directed_category      = boost::bidirectional_tag;
+    using edge_parallel_category = boost::allow_parallel_edge_tag;
+    struct traversal_category : boost::bidirectional_graph_tag,
+                                boost::adjacency_graph_tag,
+                                boost::vertex_list_graph_tag,
+                                boost::edge_list_graph_tag {
+    };
+
+    using vertex_iterator        = boost::counting_iterator<vertex_descriptor>;
+    using adjacency_iterator     = vertex_descriptor const*;
+    using inv_adjacency_iterator = vertex_descriptor const*;
+    class out_edge_iterator;
+    class in_edge_iterator;
+    class edge_iterator;
+
+    using edge_entry = std::pair<vertex_descriptor, vertex_descriptor>;
+
+    static constexpr vertex_descriptor null_vertex()
+    {
+      return std::numeric_limits<vertex_descriptor>::max();
+    }
+
+    CsrGraph() requires owns_storage : m_out_offset(1, 0), m_in_offset(1, 0) {}
+
+    /**
+     * Graph over num_vertices vertices and the (source, target) pairs of
+     * edges, in their order. edge_bundles, if given, holds one bundle per
+     * edge, and vertex_bundles one per vertex. Throws std::invalid_argument
+     * on a bundle count mismatch or an endpoint out of range, and
+     * std::length_error if the counts do not fit 32-bit indices.
+     */
+    CsrGraph(std::size_t num_vertices, std::span<edge_entry const> edges,
+             std::vector<EdgeBundle_T>   edge_bundles   = {},
+             std::vector<VertexBundle_T> vertex_bundles = {},
+             GraphBundle_T               graph_bundle   = {})
+    requires owns_storage
+      : m_vertex_bundles(std::move(vertex_bundles)), m_graph_bundle(std::move(graph_bundle))
+    {
+      if (num_vertices >= null_vertex() or edges.size() > std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("CsrGraph: more vertices or edges than 32-bit indices hold");
+      if (not edge_bundles.empty() and edge_bundles.size() != edges.size())
+        throw std::invalid_argument("CsrGraph: one edge bundle per edge expected");
+      if (m_vertex_bundles.empty())
+        m_vertex_bundles.resize(num_vertices);
+      else if (m_vertex_bundles.size() != num_vertices)
+        throw std::invalid_argument("CsrGraph: one vertex bundle per vertex expected");
+
+      auto const n = num_vertices;
+      auto const m = edges.size();
+
+      // Counting sort on the source, then on the target; both stable
+      m_out_offset.assign(n + 1, 0);
+      m_in_offset.assign(n + 1, 0);
+      for (auto const& [u, v] : edges) {
+        if (u >= n or v >= n) throw std::invalid_argument("CsrGraph: edge endpoint out of range");
+        ++m_out_offset[u + 1];
+        ++m_in_offset[v + 1];
+      }
+      for (std::size_t v = 0; v < n; ++v) {
+        m_out_offset[v + 1] += m_out_offset[v];
+        m_in_offset[v + 1] += m_in_offset[v];
+      }
+
+      m_target.resize(m);
+      m_in_source.resize(m);
+      m_in_edge.resize(m);
+      m_edge_bundles.resize(m);
+
+      std::vector<std::uint32_t> out_cursor(m_out_offset.begin(), m_out_offset.end() - 1);
+      std::vector<std::uint32_t> in_cursor(m_in_offset.begin(), m_in_offset.end() - 1);
+      for (std::size_t i = 0; i < m; ++i) {
+        auto const [u, v] = edges[i];
+        auto const k      = out_cursor[u]++;
+        m_target[k]       = v;
+        if (not edge_bundles.empty()) m_edge_bundles[k] = std::move(edge_bundles[i]);
+
+        auto const j   = in_cursor[v]++;
+        m_in_source[j] = u;
+        m_in_edge[j]   = k;
+      }
+    }
+
+    /**
+     * Adopts arrays laid out elsewhere -- the file reader's way in. backing
+     * keeps their memory alive; the arrays are trusted as they are.
+     */
+    CsrGraph(typename Storage_T::backing backing, array<std::uint32_t> out_offset,
+             array<vertex_descriptor> target, array<std::uint32_t> in_offset,
+             array<vertex_descriptor> in_source, array<std::uint32_t> in_edge,
+             bundles<VertexBundle_T> vertex_bundles, bundles<EdgeBundle_T> edge_bundles,
+             GraphBundle_T graph_bundle)
+      : m_out_offset(std::move(out_offset)), m_target(std::move(target)),
+        m_in_offset(std::move(in_offset)), m_in_source(std::move(in_source)),
+        m_in_edge(std::move(in_edge)), m_vertex_bundles(std::move(vertex_bundles)),
+        m_edge_bundles(std::move(edge_bundles)), m_graph_bundle(std::move(graph_bundle)),
+        m_backing(std::move(backing))
+    {
+    }
+
+    std::size_t numVertices() const { return m_out_offset.size() - 1; }
+    std::size_t numEdges() const { return m_target.size(); }
+
+    // Bundled properties; writable only where the graph owns them
+    VertexBundle_T& operator[](vertex_descriptor v) requires owns_storage
+    {
+      return m_vertex_bundles[v];
+    }
+    VertexBundle_T const& operator[](vertex_descriptor v) const { return m_vertex_bundles[v]; }
+    EdgeBundle_T& operator[](edge_descriptor const& e) requires owns_storage
+    {
+      return m_edge_bundles[e.index];
+    }
+    EdgeBundle_T const& operator[](edge_descriptor const& e) const
+    {
+      return m_edge_bundles[e.index];
+    }
+    GraphBundle_T&       operator[](boost::graph_bundle_t) { return m_graph_bundle; }
+    GraphBundle_T const& operator[](boost::graph_bundle_t) const { return m_graph_bundle; }
+
+    // Raw arrays, for code that wants to stream them
+    std::span<std::uint32_t const>     outOffsets() const { return m_out_offset; }
+    std::span<vertex_descriptor const> targets() const { return m_target; }
+    std::span<std::uint32_t const>     inOffsets() const { return m_in_offset; }
+    std::span<vertex_descriptor const> inSources() const { return m_in_source; }
+    std::span<std::uint32_t const>     inEdges() const { return m_in_edge; }
+    bundles<VertexBundle_T> const&     vertexBundles() const { return m_vertex_bundles; }
+    bundles<EdgeBundle_T> const&       edgeBundles() const { return m_edge_bundles; }
+
+    class out_edge_iterator
+      : public boost::iterator_facade<out_edge_iterator, edge_descriptor,
+                                      boost::random_access_traversal_tag, edge_descriptor> {
+    public:
+      out_edge_iterator() = default;
+      out_edge_iterator(CsrGraph const* g, vertex_descriptor u, std::uint32_t k)
+        : m_g{g}, m_u{u}, m_k{k}
+      {
+      }
+
+    private:
+      friend class boost::iterator_core_access;
+
+      edge_descriptor dereference() const { return {m_u, m_g->m_target[m_k], m_k}; }
+      bool equal(out_edge_iterator const& other) const { return m_k == other.m_k; }
+      void increment() { ++m_k; }
+      void decrement() { --m_k; }
+      void advance(std::ptrdiff_t d) { m_k = static_cast<std::uint32_t>(m_k + d); }
+      std::ptrdiff_t distance_to(out_edge_iterator const& other) const
+      {
+        return std::ptrdiff_t(other.m_k) - std::ptrdiff_t(m_k);
+      }
+
+      CsrGraph const*   m_g{nullptr};
+      vertex_descriptor m_u{0};
+      std::uint32_t     m_k{0};
+    };
+
+    class in_edge_iterator
+      : public boost::iterator_facade<in_edge_iterator, edge_descriptor,
+                                      boost::random_access_traversal_tag, edge_descriptor> {
+    public:
+      in_edge_iterator() = default;
+      in_edge_iterator(CsrGraph const* g, vertex_descriptor v, std::uint32_t j)
+        : m_g{g}, m_v{v}, m_j{j}
+      {
+      }
+
+    private:
+      friend class boost::iterator_core_access;
+
+      edge_descriptor dereference() const
+      {
+        return {m_g->m_in_source[m_j], m_v, m_g->m_in_edge[m_j]};
+      }
+      bool equal(in_edge_iterator const& other) const { return m_j == other.m_j; }
+      void increment() { ++m_j; }
+      void decrement() { --m_j; }
+      void advance(std::ptrdiff_t d) { m_j = static_cast<std::uint32_t>(m_j + d); }
+      std::ptrdiff_t distance_to(in_edge_iterator const& other) const
+      {
+        return std::ptrdiff_t(other.m_j) - std::ptrdiff_t(m_j);
+      }
+
+      CsrGraph const*   m_g{nullptr};
+      vertex_descriptor m_v{0};
+      std::uint32_t     m_j{0};
+    };
+
+    // All edges, source-major
+    class edge_iterator
+      : public boost::iterator_facade<edge_iterator, edge_descriptor,
+                                      boost::forward_traversal_tag, edge_descriptor> {
+    public:
+      edge_iterator() = default;
+      edge_iterator(CsrGraph const* g, vertex_descriptor u, std::uint32_t k)
+        : m_g{g}, m_u{u}, m_k{k}
+      {
+        skipEmpty();
+      }
+
+    private:
+      friend class boost::iterator_core_access;
+
+      edge_descriptor dereference() const { return {m_u, m_g->m_target[m_k], m_k}; }
+      bool equal(edge_iterator const& other) const { return m_k == other.m_k; }
+      void increment()
+      {
+        ++m_k;
+        skipEmpty();
+      }
+
+      // Moves m_u to the vertex owning slot m_k
+      void skipEmpty()
+      {
+        auto const n = static_cast<vertex_descriptor>(m_g->numVertices());
+        while (m_u < n and m_k == m_g->m_out_offset[m_u + 1]) ++m_u;
+      }
+
+      CsrGraph const*   m_g{nullptr};
+      vertex_descriptor m_u{0};
+      std::uint32_t     m_k{0};
+    };
+
+  private:
+    array<std::uint32_t>     m_out_offset;
+    array<vertex_descriptor> m_target;
+    array<std::uint32_t>     m_in_offset;
+    array<vertex_descriptor> m_in_source;
+    array<std::uint32_t>     m_in_edge;   // forward slot of every in-edge
+
+    bundles<VertexBundle_T> m_vertex_bundles;
+    bundles<EdgeBundle_T>   m_edge_bundles;
+    GraphBundle_T           m_graph_bundle;
+
+    [[no_unique_address]] typename Storage_T::backing m_backing;
+  };
+
+  /**
+   * CsrGraph copy of a graph with index vertex descriptors -- typically an
+   * adjacency_list<vecS, vecS, bidirectionalS> -- with all its bundles.
+   * Edges are taken in boost::edges order, which for an adjacency_list is
+   * insertion order, so every vertex keeps its out- and in-edge order.
+   */
+  template <typename Graph_T>
+  requires std::integral<typename Graph_T::vertex_descriptor>
+  CsrGraph<typename Graph_T::vertex_bundled, typename Graph_T::edge_bundled,
+           typename Graph_T::graph_bundled>
+  makeCsrGraph(Graph_T const& graph)
+  {
+    using Csr = CsrGraph<typename Graph_T::vertex_bundled, typename Graph_T::edge_bundled,
+                         typename Graph_T::graph_bundled>;
+
+    auto const n = static_cast<std::size_t>(boost::num_vertices(graph));
+
+    std::vector<typename Csr::edge_entry>     edges;
+    std::vector<typename Csr::edge_bundled>   edge_bundles;
+    std::vector<typename Csr::vertex_bundled> vertex_bundles;
+    edges.reserve(boost::num_edges(graph));
+    edge_bundles.reserve(boost::num_edges(graph));
+    vertex_bundles.reserve(n);
+
+    for (auto [ei, end] = boost::edges(graph); ei != end; ++ei) {
+      edges.emplace_back(static_cast<std::uint32_t>(boost::source(*ei, graph)),
+                         static_cast<std::uint32_t>(boost::target(*ei, graph)));
+      edge_bundles.push_back(graph[*ei]);
+    }
+    for (std::size_t v = 0; v < n; ++v) vertex_bundles.push_back(graph[v]);
+
+    return Csr(n, edges, std::move(edge_bundles), std::move(vertex_bundles),
+               graph[boost::graph_bundle]);
+  }
+
+}   // namespace dte3611::graph::utils
+
+#endif   // DTE3611_UTILS_CSR_GRAPH_H
@@ -0,0 +1,134 @@
+#ifndef DTE3611_UTILS_CSR_GRAPH_BGL_H
+#define DTE3611_UTILS_CSR_GRAPH_BGL_H
+
+/*
+ * CsrGraph's Boost Graph Library free functions.
+ *
+ * The graph concepts and the algorithms make qualified boost:: calls,
+ * which only see the overloads declared where the template is defined,
+ * not where it is instantiated. This header therefore has to come ahead
+ * of concepts/graphs.h and of every header calling boost:: on a graph;
+ * the library headers include it first for that reason.
+ */
+
+#include "csr_graph.h"
+
+// boost
+#include <boost/graph/graph_traits.hpp>
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace boost
+{
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  std::size_t num_vertices(dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    return g.numVertices();
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  std::size_t num_edges(dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    return g.numEdges();
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  std::uint32_t vertex(std::size_t i, dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const&)
+  {
+    return static_cast<std::uint32_t>(i);
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  auto vertices(dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    using Iterator = typename dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T>::vertex_iterator;
+    return std::pair{Iterator(0), Iterator(static_cast<std::uint32_t>(g.numVertices()))};
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  auto edges(dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    using Iterator = typename dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T>::edge_iterator;
+    auto const n   = static_cast<std::uint32_t>(g.numVertices());
+    auto const m   = static_cast<std::uint32_t>(g.numEdges());
+    return std::pair{Iterator(&g, 0, 0), Iterator(&g, n, m)};
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  std::uint32_t source(dte3611::graph::utils::detail::csr_edge const& e,
+                       dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const&)
+  {
+    return e.source;
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  std::uint32_t target(dte3611::graph::utils::detail::csr_edge const& e,
+                       dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const&)
+  {
+    return e.target;
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  auto out_edges(std::uint32_t u, dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    using Iterator = typename dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T>::out_edge_iterator;
+    return std::pair{Iterator(&g, u, g.outOffsets()[u]), Iterator(&g, u, g.outOffsets()[u + 1])};
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  auto in_edges(std::uint32_t v, dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    using Iterator = typename dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T>::in_edge_iterator;
+    return std::pair{Iterator(&g, v, g.inOffsets()[v]), Iterator(&g, v, g.inOffsets()[v + 1])};
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  auto adjacent_vertices(std::uint32_t u, dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    auto const* targets = g.targets().data();
+    return std::pair{targets + g.outOffsets()[u], targets + g.outOffsets()[u + 1]};
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  auto inv_adjacent_vertices(std::uint32_t v,
+                             dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    auto const* sources = g.inSources().data();
+    return std::pair{sources + g.inOffsets()[v], sources + g.inOffsets()[v + 1]};
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  std::size_t out_degree(std::uint32_t u, dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    return g.outOffsets()[u + 1] - g.outOffsets()[u];
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  std::size_t in_degree(std::uint32_t v, dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    return g.inOffsets()[v + 1] - g.inOffsets()[v];
+  }
+
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  std::size_t degree(std::uint32_t v, dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    return out_degree(v, g) + in_degree(v, g);
+  }
+
+  // First u -> v edge; a linear scan of u's out-edges
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  std::pair<dte3611::graph::utils::detail::csr_edge, bool>
+  edge(std::uint32_t u, std::uint32_t v, dte3611::graph::utils::CsrGraph<V_T, E_T, G_T, S_T> const& g)
+  {
+    for (auto [ei, end] = out_edges(u, g); ei != end; ++ei)
+      if ((*ei).target == v) return {*ei, true};
+    return {{}, false};
+  }
+
+}   // namespace boost
+
+#endif   // DTE3611_UTILS_CSR_GRAPH_BGL_H
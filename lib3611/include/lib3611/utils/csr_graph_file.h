@@ -0,0 +1,412 @@
+#ifndef DTE3611_UTILS_CSR_GRAPH_FILE_H
+#define DTE3611_UTILS_CSR_GRAPH_FILE_H
+
+#include "csr_graph.h"
+#include "mapped_file.h"
+#include "thread_pool.h"
+
+// stl
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace dte3611::graph::utils
+{
+
+  namespace detail
+  {
+
+    // graph::utils shadows dte3611::utils in here
+    namespace file_utils = ::dte3611::utils;
+
+    // Bundles read in place; an empty bundle type occupies no bytes
+    template <typename T>
+    class mapped_bundles {
+    public:
+      mapped_bundles() = default;
+      mapped_bundles(T const* data, std::size_t size) : m_data{data}, m_size{size} {}
+
+      T const& operator[](std::size_t i) const
+      {
+        if constexpr (std::is_empty_v<T>) {
+          static T const empty{};
+          return empty;
+        }
+        else
+          return m_data[i];
+      }
+
+      T const*    data() const { return m_data; }
+      std::size_t size() const { return m_size; }
+
+    private:
+      T const*    m_data{nullptr};
+      std::size_t m_size{0};
+    };
+
+    // CsrGraph storage: read-only views into a mapped graph file
+    struct csr_mapped_storage {
+      template <typename T>
+      using array = std::span<T const>;
+      template <typename T>
+      using bundles = mapped_bundles<T>;
+
+      using backing = std::shared_ptr<file_utils::MappedFile const>;
+    };
+
+    // Bundles are stored as raw bytes
+    template <typename T>
+    concept FileBundle = std::is_trivially_copyable_v<T> and std::is_default_constructible_v<T>
+                         and alignof(T) <= 64;
+
+    template <typename T>
+    constexpr std::uint32_t bundleBytes()
+    {
+      return std::is_empty_v<T> ? 0 : static_cast<std::uint32_t>(sizeof(T));
+    }
+
+    inline constexpr std::uint64_t csr_file_magic   = 0x5247'3131'3633'4554;   // "TE3611GR"
+    inline constexpr std::uint32_t csr_file_version = 1;
+    inline constexpr std::uint32_t csr_file_endian  = 0x0102'0304;
+    inline constexpr std::size_t   csr_file_align   = 64;
+
+    constexpr std::uint64_t byteSwapped(std::uint64_t x)
+    {
+      std::uint64_t swapped = 0;
+      for (int i = 0; i < 8; ++i, x >>= 8) swapped = swapped << 8 | (x & 0xff);
+      return swapped;
+    }
+
+    struct csr_file_header {
+      std::uint64_t magic{csr_file_magic};
+      std::uint32_t version{csr_file_version};
+      std::uint32_t endian{csr_file_endian};   // reads back swapped on the other byte order
+      std::uint64_t num_vertices{0};
+      std::uint64_t num_edges{0};
+      std::uint32_t vertex_bundle_bytes{0};
+      std::uint32_t edge_bundle_bytes{0};
+      std::uint32_t graph_bundle_bytes{0};
+      std::uint32_t reserved{0};
+    };
+    static_assert(sizeof(csr_file_header) <= csr_file_align);
+
+    /**
+     * File layout: the header, then every section at the next 64-byte
+     * boundary, in this order:
+     *   out_offset[n + 1]  target[m]  in_offset[n + 1]  in_source[m]
+     *   in_edge[m]  vertex bundles[n]  edge bundles[m]  graph bundle
+     * All integers are 32-bit, in the writer's byte order.
+     */
+    struct csr_file_layout {
+      std::size_t out_offset, target, in_offset, in_source, in_edge;
+      std::size_t vertex_bundles, edge_bundles, graph_bundle, total;
+
+      explicit csr_file_layout(csr_file_header const& h)
+      {
+        auto const n = static_cast<std::size_t>(h.num_vertices);
+        auto const m = static_cast<std::size_t>(h.num_edges);
+
+        std::size_t at = csr_file_align;
+        auto place     = [&at](std::size_t bytes) {
+          auto const offset = at;
+          at += (bytes + csr_file_align - 1) / csr_file_align * csr_file_align;
+          return offset;
+        };
+        out_offset     = place((n + 1) * 4);
+        target         = place(m * 4);
+        in_offset      = place((n + 1) * 4);
+        in_source      = place(m * 4);
+        in_edge        = place(m * 4);
+        vertex_bundles = place(n * h.vertex_bundle_bytes);
+        edge_bundles   = place(m * h.edge_bundle_bytes);
+        graph_bundle   = place(h.graph_bundle_bytes);
+        total          = at;
+      }
+    };
+
+    // Default importer payload: the rest of the line is ignored
+    struct no_edge_bundle {
+      boost::no_property operator()(std::string_view) const { return {}; }
+    };
+
+  }   // namespace detail
+
+
+  /**
+   * CsrGraph over a graph file mapped read-only: the arrays are used in
+   * place, so loading costs a header check however large the graph. It
+   * models BidirectionalGraph like any CsrGraph, but its bundles cannot be
+   * written -- algorithms that store results in them, such as maxFlow,
+   * need an owning copy. Copies share the mapping.
+   */
+  template <typename VertexBundle_T = boost::no_property,
+            typename EdgeBundle_T   = boost::no_property,
+            typename GraphBundle_T  = boost::no_property>
+  using MappedCsrGraph
+    = CsrGraph<VertexBundle_T, EdgeBundle_T, GraphBundle_T, detail::csr_mapped_storage>;
+
+
+  /**
+   * Writes graph in the versioned binary format loadCsrGraph maps. Bundles
+   * are written as raw bytes, so they must be trivially copyable; empty
+   * bundle types take no space. Throws std::runtime_error on I/O failure.
+   */
+  template <detail::FileBundle V_T, detail::FileBundle E_T, detail::FileBundle G_T,
+            typename S_T>
+  void writeCsrGraph(std::filesystem::path const& path, CsrGraph<V_T, E_T, G_T, S_T> const& graph)
+  {
+    detail::csr_file_header header;
+    header.num_vertices        = graph.numVertices();
+    header.num_edges           = graph.numEdges();
+    header.vertex_bundle_bytes = detail::bundleBytes<V_T>();
+    header.edge_bundle_bytes   = detail::bundleBytes<E_T>();
+    header.graph_bundle_bytes  = detail::bundleBytes<G_T>();
+    detail::csr_file_layout const layout(header);
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (not out) throw std::runtime_error("cannot write " + path.string());
+
+    std::size_t at      = 0;
+    auto        section = [&](std::size_t offset, void const* data, std::size_t bytes) {
+      static constexpr char zeros[detail::csr_file_align]{};
+      out.write(zeros, static_cast<std::streamsize>(offset - at));
+      out.write(static_cast<char const*>(data), static_cast<std::streamsize>(bytes));
+      at = offset + bytes;
+    };
+
+    section(0, &header, sizeof(header));
+    section(layout.out_offset, graph.outOffsets().data(), graph.outOffsets().size_bytes());
+    section(layout.target, graph.targets().data(), graph.targets().size_bytes());
+    section(layout.in_offset, graph.inOffsets().data(), graph.inOffsets().size_bytes());
+    section(layout.in_source, graph.inSources().data(), graph.inSources().size_bytes());
+    section(layout.in_edge, graph.inEdges().data(), graph.inEdges().size_bytes());
+    section(layout.vertex_bundles, graph.vertexBundles().data(),
+            header.num_vertices * header.vertex_bundle_bytes);
+    section(layout.edge_bundles, graph.edgeBundles().data(),
+            header.num_edges * header.edge_bundle_bytes);
+    section(layout.graph_bundle, &graph[boost::graph_bundle], header.graph_bundle_bytes);
+    section(layout.total, nullptr, 0);
+
+    if (not out) throw std::runtime_error("failed writing " + path.string());
+  }
+
+  /**
+   * Maps a file written by writeCsrGraph, with the bundle types it was
+   * written with. Header, sizes and the offset arrays' ends are checked
+   * -- std::runtime_error if anything is off -- the rest is trusted: a
+   * corrupt target, source or edge index is read out of bounds during
+   * traversal. Run validateCsrGraph on files from untrusted sources.
+   * Traversals jump around, so read-ahead is off by default.
+   */
+  template <detail::FileBundle VertexBundle_T = boost::no_property,
+            detail::FileBundle EdgeBundle_T   = boost::no_property,
+            detail::FileBundle GraphBundle_T  = boost::no_property>
+  MappedCsrGraph<VertexBundle_T, EdgeBundle_T, GraphBundle_T>
+  loadCsrGraph(std::filesystem::path const& path,
+               detail::file_utils::MapHints  hints = {.sequential = false})
+  {
+    using Graph = MappedCsrGraph<VertexBundle_T, EdgeBundle_T, GraphBundle_T>;
+    using VD    = typename Graph::vertex_descriptor;
+
+    auto file = std::make_shared<detail::file_utils::MappedFile const>(path, hints);
+    auto bad  = [&path](char const* what) -> std::runtime_error {
+      return std::runtime_error("not a compatible graph file (" + std::string(what)
+                                + "): " + path.string());
+    };
+
+    detail::csr_file_header header;
+    if (file->size() < detail::csr_file_align) throw bad("truncated");
+    std::memcpy(&header, file->data(), sizeof(header));
+
+    // A file from the other byte order has its magic swapped too
+    if (header.magic == detail::byteSwapped(detail::csr_file_magic)) throw bad("byte order");
+    if (header.magic != detail::csr_file_magic) throw bad("magic");
+    if (header.endian != detail::csr_file_endian) throw bad("byte order");
+    if (header.version != detail::csr_file_version) throw bad("version");
+    if (header.vertex_bundle_bytes != detail::bundleBytes<VertexBundle_T>()
+        or header.edge_bundle_bytes != detail::bundleBytes<EdgeBundle_T>()
+        or header.graph_bundle_bytes != detail::bundleBytes<GraphBundle_T>())
+      throw bad("bundle sizes");
+    if (header.num_vertices >= Graph::null_vertex()
+        or header.num_edges > std::numeric_limits<std::uint32_t>::max())
+      throw bad("counts");
+
+    detail::csr_file_layout const layout(header);
+    if (file->size() != layout.total) throw bad("size");
+
+    auto const n = static_cast<std::size_t>(header.num_vertices);
+    auto const m = static_cast<std::size_t>(header.num_edges);
+
+    auto const* data  = file->data();
+    auto        array = [data]<typename T>(std::type_identity<T>, std::size_t offset,
+                                           std::size_t count) {
+      return std::span<T const>(reinterpret_cast<T const*>(data + offset), count);
+    };
+    auto const out_offset = array(std::type_identity<std::uint32_t>{}, layout.out_offset, n + 1);
+    auto const in_offset  = array(std::type_identity<std::uint32_t>{}, layout.in_offset, n + 1);
+    if (out_offset.front() != 0 or out_offset.back() != m or in_offset.front() != 0
+        or in_offset.back() != m)
+      throw bad("offsets");
+
+    GraphBundle_T graph_bundle{};
+    if (header.graph_bundle_bytes != 0)
+      std::memcpy(&graph_bundle, data + layout.graph_bundle, sizeof(GraphBundle_T));
+
+    return Graph(std::move(file), out_offset, array(std::type_identity<VD>{}, layout.target, m),
+                 in_offset, array(std::type_identity<VD>{}, layout.in_source, m),
+                 array(std::type_identity<std::uint32_t>{}, layout.in_edge, m),
+                 {reinterpret_cast<VertexBundle_T const*>(data + layout.vertex_bundles), n},
+                 {reinterpret_cast<EdgeBundle_T const*>(data + layout.edge_bundles), m},
+                 graph_bundle);
+  }
+
+
+  /**
+   * Checks every array of graph against its vertex and edge counts:
+   * offsets ascending, targets and sources below n, in-edge indices below
+   * m. O(V + E); throws std::runtime_error on the first violation. After
+   * it passes, traversals of a mapped graph stay inside the mapping.
+   */
+  template <typename V_T, typename E_T, typename G_T, typename S_T>
+  void validateCsrGraph(CsrGraph<V_T, E_T, G_T, S_T> const& graph)
+  {
+    auto const n = static_cast<std::size_t>(graph.numVertices());
+    auto const m = static_cast<std::size_t>(graph.numEdges());
+
+    auto corrupt = [](char const* what) {
+      return std::runtime_error(std::string("corrupt graph (") + what + ")");
+    };
+    auto ascending_to_m = [n, m](std::span<std::uint32_t const> offsets) {
+      return offsets.size() == n + 1 and offsets.front() == 0 and offsets.back() == m
+             and std::ranges::is_sorted(offsets);
+    };
+    auto below = [](auto const& values, std::size_t bound) {
+      return std::ranges::all_of(values, [bound](auto x) { return x < bound; });
+    };
+
+    if (not ascending_to_m(graph.outOffsets()) or not ascending_to_m(graph.inOffsets()))
+      throw corrupt("offsets");
+    if (graph.targets().size() != m or not below(graph.targets(), n)) throw corrupt("targets");
+    if (graph.inSources().size() != m or not below(graph.inSources(), n))
+      throw corrupt("in-edge sources");
+    if (graph.inEdges().size() != m or not below(graph.inEdges(), m))
+      throw corrupt("in-edge indices");
+  }
+
+
+  /**
+   * Parallel import of a text edge list: one "source target [rest]" line
+   * per edge, with blank lines and lines starting with '#' or '%' skipped.
+   * The file is mapped and cut into 1 MiB chunks at line starts that the
+   * pool parses concurrently; edges keep their file order. parse_bundle
+   * turns the rest of a line into the edge bundle. There are 1 + the
+   * largest id vertices. Throws std::invalid_argument on a malformed line,
+   * with its byte offset.
+   */
+  template <typename Parse_T = detail::no_edge_bundle>
+  CsrGraph<boost::no_property, std::invoke_result_t<Parse_T&, std::string_view>>
+  importEdgeList(detail::file_utils::ThreadPool& pool, std::filesystem::path const& path,
+                 Parse_T parse_bundle = {})
+  {
+    using EdgeBundle = std::invoke_result_t<Parse_T&, std::string_view>;
+    using Graph      = CsrGraph<boost::no_property, EdgeBundle>;
+    using Edge       = typename Graph::edge_entry;
+
+    constexpr std::size_t chunk = std::size_t{1} << 20;
+
+    detail::file_utils::MappedFile const file(path);
+    auto const                           text   = file.view();
+    auto const                           chunks = (text.size() + chunk - 1) / chunk;
+
+    // A line belongs to the chunk it starts in
+    auto line_start = [&text](std::size_t at) {
+      if (at == 0 or at >= text.size()) return std::min(at, text.size());
+      auto const nl = text.find('\n', at - 1);
+      return nl == std::string_view::npos ? text.size() : nl + 1;
+    };
+
+    struct Part {
+      std::vector<Edge>       edges;
+      std::vector<EdgeBundle> bundles;
+      std::uint64_t           max_id{0};
+    };
+    std::vector<Part> parts(chunks);
+
+    pool.parallelFor(chunks, [&](std::size_t c) {
+      auto& part = parts[c];
+      auto  at   = line_start(c * chunk);
+      auto const end = line_start((c + 1) * chunk);
+
+      auto malformed = [&path](std::size_t offset) {
+        return std::invalid_argument("importEdgeList: malformed line at byte "
+                                     + std::to_string(offset) + " of " + path.string());
+      };
+      auto skip_blanks = [&text](std::size_t i, std::size_t stop) {
+        while (i < stop and (text[i] == ' ' or text[i] == '\t' or text[i] == '\r')) ++i;
+        return i;
+      };
+
+      while (at < end) {
+        auto eol = text.find('\n', at);
+        if (eol == std::string_view::npos or eol > end) eol = end;
+
+        auto i = skip_blanks(at, eol);
+        if (i < eol and text[i] != '#' and text[i] != '%') {
+          std::uint64_t ids[2];
+          for (auto& id : ids) {
+            i             = skip_blanks(i, eol);
+            auto const r  = std::from_chars(text.data() + i, text.data() + eol, id);
+            if (r.ec != std::errc{} or id >= Graph::null_vertex()) throw malformed(at);
+            i = static_cast<std::size_t>(r.ptr - text.data());
+            if (i < eol and text[i] != ' ' and text[i] != '\t' and text[i] != '\r')
+              throw malformed(at);
+          }
+          part.edges.emplace_back(static_cast<std::uint32_t>(ids[0]),
+                                  static_cast<std::uint32_t>(ids[1]));
+          part.bundles.push_back(parse_bundle(text.substr(i, eol - i)));
+          part.max_id = std::max({part.max_id, ids[0] + 1, ids[1] + 1});
+        }
+        at = eol + 1;
+      }
+    });
+
+    std::vector<std::size_t> first(chunks + 1, 0);
+    std::uint64_t            n = 0;
+    for (std::size_t c = 0; c < chunks; ++c) {
+      first[c + 1] = first[c] + parts[c].edges.size();
+      n            = std::max(n, parts[c].max_id);
+    }
+
+    std::vector<Edge>       edges(first.back());
+    std::vector<EdgeBundle> bundles(first.back());
+    pool.parallelFor(chunks, [&](std::size_t c) {
+      std::ranges::copy(parts[c].edges, edges.begin() + first[c]);
+      std::ranges::move(parts[c].bundles, bundles.begin() + first[c]);
+    });
+
+    return Graph(static_cast<std::size_t>(n), edges, std::move(bundles));
+  }
+
+  // Same, on the process-wide pool
+  template <typename Parse_T = detail::no_edge_bundle>
+  auto importEdgeList(std::filesystem::path const& path, Parse_T parse_bundle = {})
+  {
+    return importEdgeList(detail::file_utils::defaultThreadPool(), path, std::move(parse_bundle));
+  }
+
+}   // namespace dte3611::graph::utils
+
+#endif   // DTE3611_UTILS_CSR_GRAPH_FILE_H
@@ -1,6 +1,9 @@
 #ifndef DTE3611_UTILS_GRAPH_UTILS_H
 #define DTE3611_UTILS_GRAPH_UTILS_H
 
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "csr_graph_bgl.h"
+
 // concepts
 #include "../utils/concepts/graphs.h"
 
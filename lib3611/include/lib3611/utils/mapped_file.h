@@ -0,0 +1,123 @@
+#ifndef DTE3611_UTILS_MAPPED_FILE_H
+#define DTE3611_UTILS_MAPPED_FILE_H
+
+// stl
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+// posix
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dte3611::utils
+{
+
+  // Advice passed to the kernel after mapping; all of it is best effort
+  struct MapHints {
+    bool sequential{true};    // madvise(MADV_SEQUENTIAL): aggressive read-ahead
+    bool huge_pages{false};   // madvise(MADV_HUGEPAGE), where the fs supports it
+    bool populate{false};     // MAP_POPULATE: fault the whole file in up front
+  };
+
+  /**
+   * Read-only, move-only mapping of a whole file. Models a contiguous range
+   * of char, so any string_match engine runs directly over the mapped bytes.
+   * Open/stat/mmap failures throw std::system_error.
+   */
+  class MappedFile {
+  public:
+    MappedFile() = default;
+
+    explicit MappedFile(std::filesystem::path const& path, MapHints hints = {})
+    {
+      int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd < 0) fail(errno, "open " + path.string());
+
+      struct stat st {};
+      if (::fstat(fd, &st) != 0) {
+        int const err = errno;
+        ::close(fd);
+        fail(err, "stat " + path.string());
+      }
+      m_size = static_cast<std::size_t>(st.st_size);
+
+      // mmap rejects zero-length mappings; an empty file is an empty range
+      if (m_size > 0) {
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        if (hints.populate) flags |= MAP_POPULATE;
+#endif
+        void* addr = ::mmap(nullptr, m_size, PROT_READ, flags, fd, 0);
+        if (addr == MAP_FAILED) {
+          int const err = errno;
+          ::close(fd);
+          fail(err, "mmap " + path.string());
+        }
+        m_data = static_cast<char const*>(addr);
+
+        if (hints.sequential) ::madvise(addr, m_size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+        if (hints.huge_pages) ::madvise(addr, m_size, MADV_HUGEPAGE);
+#endif
+      }
+
+      // The mapping keeps the file alive
+      ::close(fd);
+    }
+
+    ~MappedFile() { unmap(); }
+
+    MappedFile(MappedFile&& other) noexcept
+      : m_data{std::exchange(other.m_data, nullptr)},
+        m_size{std::exchange(other.m_size, 0)}
+    {
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+      if (this != &other) {
+        unmap();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+      }
+      return *this;
+    }
+
+    MappedFile(MappedFile const&)            = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    char const*      data() const { return m_data; }
+    std::size_t      size() const { return m_size; }
+    bool             empty() const { return m_size == 0; }
+    char const*      begin() const { return m_data; }
+    char const*      end() const { return m_data + m_size; }
+    std::string_view view() const { return {m_data, m_size}; }
+
+  private:
+    // err is saved by the caller -- close() may overwrite errno
+    [[noreturn]] static void fail(int err, std::string const& what)
+    {
+      throw std::system_error(err, std::generic_category(), what);
+    }
+
+    void unmap()
+    {
+      if (m_data) ::munmap(const_cast<char*>(m_data), m_size);
+      m_data = nullptr;
+      m_size = 0;
+    }
+
+    char const* m_data{nullptr};
+    std::size_t m_size{0};
+  };
+
+}   // namespace dte3611::utils
+
+#endif   // DTE3611_UTILS_MAPPED_FILE_H
@@ -0,0 +1,205 @@
+#ifndef DTE3611_UTILS_STRING_MATCH_UTILS_H
+#define DTE3611_UTILS_STRING_MATCH_UTILS_H
+
+// stl
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace dte3611::string_match::utils
+{
+  namespace detail
+  {
+
+    /**
+     * Predicates for which "pred(a, b)" is plain equality of the projected
+     * keys. Skip tables and rolling hashes are only sound under these;
+     * anything else falls back to element-wise comparison.
+     */
+    template <typename BinaryPredicate_T>
+    inline constexpr bool is_equality_predicate_v
+      = std::same_as<BinaryPredicate_T, std::ranges::equal_to>
+        or std::same_as<BinaryPredicate_T, std::equal_to<>>;
+
+    template <typename T>
+    inline constexpr bool is_equality_predicate_v<std::equal_to<T>> = true;
+
+    // Keys that fit a dense 256-entry table
+    template <typename Key_T>
+    inline constexpr bool is_byte_key_v
+      = std::integral<Key_T> and sizeof(Key_T) == 1
+        and not std::same_as<Key_T, bool>;
+
+    // Byte key -> table slot
+    template <typename Value_T>
+    constexpr std::size_t byteIndex(Value_T const& value)
+    {
+      return static_cast<std::size_t>(static_cast<unsigned char>(value));
+    }
+
+    /**
+     * Hash of a projected key; equal keys hash equally also when haystack and
+     * pattern projections yield different integral types.
+     */
+    template <typename Key_T, typename Value_T>
+    constexpr std::uint64_t keyHash(Value_T const& value)
+    {
+      if constexpr (std::integral<Key_T>)
+        return static_cast<std::uint64_t>(
+          static_cast<std::int64_t>(static_cast<Key_T>(value)));
+      else
+        return static_cast<std::uint64_t>(
+          std::hash<Key_T>{}(static_cast<Key_T const&>(value)));
+    }
+
+    // Projected pattern key type
+    template <typename S_Iterator_T, typename S_Projection_T>
+    using pattern_key_t = std::remove_cvref_t<
+      std::invoke_result_t<S_Projection_T&, std::iter_reference_t<S_Iterator_T>>>;
+
+    // Materialize the projected pattern
+    template <typename Key_T, std::forward_iterator S_Iterator_T,
+              std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+              typename S_Projection_T>
+    constexpr std::vector<Key_T> materializePattern(S_Iterator_T   s_first,
+                                                    S_Sentinel_T   s_last,
+                                                    S_Projection_T& s_proj)
+    {
+      std::vector<Key_T> pat;
+      for (auto it = s_first; it != s_last; ++it)
+        pat.push_back(std::invoke(s_proj, *it));
+      return pat;
+    }
+
+
+    /**
+     * Fast paths for byte haystacks. With plain equality, no projection and
+     * the same byte type on both sides a match is a byte-wise match, so the
+     * scans can run on memchr/memcmp over contiguous storage.
+     */
+    template <typename Value_T, typename Key_T, typename BinaryPredicate_T,
+              typename Projection_T>
+    inline constexpr bool is_raw_byte_match_v
+      = is_equality_predicate_v<BinaryPredicate_T>
+        and std::same_as<Projection_T, std::identity> and is_byte_key_v<Value_T>
+        and std::same_as<Value_T, Key_T>;
+
+    template <typename Iterator_T, typename Sentinel_T>
+    concept ContiguousBytes
+      = std::contiguous_iterator<Iterator_T>
+        and std::sized_sentinel_for<Sentinel_T, Iterator_T>
+        and is_byte_key_v<std::iter_value_t<Iterator_T>>;
+
+    // Naive scan: memchr to the next candidate, memcmp to verify.
+    // Returns the match offset, or n
+    template <typename Byte_T>
+    std::size_t rawNaiveFind(Byte_T const* hay, std::size_t n,
+                             Byte_T const* pat, std::size_t m)
+    {
+      if (m > n) return n;
+
+      Byte_T const* const stop = hay + (n - m + 1);   // last start + 1
+      for (Byte_T const* at = hay; at < stop; ++at) {
+        at = static_cast<Byte_T const*>(std::memchr(
+          at, static_cast<unsigned char>(pat[0]), static_cast<std::size_t>(stop - at)));
+        if (at == nullptr) break;
+        if (std::memcmp(at + 1, pat + 1, m - 1) == 0)
+          return static_cast<std::size_t>(at - hay);
+      }
+      return n;
+    }
+
+    // KMP scan; in the empty state memchr skips to the next pattern head.
+    // Calls on_match(offset) per match until it returns false; after a match
+    // the scan goes on from the border state, i.e. state is never rebuilt
+    template <typename Byte_T, typename OnMatch_T>
+    void rawKmpScan(Byte_T const* hay, std::size_t n, Byte_T const* pat,
+                    std::size_t m, std::size_t const* lps, OnMatch_T&& on_match)
+    {
+      std::size_t j = 0;
+      for (std::size_t i = 0; i < n;) {
+        if (j == 0) {
+          auto const* head = static_cast<Byte_T const*>(std::memchr(
+            hay + i, static_cast<unsigned char>(pat[0]), n - i));
+          if (head == nullptr) return;
+          i = static_cast<std::size_t>(head - hay) + 1;
+          j = 1;
+        }
+        else if (hay[i] == pat[j]) {
+          ++i;
+          ++j;
+        }
+        else
+          j = lps[j - 1];
+
+        if (j == m) {
+          if (not on_match(i - m)) return;
+          j = lps[m - 1];
+        }
+      }
+    }
+
+    // Returns the first match offset, or n
+    template <typename Byte_T>
+    std::size_t rawKmpFind(Byte_T const* hay, std::size_t n, Byte_T const* pat,
+                           std::size_t m, std::size_t const* lps)
+    {
+      std::size_t found = n;
+      rawKmpScan(hay, n, pat, m, lps, [&found](std::size_t pos) {
+        found = pos;
+        return false;
+      });
+      return found;
+    }
+
+  }   // namespace detail
+
+
+  /**
+   * A byte projection tabulated once -- 256 entries replace one projection
+   * call per comparison (case folding through std::tolower etc.). Build it
+   * once and pass it as the haystack projection to as many searches as
+   * wanted. The projection is called on every byte value, also those that
+   * never occur in a haystack, so it must be defined on all of them; for
+   * char that includes the negative values.
+   */
+  template <typename Value_T, typename Projection_T>
+  class byte_translation {
+    static_assert(detail::is_byte_key_v<Value_T>);
+
+    using Result_T = std::remove_cvref_t<
+      std::invoke_result_t<Projection_T const&, Value_T const&>>;
+
+  public:
+    constexpr explicit byte_translation(Projection_T const& proj)
+    {
+      for (std::size_t b = 0; b < m_table.size(); ++b)
+        m_table[b] = std::invoke(
+          proj, static_cast<Value_T>(static_cast<unsigned char>(b)));
+    }
+
+    constexpr Result_T operator()(Value_T const& value) const
+    {
+      return m_table[detail::byteIndex(value)];
+    }
+
+  private:
+    std::array<Result_T, 256> m_table{};
+  };
+
+  // byte_translation over Value_T elements, the projection type deduced
+  template <typename Value_T, typename Projection_T>
+  constexpr byte_translation<Value_T, Projection_T>
+  makeByteTranslation(Projection_T const& proj)
+  {
+    return byte_translation<Value_T, Projection_T>{proj};
+  }
+
+}   // namespace dte3611::string_match::utils
+
+#endif   // DTE3611_UTILS_STRING_MATCH_UTILS_H
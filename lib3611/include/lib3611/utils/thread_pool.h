@@ -0,0 +1,159 @@
+#ifndef DTE3611_UTILS_THREAD_POOL_H
+#define DTE3611_UTILS_THREAD_POOL_H
+
+// stl
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace dte3611::utils
+{
+
+  /**
+   * Fixed-size pool of worker threads fed from a single FIFO task queue.
+   * Destruction drains the queue and joins the workers.
+   */
+  class ThreadPool {
+  public:
+    explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency())
+    {
+      threads = std::max<std::size_t>(threads, 1);
+      m_workers.reserve(threads);
+      for (std::size_t i = 0; i < threads; ++i)
+        m_workers.emplace_back([this] { workerLoop(); });
+    }
+
+    ~ThreadPool()
+    {
+      {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+      }
+      m_cv.notify_all();
+      for (auto& worker : m_workers) worker.join();
+    }
+
+    ThreadPool(ThreadPool const&)            = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    std::size_t size() const { return m_workers.size(); }
+
+    // Queue a task; the future carries its result or exception
+    template <typename Fn_T>
+    std::future<std::invoke_result_t<std::decay_t<Fn_T>>> submit(Fn_T&& fn)
+    {
+      using Result = std::invoke_result_t<std::decay_t<Fn_T>>;
+
+      auto task = std::make_shared<std::packaged_task<Result()>>(
+        std::forward<Fn_T>(fn));
+      auto future = task->get_future();
+      {
+        std::lock_guard lock(m_mutex);
+        m_tasks.emplace([task] { (*task)(); });
+      }
+      m_cv.notify_one();
+      return future;
+    }
+
+    /**
+     * Run fn(i) for every i in [0, n) and wait. Indices are handed out
+     * dynamically and the calling thread takes part; helpers that have not
+     * started by the time the indices run out are cancelled rather than
+     * awaited, so nested calls from inside a task cannot deadlock the pool.
+     */
+    template <typename Fn_T>
+    void parallelFor(std::size_t n, Fn_T&& fn)
+    {
+      if (n == 0) return;
+
+      struct Shared {
+        std::atomic<std::size_t> next{0};
+        std::mutex               mutex;
+        std::condition_variable  cv;
+        std::size_t              running{0};
+        bool                     closed{false};
+        std::exception_ptr       error;
+      };
+      auto const shared = std::make_shared<Shared>();
+
+      auto drain = [n, &fn](Shared& st) {
+        try {
+          for (std::size_t i; (i = st.next.fetch_add(1)) < n;) fn(i);
+        }
+        catch (...) {
+          st.next = n;
+          std::lock_guard lock(st.mutex);
+          if (not st.error) st.error = std::current_exception();
+        }
+      };
+
+      auto const n_helpers = std::min(size(), n - 1);
+      for (std::size_t h = 0; h < n_helpers; ++h) {
+        {
+          std::lock_guard lock(m_mutex);
+          m_tasks.emplace([shared, &drain] {
+            {
+              std::lock_guard lock(shared->mutex);
+              if (shared->closed) return;   // caller is gone or leaving
+              ++shared->running;
+            }
+            drain(*shared);
+            std::lock_guard lock(shared->mutex);
+            --shared->running;
+            shared->cv.notify_all();
+          });
+        }
+        m_cv.notify_one();
+      }
+
+      drain(*shared);
+
+      std::unique_lock lock(shared->mutex);
+      shared->closed = true;
+      shared->cv.wait(lock, [&] { return shared->running == 0; });
+      if (shared->error) std::rethrow_exception(shared->error);
+    }
+
+  private:
+    void workerLoop()
+    {
+      for (;;) {
+        std::function<void()> task;
+        {
+          std::unique_lock lock(m_mutex);
+          m_cv.wait(lock, [this] { return m_stopping or not m_tasks.empty(); });
+          if (m_tasks.empty()) return;   // stopping and drained
+          task = std::move(m_tasks.front());
+          m_tasks.pop();
+        }
+        task();
+      }
+    }
+
+    std::vector<std::thread>          m_workers;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex                        m_mutex;
+    std::condition_variable           m_cv;
+    bool                              m_stopping{false};
+  };
+
+  // Process-wide pool sized to the hardware
+  inline ThreadPool& defaultThreadPool()
+  {
+    static ThreadPool pool;
+    return pool;
+  }
+
+}   // namespace dte3611::utils
+
+#endif   // DTE3611_UTILS_THREAD_POOL_H
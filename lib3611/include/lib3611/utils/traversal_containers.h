@@ -0,0 +1,104 @@
+#ifndef DTE3611_UTILS_TRAVERSAL_CONTAINERS_H
+#define DTE3611_UTILS_TRAVERSAL_CONTAINERS_H
+
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "csr_graph_bgl.h"
+
+// boost
+#include <boost/graph/graph_traits.hpp>
+
+// stl
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace dte3611::graph::utils
+{
+  namespace detail
+  {
+
+    /**
+     * Vertex descriptors that are indices in [0, num_vertices) -- as for
+     * vecS vertex storage -- get dense per-vertex containers.
+     */
+    template <typename Graph_T>
+    concept IndexedVertices = std::integral<typename Graph_T::vertex_descriptor>;
+
+    // One bit per vertex index
+    class dense_visited_set {
+    public:
+      explicit dense_visited_set(std::size_t num_vertices)
+        : m_bits((num_vertices + 63) / 64, 0)
+      {
+      }
+
+      bool contains(std::size_t v) const
+      {
+        return m_bits[v / 64] & (std::uint64_t{1} << (v % 64));
+      }
+
+      // Marks v; true if it was not marked before
+      bool insert(std::size_t v)
+      {
+        auto const mask  = std::uint64_t{1} << (v % 64);
+        auto&      word  = m_bits[v / 64];
+        bool const fresh = not(word & mask);
+        word |= mask;
+        return fresh;
+      }
+
+    private:
+      std::vector<std::uint64_t> m_bits;
+    };
+
+    // Fallback for descriptors that are not indices (listS, setS, ...)
+    template <typename VertexDescriptor_T>
+    class hashed_visited_set {
+    public:
+      bool contains(VertexDescriptor_T const& v) const { return m_set.contains(v); }
+      bool insert(VertexDescriptor_T const& v) { return m_set.insert(v).second; }
+
+    private:
+      std::unordered_set<VertexDescriptor_T> m_set;
+    };
+
+    template <typename Graph_T>
+    auto makeVisitedSet(Graph_T const& graph)
+    {
+      if constexpr (IndexedVertices<Graph_T>)
+        return dense_visited_set(boost::num_vertices(graph));
+      else
+        return hashed_visited_set<typename Graph_T::vertex_descriptor>{};
+    }
+
+    /**
+     * FIFO over one flat array. Traversals that mark vertices when they are
+     * enqueued push each vertex at most once, so the array never needs to
+     * wrap and popped slots are simply left behind.
+     */
+    template <typename VertexDescriptor_T>
+    class vertex_queue {
+    public:
+      void reserve(std::size_t n) { m_items.reserve(n); }
+
+      bool empty() const { return m_head == m_items.size(); }
+      void push(VertexDescriptor_T const& v) { m_items.push_back(v); }
+      VertexDescriptor_T pop() { return m_items[m_head++]; }
+
+      void clear()
+      {
+        m_items.clear();
+        m_head = 0;
+      }
+
+    private:
+      std::vector<VertexDescriptor_T> m_items;
+      std::size_t                     m_head{0};
+    };
+
+  }   // namespace detail
+}   // namespace dte3611::graph::utils
+
+#endif   // DTE3611_UTILS_TRAVERSAL_CONTAINERS_H
@@ -0,0 +1,119 @@
+#ifndef DTE3611_UTILS_TRAVERSAL_WORKSPACE_H
+#define DTE3611_UTILS_TRAVERSAL_WORKSPACE_H
+
+#include "traversal_containers.h"
+
+// boost
+#include <boost/graph/graph_traits.hpp>
+
+// stl
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace dte3611::graph::utils
+{
+
+  /**
+   * Per-vertex scratch for many small traversals of one index-descriptor
+   * graph (vecS vertex storage).
+   *
+   * Every vertex carries a stamp against the current epoch: older than the
+   * epoch is unseen, equal is seen, one past is settled. reset() advances
+   * the epoch by two, so starting a new query is O(1) and a query costs
+   * only what it touches; the arrays are rewritten only when the vertex
+   * count changes or, once every 2^31 queries, when the stamps wrap.
+   *
+   * distance, parent, parentEdge and parents are valid for seen vertices
+   * only -- whoever sees a vertex writes them. Each array is allocated on
+   * first use, so a BFS never pays for Dijkstra's parent lists. One
+   * workspace serves one traversal at a time.
+   */
+  template <detail::IndexedVertices Graph_T>
+  class TraversalWorkspace {
+  public:
+    using VertexDescriptor = typename Graph_T::vertex_descriptor;
+    using EdgeDescriptor   = typename Graph_T::edge_descriptor;
+
+    TraversalWorkspace() = default;
+    explicit TraversalWorkspace(Graph_T const& graph) { reset(graph); }
+
+    // Starts a new query; every vertex is unseen afterwards
+    void reset(Graph_T const& graph)
+    {
+      auto const n = static_cast<std::size_t>(boost::num_vertices(graph));
+      if (n != m_stamp.size()) {
+        m_stamp.assign(n, 0);
+        m_epoch = 2;
+      }
+      else if (m_epoch >= std::numeric_limits<std::uint32_t>::max() - 2) {
+        std::ranges::fill(m_stamp, 0u);
+        m_epoch = 2;
+      }
+      else
+        m_epoch += 2;
+
+      m_queue.clear();
+      m_stack.clear();
+    }
+
+    std::size_t size() const { return m_stamp.size(); }
+
+    // Visited-set interface of the traversals -- "visited" means seen
+    bool contains(VertexDescriptor v) const { return m_stamp[v] >= m_epoch; }
+
+    // Marks v seen; true if it was unseen
+    bool insert(VertexDescriptor v)
+    {
+      if (m_stamp[v] >= m_epoch) return false;
+      m_stamp[v] = m_epoch;
+      return true;
+    }
+
+    bool settled(VertexDescriptor v) const { return m_stamp[v] == m_epoch + 1; }
+
+    // Marks v settled; true if it was not settled already
+    bool settle(VertexDescriptor v)
+    {
+      if (m_stamp[v] == m_epoch + 1) return false;
+      m_stamp[v] = m_epoch + 1;
+      return true;
+    }
+
+    double& distance(VertexDescriptor v) { return used(m_distance)[v]; }
+    VertexDescriptor& parent(VertexDescriptor v) { return used(m_parent)[v]; }
+    EdgeDescriptor& parentEdge(VertexDescriptor v) { return used(m_parent_edge)[v]; }
+
+    // Shortest-path parents; keep their capacity across queries
+    std::vector<VertexDescriptor>& parents(VertexDescriptor v)
+    {
+      return used(m_parents)[v];
+    }
+
+    detail::vertex_queue<VertexDescriptor>& queue() { return m_queue; }
+    std::vector<VertexDescriptor>&          stack() { return m_stack; }
+
+  private:
+    // Sizes an array on first use, keeps it sized from then on
+    template <typename Value_T>
+    std::vector<Value_T>& used(std::vector<Value_T>& values)
+    {
+      if (values.size() != m_stamp.size()) values.resize(m_stamp.size());
+      return values;
+    }
+
+    std::vector<std::uint32_t>                 m_stamp;
+    std::uint32_t                              m_epoch{2};
+    std::vector<double>                        m_distance;
+    std::vector<VertexDescriptor>              m_parent;
+    std::vector<EdgeDescriptor>                m_parent_edge;
+    std::vector<std::vector<VertexDescriptor>> m_parents;
+    detail::vertex_queue<VertexDescriptor>     m_queue;
+    std::vector<VertexDescriptor>              m_stack;
+  };
+
+}   // namespace dte3611::graph::utils
+
+#endif   // DTE3611_UTILS_TRAVERSAL_WORKSPACE_H
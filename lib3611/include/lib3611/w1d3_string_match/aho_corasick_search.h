@@ -0,0 +1,443 @@
+#ifndef DTE3611_WEEK1_STRING_MATCH_AHO_CORASICK_SEARCH_H
+#define DTE3611_WEEK1_STRING_MATCH_AHO_CORASICK_SEARCH_H
+
+// utils
+#include "../utils/string_match_utils.h"
+
+// stl
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <queue>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+namespace dte3611::string_match::algorithms
+{
+
+  // A dictionary hit: pattern index and offset of the match start
+  struct aho_corasick_match {
+    std::size_t pattern_id;
+    std::size_t offset;
+
+    auto operator<=>(aho_corasick_match const&) const = default;
+  };
+
+
+  /**
+   * Aho-Corasick automaton over a dictionary of patterns.
+   *
+   * Byte keys use a dense DFA: failure transitions are folded into a flat
+   * [state x byte-class] table, where only bytes occurring in the dictionary
+   * get a column of their own. Other (totally ordered) keys use a sparse
+   * layout -- per-state sorted edge runs in flat arrays, plus failure links.
+   *
+   * Outputs are stored once per state and chained through dictionary-suffix
+   * links. Empty patterns never report a hit.
+   */
+  template <typename Key_T>
+  requires utils::detail::is_byte_key_v<Key_T> or std::totally_ordered<Key_T>
+  class aho_corasick_automaton {
+
+    using State = std::uint32_t;
+
+    static constexpr bool  dense = utils::detail::is_byte_key_v<Key_T>;
+    static constexpr State root  = 0;
+    static constexpr State none  = std::numeric_limits<State>::max();
+
+  public:
+    using Match = aho_corasick_match;
+
+    /**
+     * Incremental scanner -- feed() a haystack in consecutive pieces; match
+     * offsets count from the start of the first piece.
+     */
+    class scanner {
+    public:
+      explicit scanner(aho_corasick_automaton const& automaton)
+        : m_automaton{&automaton}
+      {
+      }
+
+      template <std::input_iterator           Iterator_T,
+                std::sentinel_for<Iterator_T> Sentinel_T,
+                typename Sink_T, typename Projection_T = std::identity>
+      requires std::invocable<Sink_T&, Match const&>
+      void feed(Iterator_T first, Sentinel_T last, Sink_T&& sink,
+                Projection_T proj = {})
+      {
+        for (; first != last; ++first, ++m_position) {
+          m_state = m_automaton->next(m_state, std::invoke(proj, *first));
+          m_automaton->report(m_state, m_position, sink);
+        }
+      }
+
+      template <std::ranges::input_range Range_T, typename Sink_T,
+                typename Projection_T = std::identity>
+      requires std::invocable<Sink_T&, Match const&>
+      void feed(Range_T&& range, Sink_T&& sink, Projection_T proj = {})
+      {
+        feed(std::ranges::begin(range), std::ranges::end(range), sink,
+             std::move(proj));
+      }
+
+      // Forget the stream so far
+      void reset()
+      {
+        m_state    = root;
+        m_position = 0;
+      }
+
+    private:
+      aho_corasick_automaton const* m_automaton;
+      State                         m_state{root};
+      std::size_t                   m_position{0};
+    };
+
+
+    template <std::forward_iterator           P_Iterator_T,
+              std::sentinel_for<P_Iterator_T> P_Sentinel_T,
+              typename S_Projection_T = std::identity>
+    requires std::ranges::forward_range<std::iter_reference_t<P_Iterator_T>>
+    aho_corasick_automaton(P_Iterator_T p_first, P_Sentinel_T p_last,
+                           S_Projection_T s_proj = {})
+    {
+      std::vector<std::vector<Key_T>> patterns;
+      for (; p_first != p_last; ++p_first) {
+        auto&& pattern = *p_first;
+        patterns.push_back(utils::detail::materializePattern<Key_T>(
+          std::ranges::begin(pattern), std::ranges::end(pattern), s_proj));
+      }
+      build(patterns);
+    }
+
+    template <std::ranges::forward_range P_Range_T,
+              typename S_Projection_T = std::identity>
+    requires std::ranges::forward_range<std::ranges::range_reference_t<P_Range_T>>
+    explicit aho_corasick_automaton(P_Range_T&& patterns,
+                                    S_Projection_T s_proj = {})
+      : aho_corasick_automaton(std::ranges::begin(patterns),
+                               std::ranges::end(patterns), std::move(s_proj))
+    {
+    }
+
+    std::size_t patternCount() const { return m_pattern_lengths.size(); }
+    std::size_t stateCount() const { return m_fail.size(); }
+
+    // Report every hit in [first, last) to sink, in order of match end
+    template <std::input_iterator           Iterator_T,
+              std::sentinel_for<Iterator_T> Sentinel_T,
+              typename Sink_T, typename Projection_T = std::identity>
+    requires std::invocable<Sink_T&, Match const&>
+    void forEachMatch(Iterator_T first, Sentinel_T last, Sink_T&& sink,
+                      Projection_T proj = {}) const
+    {
+      scanner(*this).feed(std::move(first), std::move(last), sink,
+                          std::move(proj));
+    }
+
+    template <std::input_iterator           Iterator_T,
+              std::sentinel_for<Iterator_T> Sentinel_T,
+              typename Projection_T = std::identity>
+    std::vector<Match> findAll(Iterator_T first, Sentinel_T last,
+                               Projection_T proj = {}) const
+    {
+      std::vector<Match> hits;
+      forEachMatch(std::move(first), std::move(last),
+                   [&hits](Match const& hit) { hits.push_back(hit); },
+                   std::move(proj));
+      return hits;
+    }
+
+    template <std::ranges::input_range Range_T,
+              typename Projection_T = std::identity>
+    std::vector<Match> findAll(Range_T&& range, Projection_T proj = {}) const
+    {
+      return findAll(std::ranges::begin(range), std::ranges::end(range),
+                     std::move(proj));
+    }
+
+  private:
+    /*********
+     * Build
+     */
+    void build(std::vector<std::vector<Key_T>> const& patterns)
+    {
+      m_pattern_lengths.reserve(patterns.size());
+      for (auto const& p : patterns) m_pattern_lengths.push_back(p.size());
+
+      // Trie -- temporary per-state child maps (sparse) or rows (dense)
+      std::vector<std::vector<std::size_t>> outputs(1);
+      std::vector<std::map<Key_T, State>>   children;
+
+      if constexpr (dense) {
+        m_class.fill(0);
+        for (auto const& p : patterns)
+          for (auto const& k : p)
+            if (m_class[utils::detail::byteIndex(k)] == 0)
+              m_class[utils::detail::byteIndex(k)]
+                = static_cast<std::uint16_t>(++m_width);
+        ++m_width;   // column 0 -- bytes absent from the dictionary
+        m_delta.assign(m_width, none);
+      }
+      else {
+        children.resize(1);
+      }
+
+      for (std::size_t id = 0; id < patterns.size(); ++id) {
+        if (patterns[id].empty()) continue;
+
+        State s = root;
+        for (auto const& k : patterns[id]) {
+          State t = child(s, k, children);
+          if (t == none) {
+            t = static_cast<State>(outputs.size());
+            outputs.emplace_back();
+            if constexpr (dense) {
+              m_delta[s * m_width + m_class[utils::detail::byteIndex(k)]] = t;
+              m_delta.resize(m_delta.size() + m_width, none);
+            }
+            else {
+              children[s].emplace(k, t);
+              children.emplace_back();
+            }
+          }
+          s = t;
+        }
+        outputs[s].push_back(id);
+      }
+
+      // Failure and dictionary-suffix links in BFS order -- a state's
+      // failure target is shallower, hence already linked
+      auto const n_states = outputs.size();
+      m_fail.assign(n_states, root);
+      m_dict_link.assign(n_states, none);
+
+      std::queue<State> bfs;
+      auto              link = [&](State t, State f) {
+        m_fail[t]      = f;
+        m_dict_link[t] = outputs[f].empty() ? m_dict_link[f] : f;
+        bfs.push(t);
+      };
+
+      bfs.push(root);
+      while (not bfs.empty()) {
+        State const s = bfs.front();
+        bfs.pop();
+
+        if constexpr (dense) {
+          // Complete the DFA row: missing edges borrow the failure target's
+          for (std::size_t c = 0; c < m_width; ++c) {
+            State&      t = m_delta[s * m_width + c];
+            State const f = s == root ? root : m_delta[m_fail[s] * m_width + c];
+            if (t == none)
+              t = f;
+            else
+              link(t, f);
+          }
+        }
+        else {
+          for (auto const& [k, t] : children[s])
+            link(t, s == root ? root : failTarget(m_fail[s], k, children));
+        }
+      }
+
+      // Flatten outputs
+      m_out_offsets.assign(n_states + 1, 0);
+      for (std::size_t s = 0; s < n_states; ++s)
+        m_out_offsets[s + 1] = m_out_offsets[s] + outputs[s].size();
+      m_out_ids.reserve(m_out_offsets.back());
+      for (auto const& out : outputs)
+        m_out_ids.insert(m_out_ids.end(), out.begin(), out.end());
+
+      // Flatten the sparse edges
+      if constexpr (not dense) {
+        m_edge_offsets.assign(n_states + 1, 0);
+        for (std::size_t s = 0; s < n_states; ++s)
+          m_edge_offsets[s + 1] = m_edge_offsets[s] + children[s].size();
+        m_edge_keys.reserve(m_edge_offsets.back());
+        m_edge_targets.reserve(m_edge_offsets.back());
+        for (auto const& c : children)
+          for (auto const& [k, t] : c) {
+            m_edge_keys.push_back(k);
+            m_edge_targets.push_back(t);
+          }
+      }
+    }
+
+    // Trie child during construction
+    State child(State s, Key_T const& k,
+                std::vector<std::map<Key_T, State>> const& children) const
+    {
+      if constexpr (dense) {
+        return m_delta[s * m_width + m_class[utils::detail::byteIndex(k)]];
+      }
+      else {
+        auto const found = children[s].find(k);
+        return found == children[s].end() ? none : found->second;
+      }
+    }
+
+    // Goto-with-failure during construction (sparse only)
+    State failTarget(State s, Key_T const& k,
+                     std::vector<std::map<Key_T, State>> const& children) const
+    {
+      for (;;) {
+        if (State const t = child(s, k, children); t != none) return t;
+        if (s == root) return root;
+        s = m_fail[s];
+      }
+    }
+
+    /*********
+     * Scan
+     */
+    template <typename Value_T>
+    State next(State s, Value_T const& hv) const
+    {
+      if constexpr (dense) {
+        // Values outside the key range fall into the "absent" column
+        std::size_t c = m_class[utils::detail::byteIndex(hv)];
+        if constexpr (not utils::detail::is_byte_key_v<Value_T>)
+          if (static_cast<Value_T>(static_cast<Key_T>(hv)) != hv) c = 0;
+        return m_delta[s * m_width + c];
+      }
+      else {
+        // A value that does not survive the round trip through Key_T matches
+        // no edge; following the failure links from any state ends at root
+        Key_T const k = static_cast<Key_T>(hv);
+        if constexpr (std::is_arithmetic_v<Value_T> and std::is_arithmetic_v<Key_T>
+                      and not std::is_same_v<Value_T, Key_T>)
+          if (static_cast<Value_T>(k) != hv) return root;
+        for (;;) {
+          auto const b = m_edge_keys.begin()
+                       + static_cast<std::ptrdiff_t>(m_edge_offsets[s]);
+          auto const e = m_edge_keys.begin()
+                       + static_cast<std::ptrdiff_t>(m_edge_offsets[s + 1]);
+          auto const it = std::lower_bound(b, e, k);
+          if (it != e and not(k < *it))
+            return m_edge_targets[static_cast<std::size_t>(
+              it - m_edge_keys.begin())];
+          if (s == root) return root;
+          s = m_fail[s];
+        }
+      }
+    }
+
+    bool hasOutput(State s) const
+    {
+      return m_out_offsets[s + 1] != m_out_offsets[s];
+    }
+
+    template <typename Sink_T>
+    void report(State s, std::size_t position, Sink_T& sink) const
+    {
+      if (not hasOutput(s)) s = m_dict_link[s];
+      for (; s != none; s = m_dict_link[s])
+        for (auto i = m_out_offsets[s]; i < m_out_offsets[s + 1]; ++i) {
+          auto const id = m_out_ids[i];
+          std::invoke(sink, Match{id, position + 1 - m_pattern_lengths[id]});
+        }
+    }
+
+    // Dictionary
+    std::vector<std::size_t> m_pattern_lengths;
+
+    // Dense layout
+    std::array<std::uint16_t, 256> m_class{};
+    std::size_t                    m_width{0};
+    std::vector<State>             m_delta;
+
+    // Sparse layout
+    std::vector<std::size_t> m_edge_offsets;
+    std::vector<Key_T>       m_edge_keys;
+    std::vector<State>       m_edge_targets;
+
+    // Failure, output and dictionary-suffix links
+    std::vector<State>       m_fail;
+    std::vector<std::size_t> m_out_offsets;
+    std::vector<std::size_t> m_out_ids;
+    std::vector<State>       m_dict_link;
+  };
+
+
+  namespace detail
+  {
+
+    struct aho_corasick_search_fn {
+
+      /**************************
+       *  Iterator Range Operator
+       */
+
+      // Type Generics
+      template <std::forward_iterator           Iterator_T,
+                std::sentinel_for<Iterator_T>   Sentinel_T,
+                std::forward_iterator           P_Iterator_T,
+                std::sentinel_for<P_Iterator_T> P_Sentinel_T,
+                typename Projection_T   = std::identity,
+                typename S_Projection_T = std::identity>
+
+      // Algorithm type requirements
+      requires std::ranges::forward_range<std::iter_reference_t<P_Iterator_T>>
+
+      // Return value -- every hit, in order of match end
+      std::vector<aho_corasick_match>
+
+      // Call-operator signature
+      operator()(Iterator_T first, Sentinel_T last,
+                 P_Iterator_T p_first, P_Sentinel_T p_last,
+                 Projection_T proj = {}, S_Projection_T s_proj = {}) const
+      {
+        using PatKey = utils::detail::pattern_key_t<
+          std::ranges::iterator_t<std::iter_reference_t<P_Iterator_T>>,
+          S_Projection_T>;
+
+        return aho_corasick_automaton<PatKey>(p_first, p_last,
+                                              std::move(s_proj))
+          .findAll(first, last, std::move(proj));
+      }
+
+
+      /******************
+       *  Ranges Operator
+       */
+
+      // Type Generics
+      template <std::ranges::forward_range Range_T,
+                std::ranges::forward_range P_Range_T,
+                typename Projection_T   = std::identity,
+                typename S_Projection_T = std::identity>
+
+      // Algorithm type requirements
+      requires std::ranges::forward_range<std::ranges::range_reference_t<P_Range_T>>
+
+      // Return value -- every hit, in order of match end
+      std::vector<aho_corasick_match>
+
+      // Call-operator signature
+      operator()(Range_T&& range, P_Range_T&& patterns,
+                 Projection_T proj = {}, S_Projection_T s_proj = {}) const
+      {
+        return (*this)(std::ranges::begin(range), std::ranges::end(range),
+                       std::ranges::begin(patterns), std::ranges::end(patterns),
+                       std::move(proj), std::move(s_proj));
+      }
+
+    };
+
+  }   // namespace detail
+
+  // Niebloid API Instantiation
+  inline constexpr detail::aho_corasick_search_fn aho_corasick_search{};
+
+}   // namespace dte3611::string_match::algorithms
+
+#endif   // DTE3611_WEEK1_STRING_MATCH_AHO_CORASICK_SEARCH_H
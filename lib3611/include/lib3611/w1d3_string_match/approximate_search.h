@@ -0,0 +1,374 @@
+#ifndef DTE3611_WEEK1_STRING_MATCH_APPROXIMATE_SEARCH_H
+#define DTE3611_WEEK1_STRING_MATCH_APPROXIMATE_SEARCH_H
+
+// utils
+#include "../utils/string_match_utils.h"
+
+// stl
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace dte3611::string_match::algorithms
+{
+
+  // A match of the pattern within the error budget ending just before end
+  template <typename Iterator_T>
+  struct approximate_match {
+    Iterator_T  end;
+    std::size_t errors;
+
+    bool operator==(approximate_match const&) const = default;
+  };
+
+  namespace detail
+  {
+
+    /**
+     * Per-symbol match masks of a pattern, 64 pattern positions per word:
+     * bit i of masks(c) is set iff pred(c, pat[i]). Dense (256 rows) for
+     * byte keys, hashed for other hashable keys, and computed per symbol by
+     * scanning the pattern for non-equality predicates.
+     */
+    template <typename Key_T, typename BinaryPredicate_T>
+    class pattern_bitmasks {
+
+      static constexpr bool equality
+        = utils::detail::is_equality_predicate_v<BinaryPredicate_T>;
+      static constexpr bool dense
+        = equality and utils::detail::is_byte_key_v<Key_T>;
+      static constexpr bool hashed
+        = equality and not dense
+          and requires(Key_T const& k) { std::hash<Key_T>{}(k); };
+
+      using MaskTable = std::conditional_t<
+        dense, std::vector<std::uint64_t>,
+        std::conditional_t<hashed,
+                           std::unordered_map<Key_T, std::vector<std::uint64_t>>,
+                           std::monostate>>;
+
+    public:
+      pattern_bitmasks(std::vector<Key_T> pat, BinaryPredicate_T pred)
+        : m_pat{std::move(pat)},
+          m_blocks{(m_pat.size() + 63) / 64},
+          m_pred{std::move(pred)}
+      {
+        if constexpr (dense) {
+          m_table.assign(256 * m_blocks, 0);
+          for (std::size_t i = 0; i < m_pat.size(); ++i)
+            m_table[utils::detail::byteIndex(m_pat[i]) * m_blocks + i / 64]
+              |= std::uint64_t{1} << (i % 64);
+        }
+        else if constexpr (hashed) {
+          for (std::size_t i = 0; i < m_pat.size(); ++i) {
+            auto& row = m_table[m_pat[i]];
+            row.resize(m_blocks, 0);
+            row[i / 64] |= std::uint64_t{1} << (i % 64);
+          }
+        }
+      }
+
+      std::size_t size() const { return m_pat.size(); }
+      std::size_t blocks() const { return m_blocks; }
+
+      // Masks for one haystack symbol; scratch holds blocks() words
+      template <typename Value_T>
+      std::span<std::uint64_t const> masks(Value_T const&           hv,
+                                           std::span<std::uint64_t> scratch) const
+      {
+        if constexpr (dense) {
+          return std::span{m_table}.subspan(utils::detail::byteIndex(hv) * m_blocks,
+                                            m_blocks);
+        }
+        else if constexpr (hashed
+                           and std::convertible_to<Value_T const&, Key_T>) {
+          auto const found = m_table.find(static_cast<Key_T>(hv));
+          if (found != m_table.end()) return found->second;
+          std::ranges::fill(scratch, 0);
+          return scratch;
+        }
+        else {
+          std::ranges::fill(scratch, 0);
+          for (std::size_t i = 0; i < m_pat.size(); ++i)
+            if (std::invoke(m_pred, hv, m_pat[i]))
+              scratch[i / 64] |= std::uint64_t{1} << (i % 64);
+          return scratch;
+        }
+      }
+
+    private:
+      std::vector<Key_T>                      m_pat;
+      std::size_t                             m_blocks;
+      MaskTable                               m_table{};
+      [[no_unique_address]] BinaryPredicate_T m_pred;
+    };
+
+    template <typename S_Iterator_T, typename S_Sentinel_T,
+              typename BinaryPredicate_T, typename S_Projection_T>
+    auto makePatternBitmasks(S_Iterator_T s_first, S_Sentinel_T s_last,
+                             BinaryPredicate_T pred, S_Projection_T& s_proj)
+    {
+      using PatKey = utils::detail::pattern_key_t<S_Iterator_T, S_Projection_T>;
+      return pattern_bitmasks<PatKey, BinaryPredicate_T>(
+        utils::detail::materializePattern<PatKey>(s_first, s_last, s_proj),
+        std::move(pred));
+    }
+
+    // Every end position matches the empty pattern
+    template <typename Iterator_T, typename Sentinel_T>
+    std::vector<approximate_match<Iterator_T>> matchEverywhere(Iterator_T first,
+                                                               Sentinel_T last)
+    {
+      std::vector<approximate_match<Iterator_T>> hits{{first, 0}};
+      for (; first != last;) hits.push_back({++first, 0});
+      return hits;
+    }
+
+
+    /**
+     * Shift-And (Bitap) with up to k mismatches (Hamming distance), after
+     * Baeza-Yates & Gonnet / Wu & Manber: one 64-bit state word per error
+     * level, O(n k) word operations. Patterns are limited to 64 symbols.
+     */
+    struct bitap_search_fn {
+
+      /**************************
+       *  Iterator Range Operator
+       */
+
+      // Type Generics
+      template <std::forward_iterator           Iterator_T,
+                std::sentinel_for<Iterator_T>   Sentinel_T,
+                std::forward_iterator           S_Iterator_T,
+                std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<Iterator_T, S_Iterator_T,
+                                          BinaryPredicate_T, Projection_T,
+                                          S_Projection_T>
+
+      // Return value
+      std::vector<approximate_match<Iterator_T>>
+
+      // Call-operator signature
+      operator()(Iterator_T first, Sentinel_T last,
+                 S_Iterator_T s_first, S_Sentinel_T s_last,
+                 std::size_t max_mismatches, BinaryPredicate_T pred = {},
+                 Projection_T proj = {}, S_Projection_T s_proj = {}) const
+      {
+        auto const bitmasks
+          = makePatternBitmasks(s_first, s_last, std::move(pred), s_proj);
+
+        std::size_t const m = bitmasks.size();
+        if (m == 0) return matchEverywhere(first, last);
+        if (m > 64)
+          throw std::length_error("bitap_search: pattern longer than 64");
+
+        std::size_t const   k    = std::min(max_mismatches, m);
+        std::uint64_t const high = std::uint64_t{1} << (m - 1);
+
+        // state[i] bit j: pattern prefix of length j + 1 ends here with
+        // at most i mismatches
+        std::vector<std::uint64_t> state(k + 1, 0);
+        std::uint64_t              scratch = 0;
+
+        std::vector<approximate_match<Iterator_T>> hits;
+        for (; first != last;) {
+          std::uint64_t const eq
+            = bitmasks.masks(std::invoke(proj, *first), std::span{&scratch, 1})[0];
+          ++first;
+
+          std::uint64_t below = state[0];
+          state[0]            = ((state[0] << 1) | 1) & eq;
+          for (std::size_t i = 1; i <= k; ++i) {
+            std::uint64_t const old = state[i];
+            state[i] = (((old << 1) | 1) & eq) | ((below << 1) | 1);
+            below    = old;
+          }
+
+          for (std::size_t i = 0; i <= k; ++i)
+            if (state[i] & high) {
+              hits.push_back({first, i});
+              break;
+            }
+        }
+        return hits;
+      }
+
+      /******************
+       *  Ranges Operator
+       */
+
+      // Type Generics
+      template <std::ranges::forward_range Range_T,
+                std::ranges::forward_range S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<
+        std::ranges::iterator_t<Range_T>, std::ranges::iterator_t<S_Range_T>,
+        BinaryPredicate_T, Projection_T, S_Projection_T>
+
+      // Return value
+      std::vector<approximate_match<std::ranges::iterator_t<Range_T>>>
+
+      // Call-operator signature
+      operator()(Range_T&& range, S_Range_T&& s_range, std::size_t max_mismatches,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        return (*this)(std::ranges::begin(range), std::ranges::end(range),
+                       std::ranges::begin(s_range), std::ranges::end(s_range),
+                       max_mismatches, std::move(pred), std::move(proj),
+                       std::move(s_proj));
+      }
+    };
+
+
+    /**
+     * Myers' bit-vector algorithm for approximate matching under edit
+     * distance, in Hyyrö's block formulation: the DP column is kept as
+     * vertical +1/-1 deltas in ceil(m / 64) words, carrying the horizontal
+     * delta from block to block. O(n ceil(m / 64)) word operations.
+     */
+    struct myers_search_fn {
+
+      /**************************
+       *  Iterator Range Operator
+       */
+
+      // Type Generics
+      template <std::forward_iterator           Iterator_T,
+                std::sentinel_for<Iterator_T>   Sentinel_T,
+                std::forward_iterator           S_Iterator_T,
+                std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<Iterator_T, S_Iterator_T,
+                                          BinaryPredicate_T, Projection_T,
+                                          S_Projection_T>
+
+      // Return value
+      std::vector<approximate_match<Iterator_T>>
+
+      // Call-operator signature
+      operator()(Iterator_T first, Sentinel_T last,
+                 S_Iterator_T s_first, S_Sentinel_T s_last,
+                 std::size_t max_edits, BinaryPredicate_T pred = {},
+                 Projection_T proj = {}, S_Projection_T s_proj = {}) const
+      {
+        auto const bitmasks
+          = makePatternBitmasks(s_first, s_last, std::move(pred), s_proj);
+
+        std::size_t const m = bitmasks.size();
+        if (m == 0) return matchEverywhere(first, last);
+
+        std::size_t const   blocks = bitmasks.blocks();
+        std::uint64_t const last_bit = std::uint64_t{1} << ((m - 1) % 64);
+
+        std::vector<std::uint64_t> pv(blocks, ~std::uint64_t{0}), mv(blocks, 0);
+        std::vector<std::uint64_t> scratch(blocks);
+        std::size_t                score = m;   // D[m][j]
+
+        std::vector<approximate_match<Iterator_T>> hits;
+        if (score <= max_edits) hits.push_back({first, score});
+
+        for (; first != last;) {
+          auto const eqs = bitmasks.masks(std::invoke(proj, *first), scratch);
+          ++first;
+
+          // Horizontal delta entering block b from below; the top row of a
+          // search is all zeros, so nothing enters block 0
+          int hin = 0;
+          for (std::size_t b = 0; b < blocks; ++b) {
+            std::uint64_t const neg = hin < 0 ? 1 : 0;
+            std::uint64_t const pos = hin > 0 ? 1 : 0;
+
+            std::uint64_t       eq = eqs[b];
+            std::uint64_t const xv = eq | mv[b];
+            eq |= neg;
+            std::uint64_t const xh = (((eq & pv[b]) + pv[b]) ^ pv[b]) | eq;
+            std::uint64_t       ph = mv[b] | ~(xh | pv[b]);
+            std::uint64_t       mh = pv[b] & xh;
+
+            if (b + 1 == blocks) {
+              if (ph & last_bit) ++score;
+              else if (mh & last_bit) --score;
+            }
+            else
+              hin = (ph >> 63) ? 1 : (mh >> 63) ? -1 : 0;
+
+            ph = (ph << 1) | pos;
+            mh = (mh << 1) | neg;
+            pv[b] = mh | ~(xv | ph);
+            mv[b] = ph & xv;
+          }
+
+          if (score <= max_edits) hits.push_back({first, score});
+        }
+        return hits;
+      }
+
+      /******************
+       *  Ranges Operator
+       */
+
+      // Type Generics
+      template <std::ranges::forward_range Range_T,
+                std::ranges::forward_range S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<
+        std::ranges::iterator_t<Range_T>, std::ranges::iterator_t<S_Range_T>,
+        BinaryPredicate_T, Projection_T, S_Projection_T>
+
+      // Return value
+      std::vector<approximate_match<std::ranges::iterator_t<Range_T>>>
+
+      // Call-operator signature
+      operator()(Range_T&& range, S_Range_T&& s_range, std::size_t max_edits,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        return (*this)(std::ranges::begin(range), std::ranges::end(range),
+                       std::ranges::begin(s_range), std::ranges::end(s_range),
+                       max_edits, std::move(pred), std::move(proj),
+                       std::move(s_proj));
+      }
+    };
+
+  }   // namespace detail
+
+  /**
+   * Niebloid API Instantiation -- approximate search. Both report every end
+   * position (one past the last matched element) at which some substring
+   * matches the pattern within the budget, together with its error count.
+   *
+   *  bitap_search  k mismatches (substitutions only), patterns <= 64
+   *  myers_search  k edits (insertions, deletions, substitutions), any length
+   */
+  inline constexpr detail::bitap_search_fn bitap_search{};
+  inline constexpr detail::myers_search_fn myers_search{};
+
+}   // namespace dte3611::string_match::algorithms
+
+#endif   // DTE3611_WEEK1_STRING_MATCH_APPROXIMATE_SEARCH_H
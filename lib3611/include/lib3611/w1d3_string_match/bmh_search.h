@@ -1,9 +1,18 @@
 #ifndef DTE3611_WEEK1_STRING_MATCH_BOYER_MORE_HORSPOOL_SEARCH_H
 #define DTE3611_WEEK1_STRING_MATCH_BOYER_MORE_HORSPOOL_SEARCH_H
 
+// utils
+#include "../utils/string_match_utils.h"
+
 // stl
 #include <iterator>
 #include <ranges>
+#include <array>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 
 namespace dte3611::string_match::algorithms
 {
@@ -11,8 +20,127 @@ namespace dte3611::string_match::algorithms
   namespace detail
   {
 
+    /**
+     * Preprocessed Boyer-Moore-Horspool matcher -- projected pattern and its
+     * bad-character shift table. The table is dense (256 entries) for byte
+     * keys, hashed for other hashable keys, and absent for non-equality
+     * predicates, where the shift is found by scanning the pattern instead.
+     */
+    template <typename Key_T, typename BinaryPredicate_T = std::ranges::equal_to>
+    class bmh_matcher {
+
+      static constexpr bool equality
+        = utils::detail::is_equality_predicate_v<BinaryPredicate_T>;
+      static constexpr bool dense
+        = equality and utils::detail::is_byte_key_v<Key_T>;
+      static constexpr bool hashed
+        = equality and not dense
+          and requires(Key_T const& k) { std::hash<Key_T>{}(k); };
+
+      using ShiftTable = std::conditional_t<
+        dense, std::array<std::size_t, 256>,
+        std::conditional_t<hashed, std::unordered_map<Key_T, std::size_t>,
+                           std::monostate>>;
+
+    public:
+      template <std::forward_iterator           S_Iterator_T,
+                std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+                typename S_Projection_T = std::identity>
+      constexpr bmh_matcher(S_Iterator_T s_first, S_Sentinel_T s_last,
+                            BinaryPredicate_T pred   = {},
+                            S_Projection_T    s_proj = {})
+        : m_pat{utils::detail::materializePattern<Key_T>(s_first, s_last,
+                                                          s_proj)},
+          m_pred{std::move(pred)}
+      {
+        const std::size_t m = m_pat.size();
+
+        // Bad-character shifts: distance from the rightmost occurrence in
+        // pat[0 .. m-2] to the end of the pattern
+        if constexpr (dense) {
+          m_shift.fill(m);
+          for (std::size_t i = 0; i + 1 < m; ++i)
+            m_shift[utils::detail::byteIndex(m_pat[i])] = m - 1 - i;
+        }
+        else if constexpr (hashed) {
+          for (std::size_t i = 0; i + 1 < m; ++i)
+            m_shift.insert_or_assign(m_pat[i], m - 1 - i);
+        }
+      }
+
+      constexpr std::size_t size() const { return m_pat.size(); }
+
+      template <std::forward_iterator         Iterator_T,
+                std::sentinel_for<Iterator_T> Sentinel_T,
+                typename Projection_T = std::identity>
+      constexpr Iterator_T find(Iterator_T first, Sentinel_T last,
+                                Projection_T proj = {}) const
+      {
+        using Diff = std::iter_difference_t<Iterator_T>;
+
+        const std::size_t m = m_pat.size();
+        if (m == 0) return first;
+
+        // Window [win, tail]; tail is the last window element
+        Iterator_T win  = first;
+        Iterator_T tail = first;
+        if (std::ranges::advance(tail, static_cast<Diff>(m - 1), last) != 0)
+          return tail;   // haystack shorter than pattern
+
+        while (tail != last) {
+          auto&& hv = std::invoke(proj, *tail);
+
+          if (std::invoke(m_pred, hv, m_pat[m - 1])) {
+            Iterator_T  it = win;
+            std::size_t j  = 0;
+            while (j + 1 < m
+                   && std::invoke(m_pred, std::invoke(proj, *it), m_pat[j])) {
+              ++it;
+              ++j;
+            }
+            if (j + 1 == m) return win;   // full match
+          }
+
+          const auto s = static_cast<Diff>(shift(hv));
+          std::ranges::advance(win, s);
+          std::ranges::advance(tail, s, last);
+        }
+        return tail;   // no match
+      }
+
+    private:
+      template <typename Value_T>
+      constexpr std::size_t shift(Value_T const& hv) const
+      {
+        const std::size_t m = m_pat.size();
+
+        if constexpr (dense) {
+          return m_shift[utils::detail::byteIndex(hv)];
+        }
+        else if constexpr (hashed
+                           and std::convertible_to<Value_T const&, Key_T>) {
+          auto const found = m_shift.find(static_cast<Key_T>(hv));
+          return found == m_shift.end() ? m : found->second;
+        }
+        else {
+          for (std::size_t k = m - 1; k-- > 0;)
+            if (std::invoke(m_pred, hv, m_pat[k])) return m - 1 - k;
+          return m;
+        }
+      }
+
+      std::vector<Key_T>                       m_pat;
+      [[no_unique_address]] ShiftTable         m_shift{};
+      [[no_unique_address]] BinaryPredicate_T  m_pred;
+    };
+
+
     struct bmh_search_fn {
 
+      // Preprocessed matcher type -- see compile_pattern
+      template <typename Key_T, typename BinaryPredicate_T>
+      using matcher = bmh_matcher<Key_T, BinaryPredicate_T>;
+
       /**************************
        *  Iterator Range Operator
        */
@@ -35,13 +163,18 @@ namespace dte3611::string_match::algorithms
       constexpr Iterator_T
 
       // Call-operator signature
-      operator()(Iterator_T /*first*/, Sentinel_T last,
-                 S_Iterator_T /*s_first*/, S_Sentinel_T /*s_last*/,
-                 BinaryPredicate_T /*pred*/ = {}, Projection_T /*proj*/ = {},
-                 S_Projection_T /*s_proj*/ = {}) const
+      operator()(Iterator_T first, Sentinel_T last,
+                 S_Iterator_T s_first, S_Sentinel_T s_last,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
       {
-        return last;
-        //      static_assert( false, "Complete the code" );
+        // Empty pattern matches at first
+        if (s_first == s_last) return first;
+
+        using PatKey = utils::detail::pattern_key_t<S_Iterator_T, S_Projection_T>;
+        return bmh_matcher<PatKey, BinaryPredicate_T>(
+                 s_first, s_last, std::move(pred), std::move(s_proj))
+          .find(first, last, std::move(proj));
       }
 
 
@@ -0,0 +1,158 @@
+#ifndef DTE3611_WEEK1_STRING_MATCH_COMPILED_PATTERN_H
+#define DTE3611_WEEK1_STRING_MATCH_COMPILED_PATTERN_H
+
+// engines
+#include "naive_search.h"
+#include "kmp_search.h"
+#include "bmh_search.h"
+#include "kr_search.h"
+#include "two_way_search.h"
+
+// utils
+#include "../utils/string_match_utils.h"
+
+// stl
+#include <iterator>
+#include <ranges>
+#include <functional>
+
+namespace dte3611::string_match::algorithms
+{
+
+  /**
+   * A pattern preprocessed once by one of the search engines. Every call to
+   * search() reuses the tables built at compile time and costs only the scan.
+   *
+   *   auto const pat = compile_pattern<kmp_search>(std::string_view{"needle"});
+   *   for (auto const& record : records)
+   *     if (pat.search(record) != record.end()) ...
+   */
+  template <typename Matcher_T>
+  class compiled_pattern {
+  public:
+    using Matcher = Matcher_T;
+
+    constexpr explicit compiled_pattern(Matcher_T matcher)
+      : m_matcher{std::move(matcher)}
+    {
+    }
+
+    // Pattern length
+    constexpr std::size_t size() const { return m_matcher.size(); }
+
+    /**************************
+     *  Iterator Range Search
+     */
+    template <std::forward_iterator         Iterator_T,
+              std::sentinel_for<Iterator_T> Sentinel_T,
+              typename Projection_T = std::identity>
+    constexpr Iterator_T search(Iterator_T first, Sentinel_T last,
+                                Projection_T proj = {}) const
+    {
+      return m_matcher.find(std::move(first), std::move(last),
+                            std::move(proj));
+    }
+
+    /**
+     * sink(it) for every (possibly overlapping) match in [first, last). An
+     * empty pattern matches once, at first, unless the range is empty.
+     * KMP and Two-Way carry their state from one match to the next and stay
+     * linear. Karp-Rabin keeps rolling its hash but verifies each hit in
+     * O(m); the naive and BMH engines restart one past each match. Those
+     * three cost O(n * m) on periodic text such as "aaaa...".
+     */
+    template <std::forward_iterator         Iterator_T,
+              std::sentinel_for<Iterator_T> Sentinel_T,
+              typename Sink_T, typename Projection_T = std::identity>
+    requires std::invocable<Sink_T&, Iterator_T>
+    constexpr void forEachMatch(Iterator_T first, Sentinel_T last,
+                                Sink_T&& sink, Projection_T proj = {}) const
+    {
+      if (size() == 0) {
+        if (first != last) std::invoke(sink, first);
+        return;
+      }
+
+      if constexpr (requires {
+                      m_matcher.forEachMatch(first, last, sink, proj);
+                    }) {
+        m_matcher.forEachMatch(std::move(first), std::move(last), sink,
+                               std::move(proj));
+      }
+      else {
+        for (auto it = m_matcher.find(first, last, proj); it != last;
+             it = m_matcher.find(std::next(it), last, proj))
+          std::invoke(sink, it);
+      }
+    }
+
+    /******************
+     *  Ranges Search
+     */
+    template <std::ranges::forward_range Range_T,
+              typename Projection_T = std::identity>
+    constexpr std::ranges::iterator_t<Range_T>
+    search(Range_T&& range, Projection_T proj = {}) const
+    {
+      return search(std::ranges::begin(range), std::ranges::end(range),
+                    std::move(proj));
+    }
+
+  private:
+    Matcher_T m_matcher;
+  };
+
+
+  namespace detail
+  {
+    // Engines exposing a preprocessed matcher
+    template <typename Engine_T>
+    concept CompilableEngine = requires
+    {
+      typename Engine_T::template matcher<char, std::ranges::equal_to>;
+    };
+
+    template <typename Engine_T, typename Key_T, typename BinaryPredicate_T>
+    using compiled_pattern_t = compiled_pattern<
+      typename Engine_T::template matcher<Key_T, BinaryPredicate_T>>;
+  }   // namespace detail
+
+
+  /**
+   * Preprocess a pattern for the given engine niebloid, i.e.
+   * compile_pattern<naive_search>, <kmp_search>, <bmh_search>, <kr_search>
+   * or <two_way_search>.
+   */
+  template <auto Engine_V, std::forward_iterator S_Iterator_T,
+            std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+            typename BinaryPredicate_T = std::ranges::equal_to,
+            typename S_Projection_T    = std::identity>
+  requires detail::CompilableEngine<decltype(Engine_V)>
+  constexpr auto compile_pattern(S_Iterator_T s_first, S_Sentinel_T s_last,
+                                 BinaryPredicate_T pred   = {},
+                                 S_Projection_T    s_proj = {})
+  {
+    using Key = utils::detail::pattern_key_t<S_Iterator_T, S_Projection_T>;
+    using Compiled
+      = detail::compiled_pattern_t<decltype(Engine_V), Key, BinaryPredicate_T>;
+    using Matcher = typename Compiled::Matcher;
+
+    return Compiled(
+      Matcher(s_first, s_last, std::move(pred), std::move(s_proj)));
+  }
+
+  template <auto Engine_V, std::ranges::forward_range S_Range_T,
+            typename BinaryPredicate_T = std::ranges::equal_to,
+            typename S_Projection_T    = std::identity>
+  requires detail::CompilableEngine<decltype(Engine_V)>
+  constexpr auto compile_pattern(S_Range_T&& s_range, BinaryPredicate_T pred = {},
+                                 S_Projection_T s_proj = {})
+  {
+    return compile_pattern<Engine_V>(std::ranges::begin(s_range),
+                                     std::ranges::end(s_range), std::move(pred),
+                                     std::move(s_proj));
+  }
+
+}   // namespace dte3611::string_match::algorithms
+
+#endif   // DTE3611_WEEK1_STRING_MATCH_COMPILED_PATTERN_H
@@ -0,0 +1,167 @@
+#ifndef DTE3611_WEEK1_STRING_MATCH_FILE_SEARCH_H
+#define DTE3611_WEEK1_STRING_MATCH_FILE_SEARCH_H
+
+// engines
+#include "compiled_pattern.h"
+
+// utils
+#include "../utils/mapped_file.h"
+
+// stl
+#include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+
+namespace dte3611::string_match::algorithms
+{
+
+  namespace detail
+  {
+
+    // string_match::utils shadows dte3611::utils in here
+    namespace file_utils = ::dte3611::utils;
+
+    template <auto Engine_V>
+    requires CompilableEngine<decltype(Engine_V)>
+    struct file_search_fn {
+
+      // Type Generics
+      template <std::ranges::forward_range S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<char const*,
+                                          std::ranges::iterator_t<S_Range_T>,
+                                          BinaryPredicate_T, Projection_T,
+                                          S_Projection_T>
+
+      // Return value -- byte offset of the first match
+      std::optional<std::size_t>
+
+      // Call-operator signature
+      operator()(std::filesystem::path const& path, file_utils::MapHints hints,
+                 S_Range_T&& s_range, BinaryPredicate_T pred = {},
+                 Projection_T proj = {}, S_Projection_T s_proj = {}) const
+      {
+        file_utils::MappedFile const file(path, hints);
+
+        auto const compiled
+          = compile_pattern<Engine_V>(s_range, std::move(pred), std::move(s_proj));
+        auto const it = compiled.search(file.begin(), file.end(), std::move(proj));
+
+        if (it == file.end()) return std::nullopt;
+        return static_cast<std::size_t>(it - file.begin());
+      }
+
+      // Default hints
+      template <std::ranges::forward_range S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+      requires std::indirectly_comparable<char const*,
+                                          std::ranges::iterator_t<S_Range_T>,
+                                          BinaryPredicate_T, Projection_T,
+                                          S_Projection_T>
+      std::optional<std::size_t>
+      operator()(std::filesystem::path const& path, S_Range_T&& s_range,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        return (*this)(path, file_utils::MapHints{},
+                       std::forward<S_Range_T>(s_range), std::move(pred),
+                       std::move(proj), std::move(s_proj));
+      }
+    };
+
+
+    template <auto Engine_V>
+    requires CompilableEngine<decltype(Engine_V)>
+    struct file_search_all_fn {
+
+      // Type Generics
+      template <std::ranges::forward_range S_Range_T,
+                typename Sink_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::invocable<Sink_T&, std::size_t>
+               and std::indirectly_comparable<
+                 char const*, std::ranges::iterator_t<S_Range_T>,
+                 BinaryPredicate_T, Projection_T, S_Projection_T>
+
+      // Return value -- number of matches handed to the sink
+      std::size_t
+
+      // Call-operator signature
+      operator()(std::filesystem::path const& path, file_utils::MapHints hints,
+                 S_Range_T&& s_range, Sink_T sink, BinaryPredicate_T pred = {},
+                 Projection_T proj = {}, S_Projection_T s_proj = {}) const
+      {
+        file_utils::MappedFile const file(path, hints);
+
+        auto const compiled
+          = compile_pattern<Engine_V>(s_range, std::move(pred), std::move(s_proj));
+
+        std::size_t count = 0;
+        compiled.forEachMatch(file.begin(), file.end(), [&](char const* it) {
+          std::invoke(sink, static_cast<std::size_t>(it - file.begin()));
+          ++count;
+        }, std::move(proj));
+        return count;
+      }
+
+      // Default hints
+      template <std::ranges::forward_range S_Range_T,
+                typename Sink_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+      requires std::invocable<Sink_T&, std::size_t>
+               and std::indirectly_comparable<
+                 char const*, std::ranges::iterator_t<S_Range_T>,
+                 BinaryPredicate_T, Projection_T, S_Projection_T>
+      std::size_t
+      operator()(std::filesystem::path const& path, S_Range_T&& s_range,
+                 Sink_T sink, BinaryPredicate_T pred = {},
+                 Projection_T proj = {}, S_Projection_T s_proj = {}) const
+      {
+        return (*this)(path, file_utils::MapHints{},
+                       std::forward<S_Range_T>(s_range), std::move(sink),
+                       std::move(pred), std::move(proj), std::move(s_proj));
+      }
+    };
+
+  }   // namespace detail
+
+  /**
+   * Niebloid API Instantiation -- search a file through a read-only mapping
+   * instead of reading it into a container first. Results are byte offsets,
+   * since the mapping is gone once the call returns; to keep iterators, map
+   * the file with utils::MappedFile and run any engine over it directly.
+   * An optional utils::MapHints after the path tunes read-ahead/huge pages.
+   *
+   *  file_search      offset of the first match, or nullopt
+   *  file_search_all  sink(offset) for every (possibly overlapping) match
+   *
+   * An empty pattern matches once, at offset 0, in any non-empty file.
+   * file_search_all is linear with kmp_search and two_way_search; the other
+   * engines, the default bmh_search included, cost O(n * m) in the worst
+   * case, on periodic text such as "aaaa..." (see compiled_pattern).
+   */
+  template <auto Engine_V = bmh_search>
+  inline constexpr detail::file_search_fn<Engine_V> file_search{};
+
+  template <auto Engine_V = bmh_search>
+  inline constexpr detail::file_search_all_fn<Engine_V> file_search_all{};
+
+}   // namespace dte3611::string_match::algorithms
+
+#endif   // DTE3611_WEEK1_STRING_MATCH_FILE_SEARCH_H
@@ -1,18 +1,171 @@
 #ifndef DTE3611_WEEK1_STRING_MATCH_KNUTH_MORRIS_PRATT_SEARCH_H
 #define DTE3611_WEEK1_STRING_MATCH_KNUTH_MORRIS_PRATT_SEARCH_H
 
+// utils
+#include "../utils/string_match_utils.h"
+
 // stl
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace dte3611::string_match::algorithms
 {
   namespace detail
   {
 
+    /**
+     * Preprocessed KMP matcher -- projected pattern and its LPS table.
+     */
+    template <typename Key_T, typename BinaryPredicate_T = std::ranges::equal_to>
+    class kmp_matcher {
+    public:
+      template <std::forward_iterator           S_Iterator_T,
+                std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+                typename S_Projection_T = std::identity>
+      constexpr kmp_matcher(S_Iterator_T s_first, S_Sentinel_T s_last,
+                            BinaryPredicate_T pred   = {},
+                            S_Projection_T    s_proj = {})
+        : m_pat{utils::detail::materializePattern<Key_T>(s_first, s_last,
+                                                          s_proj)},
+          m_lps(m_pat.size(), 0),
+          m_pred{std::move(pred)}
+      {
+        // Build LPS
+        const std::size_t m = m_pat.size();
+        for (std::size_t i = 1, len = 0; i < m; ) {
+          if (std::invoke(m_pred, m_pat[i], m_pat[len])) {
+            m_lps[i++] = ++len;
+          } else if (len) {
+            len = m_lps[len - 1];
+          } else {
+            m_lps[i++] = 0;
+          }
+        }
+      }
+
+      constexpr std::size_t size() const { return m_pat.size(); }
+
+      template <std::forward_iterator         Iterator_T,
+                std::sentinel_for<Iterator_T> Sentinel_T,
+                typename Projection_T = std::identity>
+      constexpr Iterator_T find(Iterator_T first, Sentinel_T last,
+                                Projection_T proj = {}) const
+      {
+        const std::size_t m = m_pat.size();
+        if (m == 0) return first;
+
+        using Value = std::iter_value_t<Iterator_T>;
+        if constexpr (utils::detail::ContiguousBytes<Iterator_T, Sentinel_T>
+                      and utils::detail::is_raw_byte_match_v<
+                        Value, Key_T, BinaryPredicate_T, Projection_T>) {
+          if (not std::is_constant_evaluated()) {
+            auto const n = static_cast<std::size_t>(last - first);
+            return first
+                   + static_cast<std::iter_difference_t<Iterator_T>>(
+                     utils::detail::rawKmpFind(std::to_address(first), n,
+                                               m_pat.data(), m, m_lps.data()));
+          }
+        }
+
+        return scan(first, last, proj, [](Iterator_T const&) { return false; });
+      }
+
+      /**
+       * sink(it) for every (possibly overlapping) match; an empty pattern
+       * reports nothing. The automaton keeps its state across matches, so
+       * the whole scan stays O(n + m) also on periodic text.
+       */
+      template <std::forward_iterator         Iterator_T,
+                std::sentinel_for<Iterator_T> Sentinel_T,
+                typename Sink_T, typename Projection_T = std::identity>
+      requires std::invocable<Sink_T&, Iterator_T>
+      constexpr void forEachMatch(Iterator_T first, Sentinel_T last,
+                                  Sink_T&& sink, Projection_T proj = {}) const
+      {
+        const std::size_t m = m_pat.size();
+        if (m == 0) return;
+
+        using Value = std::iter_value_t<Iterator_T>;
+        if constexpr (utils::detail::ContiguousBytes<Iterator_T, Sentinel_T>
+                      and utils::detail::is_raw_byte_match_v<
+                        Value, Key_T, BinaryPredicate_T, Projection_T>) {
+          if (not std::is_constant_evaluated()) {
+            auto const n = static_cast<std::size_t>(last - first);
+            utils::detail::rawKmpScan(
+              std::to_address(first), n, m_pat.data(), m, m_lps.data(),
+              [&](std::size_t pos) {
+                std::invoke(sink,
+                            first
+                              + static_cast<std::iter_difference_t<Iterator_T>>(pos));
+                return true;
+              });
+            return;
+          }
+        }
+
+        scan(first, last, proj, [&sink](Iterator_T const& at) {
+          std::invoke(sink, at);
+          return true;
+        });
+      }
+
+    private:
+      // Calls on_match(start) per match until it returns false, and returns
+      // that start -- or the end of the haystack
+      template <typename Iterator_T, typename Sentinel_T,
+                typename Projection_T, typename OnMatch_T>
+      constexpr Iterator_T scan(Iterator_T first, Sentinel_T last,
+                                Projection_T& proj, OnMatch_T&& on_match) const
+      {
+        const std::size_t m = m_pat.size();
+
+        // KMP search start tracking
+        Iterator_T start = first;
+        std::size_t j = 0;
+
+        Iterator_T it = first;
+        for (; it != last; ++it) {
+          auto hv = std::invoke(proj, *it);
+
+          while (j > 0 && !std::invoke(m_pred, hv, m_pat[j])) {
+            std::size_t old = j;
+            j = m_lps[j - 1];
+            for (std::size_t k = 0; k < old - j; ++k) ++start;
+          }
+
+          if (std::invoke(m_pred, hv, m_pat[j])) {
+            ++j;
+            if (j == m) {
+              if (not on_match(start)) return start;
+
+              // Continue from the longest proper border of the match
+              j = m_lps[m - 1];
+              for (std::size_t k = 0; k < m - j; ++k) ++start;
+            }
+          } else {
+            // j == 0 mismatch
+            ++start;
+          }
+        }
+        return it; // last
+      }
+
+      std::vector<Key_T>                       m_pat;
+      std::vector<std::size_t>                 m_lps;
+      [[no_unique_address]] BinaryPredicate_T  m_pred;
+    };
+
+
     struct kmp_search_fn {
 
+      // Preprocessed matcher type -- see compile_pattern
+      template <typename Key_T, typename BinaryPredicate_T>
+      using matcher = kmp_matcher<Key_T, BinaryPredicate_T>;
+
       /**************************
        *  Iterator Range Operator
        */
@@ -43,47 +196,10 @@ namespace dte3611::string_match::algorithms
         // Empty pattern matches at first
         if (s_first == s_last) return first;
 
-        // Materialize projected pattern
-        using PatKey = std::remove_cvref_t<std::invoke_result_t<S_Projection_T, decltype(*s_first)>>;
-        std::vector<PatKey> pat;
-        for (auto it = s_first; it != s_last; ++it) pat.push_back(std::invoke(s_proj, *it));
-        const std::size_t m = pat.size();
-        if (m == 0) return first;
-
-        // Build LPS
-        std::vector<std::size_t> lps(m, 0);
-        for (std::size_t i = 1, len = 0; i < m; ) {
-          if (std::invoke(pred, pat[i], pat[len])) {
-            lps[i++] = ++len;
-          } else if (len) {
-            len = lps[len - 1];
-          } else {
-            lps[i++] = 0;
-          }
-        }
-
-        // KMP search start tracking
-        Iterator_T start = first;
-        std::size_t j = 0;
-
-        for (Iterator_T it = first; it != last; ++it) {
-          auto hv = std::invoke(proj, *it);
-
-          while (j > 0 && !std::invoke(pred, hv, pat[j])) {
-            std::size_t old = j;
-            j = lps[j - 1];
-            for (std::size_t k = 0; k < old - j; ++k) ++start;
-          }
-
-          if (std::invoke(pred, hv, pat[j])) {
-            ++j;
-            if (j == m) return start;
-          } else {
-            // j == 0 mismatch
-            ++start;
-          }
-        }
-        return std::ranges::next(first, last); // last
+        using PatKey = utils::detail::pattern_key_t<S_Iterator_T, S_Projection_T>;
+        return kmp_matcher<PatKey, BinaryPredicate_T>(
+                 s_first, s_last, std::move(pred), std::move(s_proj))
+          .find(first, last, std::move(proj));
       }
 
       /******************
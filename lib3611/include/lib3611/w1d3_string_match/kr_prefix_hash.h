@@ -0,0 +1,292 @@
+#ifndef DTE3611_WEEK1_STRING_MATCH_KR_PREFIX_HASH_H
+#define DTE3611_WEEK1_STRING_MATCH_KR_PREFIX_HASH_H
+
+// engines
+#include "aho_corasick_search.h"
+#include "kr_search.h"
+
+// utils
+#include "../utils/string_match_utils.h"
+#include "../utils/thread_pool.h"
+
+// stl
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dte3611::string_match::algorithms
+{
+
+  namespace detail
+  {
+
+    // string_match::utils shadows dte3611::utils in here
+    namespace pool_utils = ::dte3611::utils;
+
+    // Elements per segment below which the prefix build stays serial
+    inline constexpr std::size_t kr_prefix_min_segment = std::size_t{1} << 16;
+
+    // base^e modulo 2^64
+    constexpr std::uint64_t krPower(std::uint64_t base, std::size_t e)
+    {
+      std::uint64_t result = 1;
+      for (; e != 0; e >>= 1, base *= base)
+        if (e & 1) result *= base;
+      return result;
+    }
+
+  }   // namespace detail
+
+
+  /**
+   * Karp-Rabin prefix hashes of a random-access text: prefix(i) is the hash
+   * of text[0, i) under kr_search's polynomial, so the hash of any window
+   * text[i, i + m) is prefix(i + m) - prefix(i) * base^m -- O(1) once
+   * base^m is known. Window hashes equal kr_matcher::hash() of the same
+   * (projected) keys.
+   *
+   * The build is parallel: every segment hashes its elements from zero,
+   * the segment totals are chained in order (T segments, O(T)), and every
+   * segment then adds its chained start hash times base^k to its local
+   * prefixes.
+   *
+   * Queries read window hashes straight from the table, so they split over
+   * the same pool without any rolling state. The table refers to the text
+   * and the pool, which must outlive it.
+   */
+  template <std::random_access_iterator Iterator_T,
+            typename Projection_T = std::identity>
+  class kr_prefix_hashes {
+  public:
+    using Key = std::remove_cvref_t<
+      std::invoke_result_t<Projection_T const&, std::iter_reference_t<Iterator_T>>>;
+
+    static constexpr std::uint64_t base = detail::kr_matcher<Key>::base;
+
+    kr_prefix_hashes(detail::pool_utils::ThreadPool& pool, Iterator_T first,
+                     std::size_t n, Projection_T proj = {})
+      : m_pool{&pool}, m_first{first}, m_proj{std::move(proj)}, m_prefix(n + 1, 0)
+    {
+      build();
+    }
+
+    kr_prefix_hashes(Iterator_T first, std::size_t n, Projection_T proj = {})
+      : kr_prefix_hashes(detail::pool_utils::defaultThreadPool(), first, n,
+                         std::move(proj))
+    {
+    }
+
+    template <std::ranges::random_access_range Range_T>
+    requires std::ranges::sized_range<Range_T>
+    kr_prefix_hashes(detail::pool_utils::ThreadPool& pool, Range_T&& text,
+                     Projection_T proj = {})
+      : kr_prefix_hashes(pool, std::ranges::begin(text),
+                         static_cast<std::size_t>(std::ranges::size(text)),
+                         std::move(proj))
+    {
+    }
+
+    template <std::ranges::random_access_range Range_T>
+    requires std::ranges::sized_range<Range_T>
+    explicit kr_prefix_hashes(Range_T&& text, Projection_T proj = {})
+      : kr_prefix_hashes(detail::pool_utils::defaultThreadPool(),
+                         std::forward<Range_T>(text), std::move(proj))
+    {
+    }
+
+    std::size_t   size() const { return m_prefix.size() - 1; }
+    std::uint64_t prefix(std::size_t i) const { return m_prefix[i]; }
+
+    static constexpr std::uint64_t power(std::size_t m)
+    {
+      return detail::krPower(base, m);
+    }
+
+    // Hash of text[pos, pos + m), given power(m)
+    std::uint64_t windowHash(std::size_t pos, std::size_t m,
+                             std::uint64_t power_m) const
+    {
+      return m_prefix[pos + m] - m_prefix[pos] * power_m;
+    }
+
+    std::uint64_t windowHash(std::size_t pos, std::size_t m) const
+    {
+      return windowHash(pos, m, power(m));
+    }
+
+    // Hashes of all n - m + 1 windows of length m
+    std::vector<std::uint64_t> windowHashes(std::size_t m) const
+    {
+      if (m > size()) return {};
+      std::uint64_t const        power_m = power(m);
+      std::vector<std::uint64_t> hashes(size() - m + 1);
+      for (std::size_t i = 0; i < hashes.size(); ++i)
+        hashes[i] = windowHash(i, m, power_m);
+      return hashes;
+    }
+
+    /**
+     * Offsets of every occurrence of the pattern, ascending -- one O(1)
+     * window hash per position, candidates verified. An empty pattern
+     * yields the single offset 0, or nothing in an empty text, like the
+     * other find-all front-ends.
+     */
+    template <std::ranges::forward_range S_Range_T,
+              typename S_Projection_T = std::identity>
+    std::vector<std::size_t> findAll(S_Range_T&& s_range,
+                                     S_Projection_T s_proj = {}) const
+    {
+      auto const pat = utils::detail::materializePattern<Key>(
+        std::ranges::begin(s_range), std::ranges::end(s_range), s_proj);
+      if (pat.empty()) return size() == 0 ? std::vector<std::size_t>{}
+                                          : std::vector<std::size_t>{0};
+
+      std::uint64_t pattern_hash = 0;
+      for (auto const& k : pat)
+        pattern_hash = pattern_hash * base + utils::detail::keyHash<Key>(k);
+
+      return collectWindows<std::size_t>(
+        pat.size(), [&](std::uint64_t wh, std::size_t pos, auto& hits) {
+          if (wh == pattern_hash and verify(pos, pat)) hits.push_back(pos);
+        });
+    }
+
+    /**
+     * Every (pattern_id, offset) of a set of equal-length patterns, ordered
+     * by offset, then pattern id, as multi_search reports them. Throws
+     * std::invalid_argument if the lengths differ.
+     */
+    template <std::ranges::forward_range P_Range_T,
+              typename S_Projection_T = std::identity>
+    requires std::ranges::forward_range<std::ranges::range_reference_t<P_Range_T>>
+    std::vector<aho_corasick_match> findAllOf(P_Range_T&&    patterns,
+                                              S_Projection_T s_proj = {}) const
+    {
+      detail::kr_set_matcher<Key> const set(std::ranges::begin(patterns),
+                                            std::ranges::end(patterns), s_proj);
+      if (set.patternCount() == 0 or set.size() == 0) return {};
+
+      return collectWindows<aho_corasick_match>(
+        set.size(), [&](std::uint64_t wh, std::size_t pos, auto& hits) {
+          auto sink = [&hits](std::size_t id, std::size_t offset) {
+            hits.push_back({id, offset});
+          };
+          set.matchWindow(wh, iteratorAt(pos), pos, sink, m_proj);
+        });
+    }
+
+  private:
+    // About four segments per thread, none below kr_prefix_min_segment
+    std::size_t segmentCount(std::size_t n) const
+    {
+      return std::clamp<std::size_t>(n / detail::kr_prefix_min_segment, 1,
+                                     m_pool->size() * 4);
+    }
+
+    /**
+     * Calls test(window_hash, pos, hits) for every window of length m, in
+     * parallel segments, and concatenates the per-segment hits in order.
+     */
+    template <typename Hit_T, typename Test_T>
+    std::vector<Hit_T> collectWindows(std::size_t m, Test_T const& test) const
+    {
+      if (m == 0 or m > size()) return {};
+
+      std::size_t const   windows  = size() - m + 1;
+      std::size_t const   segments = segmentCount(windows);
+      std::size_t const   segment  = (windows + segments - 1) / segments;
+      std::uint64_t const power_m  = power(m);
+
+      std::vector<std::vector<Hit_T>> hits(segments);
+      m_pool->parallelFor(segments, [&](std::size_t s) {
+        std::size_t const hi = std::min((s + 1) * segment, windows);
+        for (std::size_t pos = std::min(s * segment, windows); pos < hi; ++pos)
+          test(windowHash(pos, m, power_m), pos, hits[s]);
+      });
+
+      std::vector<Hit_T> all;
+      for (auto& part : hits) all.insert(all.end(), part.begin(), part.end());
+      return all;
+    }
+
+    void build()
+    {
+      std::size_t const n        = size();
+      std::size_t const segments = segmentCount(n);
+      std::size_t const segment  = (n + segments - 1) / segments;
+
+      auto bounds = [&](std::size_t s) {
+        return std::pair{std::min(s * segment, n), std::min((s + 1) * segment, n)};
+      };
+
+      // Local prefixes: m_prefix[lo + k] = hash of text[lo, lo + k)
+      m_pool->parallelFor(segments, [&](std::size_t s) {
+        auto const [lo, hi] = bounds(s);
+        std::uint64_t h     = 0;
+        for (std::size_t i = lo; i < hi; ++i) {
+          h = h * base + hashAt(i);
+          m_prefix[i + 1] = h;
+        }
+      });
+
+      // Chain the segment totals: start[s] = prefix(lo_s)
+      std::vector<std::uint64_t> start(segments, 0);
+      for (std::size_t s = 1; s < segments; ++s) {
+        auto const [lo, hi] = bounds(s - 1);
+        start[s] = start[s - 1] * power(hi - lo) + m_prefix[hi];
+      }
+
+      // prefix(lo + k) = start * base^k + local(k)
+      m_pool->parallelFor(segments, [&](std::size_t s) {
+        auto const [lo, hi] = bounds(s);
+        std::uint64_t carry = start[s];
+        for (std::size_t i = lo; i < hi; ++i) {
+          carry *= base;
+          m_prefix[i + 1] += carry;
+        }
+      });
+    }
+
+    Iterator_T iteratorAt(std::size_t i) const
+    {
+      return m_first + static_cast<std::iter_difference_t<Iterator_T>>(i);
+    }
+
+    std::uint64_t hashAt(std::size_t i) const
+    {
+      return utils::detail::keyHash<Key>(std::invoke(m_proj, *iteratorAt(i)));
+    }
+
+    bool verify(std::size_t pos, std::vector<Key> const& pat) const
+    {
+      auto it = iteratorAt(pos);
+      for (std::size_t j = 0; j < pat.size(); ++j, ++it)
+        if (!std::ranges::equal_to{}(std::invoke(m_proj, *it), pat[j]))
+          return false;
+      return true;
+    }
+
+    detail::pool_utils::ThreadPool*    m_pool;
+    Iterator_T                         m_first;
+    [[no_unique_address]] Projection_T m_proj;
+    std::vector<std::uint64_t>         m_prefix;
+  };
+
+  template <std::ranges::random_access_range Range_T,
+            typename Projection_T = std::identity>
+  kr_prefix_hashes(Range_T&&, Projection_T = {})
+    -> kr_prefix_hashes<std::ranges::iterator_t<Range_T>, Projection_T>;
+
+  template <std::ranges::random_access_range Range_T,
+            typename Projection_T = std::identity>
+  kr_prefix_hashes(::dte3611::utils::ThreadPool&, Range_T&&, Projection_T = {})
+    -> kr_prefix_hashes<std::ranges::iterator_t<Range_T>, Projection_T>;
+
+}   // namespace dte3611::string_match::algorithms
+
+#endif   // DTE3611_WEEK1_STRING_MATCH_KR_PREFIX_HASH_H
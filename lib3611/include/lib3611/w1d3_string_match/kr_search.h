@@ -1,9 +1,18 @@
 #ifndef DTE3611_WEEK1_STRING_MATCH_KARP_RABIN_SEARCH_H
 #define DTE3611_WEEK1_STRING_MATCH_KARP_RABIN_SEARCH_H
 
+// utils
+#include "../utils/string_match_utils.h"
+
 // stl
 #include <iterator>
 #include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace dte3611::string_match::algorithms
 {
@@ -11,8 +20,257 @@ namespace dte3611::string_match::algorithms
   namespace detail
   {
 
+    /**
+     * Preprocessed Karp-Rabin matcher -- projected pattern, its polynomial
+     * hash and the leading power of the base. Hashing is exact only under an
+     * equality predicate; other predicates verify every window instead.
+     */
+    template <typename Key_T, typename BinaryPredicate_T = std::ranges::equal_to>
+    class kr_matcher {
+
+      static constexpr bool hashed
+        = utils::detail::is_equality_predicate_v<BinaryPredicate_T>
+          and (std::integral<Key_T>
+               or requires(Key_T const& k) { std::hash<Key_T>{}(k); });
+
+    public:
+      // Polynomial base; arithmetic is modulo 2^64
+      static constexpr std::uint64_t base = 0x100000001B3ull;
+
+      template <std::forward_iterator           S_Iterator_T,
+                std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+                typename S_Projection_T = std::identity>
+      constexpr kr_matcher(S_Iterator_T s_first, S_Sentinel_T s_last,
+                           BinaryPredicate_T pred   = {},
+                           S_Projection_T    s_proj = {})
+        : m_pat{utils::detail::materializePattern<Key_T>(s_first, s_last,
+                                                          s_proj)},
+          m_pred{std::move(pred)}
+      {
+        if constexpr (hashed) {
+          for (std::size_t i = 0; i < m_pat.size(); ++i) {
+            m_hash = m_hash * base + utils::detail::keyHash<Key_T>(m_pat[i]);
+            if (i > 0) m_high *= base;
+          }
+        }
+      }
+
+      constexpr std::size_t   size() const { return m_pat.size(); }
+      constexpr std::uint64_t hash() const { return m_hash; }
+
+      template <std::forward_iterator         Iterator_T,
+                std::sentinel_for<Iterator_T> Sentinel_T,
+                typename Projection_T = std::identity>
+      constexpr Iterator_T find(Iterator_T first, Sentinel_T last,
+                                Projection_T proj = {}) const
+      {
+        if (m_pat.empty()) return first;
+        return scan(first, last, proj, [](Iterator_T const&) { return false; });
+      }
+
+      /**
+       * sink(it) for every (possibly overlapping) match; an empty pattern
+       * reports nothing. The window hash keeps rolling past a match instead
+       * of being rebuilt; each hit is still verified in O(m).
+       */
+      template <std::forward_iterator         Iterator_T,
+                std::sentinel_for<Iterator_T> Sentinel_T,
+                typename Sink_T, typename Projection_T = std::identity>
+      requires std::invocable<Sink_T&, Iterator_T>
+      constexpr void forEachMatch(Iterator_T first, Sentinel_T last,
+                                  Sink_T&& sink, Projection_T proj = {}) const
+      {
+        if (m_pat.empty()) return;
+        scan(first, last, proj, [&sink](Iterator_T const& at) {
+          std::invoke(sink, at);
+          return true;
+        });
+      }
+
+    private:
+      // Calls on_match(win) per match until it returns false, and returns
+      // that window -- or the end of the haystack
+      template <typename Iterator_T, typename Sentinel_T,
+                typename Projection_T, typename OnMatch_T>
+      constexpr Iterator_T scan(Iterator_T first, Sentinel_T last,
+                                Projection_T& proj, OnMatch_T&& on_match) const
+      {
+        const std::size_t m = m_pat.size();
+
+        auto h = [&proj](auto const& it) {
+          return utils::detail::keyHash<Key_T>(std::invoke(proj, *it));
+        };
+
+        // Window [win, tail)
+        Iterator_T    win  = first;
+        Iterator_T    tail = first;
+        std::uint64_t wh   = 0;
+        for (std::size_t i = 0; i < m; ++i, ++tail) {
+          if (tail == last) return tail;   // haystack shorter than pattern
+          if constexpr (hashed) wh = wh * base + h(tail);
+        }
+
+        for (;;) {
+          if ((not hashed or wh == m_hash) and verify(win, proj)
+              and not on_match(win))
+            return win;
+          if (tail == last) return tail;   // no (further) match
+
+          if constexpr (hashed) wh = (wh - h(win) * m_high) * base + h(tail);
+          ++win;
+          ++tail;
+        }
+      }
+
+      template <typename Iterator_T, typename Projection_T>
+      constexpr bool verify(Iterator_T it, Projection_T& proj) const
+      {
+        for (std::size_t j = 0; j < m_pat.size(); ++j, ++it)
+          if (!std::invoke(m_pred, std::invoke(proj, *it), m_pat[j]))
+            return false;
+        return true;
+      }
+
+      std::vector<Key_T>                       m_pat;
+      std::uint64_t                            m_hash{0};
+      std::uint64_t                            m_high{1};
+      [[no_unique_address]] BinaryPredicate_T  m_pred;
+    };
+
+
+    /**
+     * Karp-Rabin over a set of equal-length patterns -- one rolling window
+     * hash is tested against a bit filter on its high bits, then looked up
+     * among the sorted pattern hashes, and candidates are verified. Hits go
+     * to sink(pattern_id, offset), ordered by offset, then pattern id.
+     * Throws std::invalid_argument if the lengths differ.
+     */
+    template <typename Key_T>
+    requires std::integral<Key_T>
+             or requires(Key_T const& k) { std::hash<Key_T>{}(k); }
+    class kr_set_matcher {
+
+      static constexpr std::uint64_t base = kr_matcher<Key_T>::base;
+
+    public:
+      template <std::forward_iterator           P_Iterator_T,
+                std::sentinel_for<P_Iterator_T> P_Sentinel_T,
+                typename S_Projection_T = std::identity>
+      requires std::ranges::forward_range<std::iter_reference_t<P_Iterator_T>>
+      kr_set_matcher(P_Iterator_T p_first, P_Sentinel_T p_last,
+                     S_Projection_T s_proj = {})
+      {
+        for (; p_first != p_last; ++p_first) {
+          auto&&     pattern = *p_first;
+          auto const keys    = utils::detail::materializePattern<Key_T>(
+            std::ranges::begin(pattern), std::ranges::end(pattern), s_proj);
+
+          if (m_hashes.empty())
+            m_length = keys.size();
+          else if (keys.size() != m_length)
+            throw std::invalid_argument("kr_set_matcher: pattern lengths differ");
+
+          std::uint64_t h = 0;
+          for (auto const& k : keys) h = h * base + utils::detail::keyHash<Key_T>(k);
+          m_hashes.emplace_back(h, m_hashes.size());
+          m_keys.insert(m_keys.end(), keys.begin(), keys.end());
+        }
+        for (std::size_t i = 1; i < m_length; ++i) m_high *= base;
+        std::ranges::sort(m_hashes);
+
+        // About 64 filter bits per pattern, at least one 4 KiB page
+        m_filter_bits = 15;
+        while (m_filter_bits < 30 and (std::size_t{1} << m_filter_bits) < 64 * m_hashes.size())
+          ++m_filter_bits;
+        m_filter.assign((std::size_t{1} << m_filter_bits) / 64, 0);
+        for (auto const& [hash, id] : m_hashes) {
+          auto const slot = filterSlot(hash);
+          m_filter[slot / 64] |= std::uint64_t{1} << (slot % 64);
+        }
+      }
+
+      std::size_t patternCount() const { return m_hashes.size(); }
+      std::size_t size() const { return m_length; }
+
+      template <std::forward_iterator         Iterator_T,
+                std::sentinel_for<Iterator_T> Sentinel_T,
+                typename Sink_T, typename Projection_T = std::identity>
+      requires std::invocable<Sink_T&, std::size_t, std::size_t>
+      void forEachMatch(Iterator_T first, Sentinel_T last, Sink_T&& sink,
+                        Projection_T proj = {}) const
+      {
+        const std::size_t m = m_length;
+        if (m == 0) return;   // empty patterns never report a hit
+
+        auto h = [&proj](auto const& it) {
+          return utils::detail::keyHash<Key_T>(std::invoke(proj, *it));
+        };
+
+        // Window [win, tail)
+        Iterator_T    win  = first;
+        Iterator_T    tail = first;
+        std::uint64_t wh   = 0;
+        for (std::size_t i = 0; i < m; ++i, ++tail) {
+          if (tail == last) return;   // haystack shorter than the patterns
+          wh = wh * base + h(tail);
+        }
+
+        for (std::size_t offset = 0;; ++offset) {
+          matchWindow(wh, win, offset, sink, proj);
+
+          if (tail == last) return;
+          wh = (wh - h(win) * m_high) * base + h(tail);
+          ++win;
+          ++tail;
+        }
+      }
+
+      // Reports the patterns matching the window at win, whose hash is wh
+      template <typename Iterator_T, typename Sink_T, typename Projection_T>
+      void matchWindow(std::uint64_t wh, Iterator_T win, std::size_t offset,
+                       Sink_T& sink, Projection_T& proj) const
+      {
+        auto const slot = filterSlot(wh);
+        if (not(m_filter[slot / 64] & (std::uint64_t{1} << (slot % 64)))) return;
+
+        auto const candidates = std::ranges::equal_range(
+          m_hashes, wh, {}, &std::pair<std::uint64_t, std::size_t>::first);
+        for (auto const& [hash, id] : candidates)
+          if (verify(win, id, proj)) sink(id, offset);
+      }
+
+    private:
+      // High bits -- the low bits of a polynomial hash only see low key bits
+      std::size_t filterSlot(std::uint64_t hash) const
+      {
+        return static_cast<std::size_t>(hash >> (64 - m_filter_bits));
+      }
+
+      template <typename Iterator_T, typename Projection_T>
+      bool verify(Iterator_T it, std::size_t id, Projection_T& proj) const
+      {
+        auto const* pat = m_keys.data() + id * m_length;
+        for (std::size_t j = 0; j < m_length; ++j, ++it)
+          if (!std::ranges::equal_to{}(std::invoke(proj, *it), pat[j]))
+            return false;
+        return true;
+      }
+
+      std::vector<Key_T>                                  m_keys;     // flattened
+      std::vector<std::pair<std::uint64_t, std::size_t>> m_hashes;   // (hash, id)
+      std::vector<std::uint64_t>                          m_filter;
+      unsigned                                            m_filter_bits{15};
+      std::size_t                                         m_length{0};
+      std::uint64_t                                       m_high{1};
+    };
+
+
     struct kr_search_fn {
 
+      // Preprocessed matcher type -- see compile_pattern
+      template <typename Key_T, typename BinaryPredicate_T>
+      using matcher = kr_matcher<Key_T, BinaryPredicate_T>;
+
       /**************************
        *  Iterator Range Operator
        */
@@ -35,13 +293,18 @@ namespace dte3611::string_match::algorithms
       constexpr Iterator_T
 
       // Call-operator signature
-      operator()(Iterator_T /*first*/, Sentinel_T last,
-                 S_Iterator_T /*s_first*/, S_Sentinel_T /*s_last*/,
-                 BinaryPredicate_T /*pred*/ = {}, Projection_T /*proj*/ = {},
-                 S_Projection_T /*s_proj*/ = {}) const
+      operator()(Iterator_T first, Sentinel_T last,
+                 S_Iterator_T s_first, S_Sentinel_T s_last,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
       {
-        return last;
-        //      static_assert( false, "Complete the code" );
+        // Empty pattern matches at first
+        if (s_first == s_last) return first;
+
+        using PatKey = utils::detail::pattern_key_t<S_Iterator_T, S_Projection_T>;
+        return kr_matcher<PatKey, BinaryPredicate_T>(
+                 s_first, s_last, std::move(pred), std::move(s_proj))
+          .find(first, last, std::move(proj));
       }
 
 
@@ -1,10 +1,16 @@
 #ifndef DTE3611_WEEK1_STRING_MATCH_NAIVE_SEARCH_H
 #define DTE3611_WEEK1_STRING_MATCH_NAIVE_SEARCH_H
 
+// utils
+#include "../utils/string_match_utils.h"
+
 // stl
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace dte3611::string_match::algorithms
 {
@@ -12,8 +18,72 @@ namespace dte3611::string_match::algorithms
   namespace detail
   {
 
+    /**
+     * Preprocessed naive matcher -- holds the projected pattern only.
+     */
+    template <typename Key_T, typename BinaryPredicate_T = std::ranges::equal_to>
+    class naive_matcher {
+    public:
+      template <std::forward_iterator           S_Iterator_T,
+                std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+                typename S_Projection_T = std::identity>
+      constexpr naive_matcher(S_Iterator_T s_first, S_Sentinel_T s_last,
+                              BinaryPredicate_T pred   = {},
+                              S_Projection_T    s_proj = {})
+        : m_pat{utils::detail::materializePattern<Key_T>(s_first, s_last,
+                                                          s_proj)},
+          m_pred{std::move(pred)}
+      {
+      }
+
+      constexpr std::size_t size() const { return m_pat.size(); }
+
+      template <std::forward_iterator         Iterator_T,
+                std::sentinel_for<Iterator_T> Sentinel_T,
+                typename Projection_T = std::identity>
+      constexpr Iterator_T find(Iterator_T first, Sentinel_T last,
+                                Projection_T proj = {}) const
+      {
+        if (m_pat.empty()) return first;
+
+        using Value = std::iter_value_t<Iterator_T>;
+        if constexpr (utils::detail::ContiguousBytes<Iterator_T, Sentinel_T>
+                      and utils::detail::is_raw_byte_match_v<
+                        Value, Key_T, BinaryPredicate_T, Projection_T>) {
+          if (not std::is_constant_evaluated()) {
+            auto const n = static_cast<std::size_t>(last - first);
+            return first
+                   + static_cast<std::iter_difference_t<Iterator_T>>(
+                     utils::detail::rawNaiveFind(std::to_address(first), n,
+                                                 m_pat.data(), m_pat.size()));
+          }
+        }
+
+        Iterator_T i = first;
+        for (; i != last; ++i) {
+          Iterator_T it = i;
+
+          for (std::size_t j = 0;; ++j, ++it) {
+            if (j == m_pat.size()) return i;   // full match
+            if (it == last) return it;         // no room left
+            if (!std::invoke(m_pred, std::invoke(proj, *it), m_pat[j])) break;
+          }
+        }
+        return i;   // no match
+      }
+
+    private:
+      std::vector<Key_T>                       m_pat;
+      [[no_unique_address]] BinaryPredicate_T  m_pred;
+    };
+
+
     struct naive_search_fn {
 
+      // Preprocessed matcher type -- see compile_pattern
+      template <typename Key_T, typename BinaryPredicate_T>
+      using matcher = naive_matcher<Key_T, BinaryPredicate_T>;
+
       /**************************
        *  Iterator Range Operator
        */
@@ -43,6 +113,23 @@ namespace dte3611::string_match::algorithms
       {
         if (s_first == s_last) return first;
 
+        using Value   = std::iter_value_t<Iterator_T>;
+        using S_Value = std::iter_value_t<S_Iterator_T>;
+        if constexpr (utils::detail::ContiguousBytes<Iterator_T, Sentinel_T>
+                      and utils::detail::ContiguousBytes<S_Iterator_T, S_Sentinel_T>
+                      and utils::detail::is_raw_byte_match_v<
+                        Value, S_Value, BinaryPredicate_T, Projection_T>
+                      and std::same_as<S_Projection_T, std::identity>) {
+          if (not std::is_constant_evaluated()) {
+            auto const n = static_cast<std::size_t>(last - first);
+            return first
+                   + static_cast<std::iter_difference_t<Iterator_T>>(
+                     utils::detail::rawNaiveFind(
+                       std::to_address(first), n, std::to_address(s_first),
+                       static_cast<std::size_t>(s_last - s_first)));
+          }
+        }
+
         for (Iterator_T i = first; i != last; ++i) {
           Iterator_T it = i;
           S_Iterator_T sj = s_first;
@@ -0,0 +1,261 @@
+#ifndef DTE3611_WEEK1_STRING_MATCH_PARALLEL_SEARCH_H
+#define DTE3611_WEEK1_STRING_MATCH_PARALLEL_SEARCH_H
+
+// engines
+#include "compiled_pattern.h"
+
+// utils
+#include "../utils/thread_pool.h"
+
+// stl
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+namespace dte3611::string_match::algorithms
+{
+
+  namespace detail
+  {
+
+    // string_match::utils shadows dte3611::utils in here
+    namespace pool_utils = ::dte3611::utils;
+
+    // Candidate start positions per chunk below which we stay serial
+    inline constexpr std::size_t parallel_search_min_chunk = std::size_t{1} << 16;
+
+    // Chunks per worker -- finer chunks let first-match cancel more work
+    inline constexpr std::size_t parallel_search_chunks_per_thread = 4;
+
+    /**
+     * Split the n - m + 1 candidate starts of a random-access haystack into
+     * chunks; chunk i scans [lo, hi + m - 1), i.e. neighbouring chunks
+     * overlap by m - 1 elements, so every match lies wholly in one chunk.
+     */
+    template <bool FindAll_V, std::random_access_iterator Iterator_T,
+              typename Compiled_T, typename Projection_T>
+    std::conditional_t<FindAll_V, std::vector<Iterator_T>, Iterator_T>
+    parallelChunkedSearch(pool_utils::ThreadPool& pool, Iterator_T first,
+                          std::size_t n, Compiled_T const& matcher,
+                          Projection_T const& proj)
+    {
+      using Diff = std::iter_difference_t<Iterator_T>;
+      auto at    = [first](std::size_t i) { return first + static_cast<Diff>(i); };
+
+      std::size_t const m    = matcher.size();
+      Iterator_T const  last = at(n);
+
+      // Empty pattern: found at first -- which is last in an empty text
+      if (m == 0) {
+        if constexpr (FindAll_V) {
+          if (n == 0) return {};
+          return {first};
+        }
+        else return first;
+      }
+      if (m > n) {
+        if constexpr (FindAll_V) return {};
+        else return last;
+      }
+
+      std::size_t const positions = n - m + 1;
+      std::size_t const chunks    = std::clamp<std::size_t>(
+        positions / parallel_search_min_chunk, 1,
+        pool.size() * parallel_search_chunks_per_thread);
+      std::size_t const chunk = (positions + chunks - 1) / chunks;
+
+      if constexpr (FindAll_V) {
+        std::vector<std::vector<std::size_t>> hits(chunks);
+
+        pool.parallelFor(chunks, [&](std::size_t i) {
+          std::size_t const lo = i * chunk;
+          if (lo >= positions) return;
+          std::size_t const hi = std::min(lo + chunk, positions);
+
+          matcher.forEachMatch(at(lo), at(hi + m - 1), [&](Iterator_T it) {
+            hits[i].push_back(static_cast<std::size_t>(it - first));
+          }, proj);
+        });
+
+        // Chunks are disjoint in start position and ordered -- concatenate
+        std::vector<Iterator_T> result;
+        for (auto const& chunk_hits : hits)
+          for (auto const pos : chunk_hits) result.push_back(at(pos));
+        return result;
+      }
+      else {
+        std::atomic<std::size_t> best{n};
+
+        pool.parallelFor(chunks, [&](std::size_t i) {
+          std::size_t const lo = i * chunk;
+
+          // Cancelled: an earlier chunk already holds a match
+          if (lo >= positions or lo >= best.load(std::memory_order_relaxed))
+            return;
+          std::size_t const hi = std::min(lo + chunk, positions);
+
+          Iterator_T const e  = at(hi + m - 1);
+          Iterator_T const it = matcher.search(at(lo), e, proj);
+          if (it == e) return;
+
+          auto const pos = static_cast<std::size_t>(it - first);
+          auto       cur = best.load(std::memory_order_relaxed);
+          while (pos < cur and not best.compare_exchange_weak(cur, pos)) {}
+        });
+
+        return at(best.load());
+      }
+    }
+
+
+    template <auto Engine_V, bool FindAll_V>
+    requires CompilableEngine<decltype(Engine_V)>
+    struct parallel_search_fn {
+
+      template <typename Iterator_T>
+      using Result
+        = std::conditional_t<FindAll_V, std::vector<Iterator_T>, Iterator_T>;
+
+      /**************************
+       *  Iterator Range Operator
+       */
+
+      // Type Generics
+      template <std::random_access_iterator         Iterator_T,
+                std::sized_sentinel_for<Iterator_T> Sentinel_T,
+                std::forward_iterator               S_Iterator_T,
+                std::sentinel_for<S_Iterator_T>     S_Sentinel_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<Iterator_T, S_Iterator_T,
+                                          BinaryPredicate_T, Projection_T,
+                                          S_Projection_T>
+
+      // Return value
+      Result<Iterator_T>
+
+      // Call-operator signature
+      operator()(pool_utils::ThreadPool& pool, Iterator_T first, Sentinel_T last,
+                 S_Iterator_T s_first, S_Sentinel_T s_last,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        auto const compiled = compile_pattern<Engine_V>(
+          s_first, s_last, std::move(pred), std::move(s_proj));
+
+        return parallelChunkedSearch<FindAll_V>(
+          pool, first, static_cast<std::size_t>(last - first), compiled, proj);
+      }
+
+      // Default pool
+      template <std::random_access_iterator         Iterator_T,
+                std::sized_sentinel_for<Iterator_T> Sentinel_T,
+                std::forward_iterator               S_Iterator_T,
+                std::sentinel_for<S_Iterator_T>     S_Sentinel_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+      requires std::indirectly_comparable<Iterator_T, S_Iterator_T,
+                                          BinaryPredicate_T, Projection_T,
+                                          S_Projection_T>
+      Result<Iterator_T>
+      operator()(Iterator_T first, Sentinel_T last,
+                 S_Iterator_T s_first, S_Sentinel_T s_last,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        return (*this)(pool_utils::defaultThreadPool(), first, last, s_first,
+                       s_last, std::move(pred), std::move(proj),
+                       std::move(s_proj));
+      }
+
+
+      /******************
+       *  Ranges Operator
+       */
+
+      // Type Generics
+      template <std::ranges::random_access_range Range_T,
+                std::ranges::forward_range       S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::ranges::sized_range<Range_T>
+               and std::indirectly_comparable<
+                 std::ranges::iterator_t<Range_T>,
+                 std::ranges::iterator_t<S_Range_T>, BinaryPredicate_T,
+                 Projection_T, S_Projection_T>
+
+      // Return value
+      Result<std::ranges::iterator_t<Range_T>>
+
+      // Call-operator signature
+      operator()(pool_utils::ThreadPool& pool, Range_T&& range, S_Range_T&& s_range,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        auto const first = std::ranges::begin(range);
+        return (*this)(pool, first, first + std::ranges::ssize(range),
+                       std::ranges::begin(s_range), std::ranges::end(s_range),
+                       std::move(pred), std::move(proj), std::move(s_proj));
+      }
+
+      // Default pool
+      template <std::ranges::random_access_range Range_T,
+                std::ranges::forward_range       S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+      requires std::ranges::sized_range<Range_T>
+               and std::indirectly_comparable<
+                 std::ranges::iterator_t<Range_T>,
+                 std::ranges::iterator_t<S_Range_T>, BinaryPredicate_T,
+                 Projection_T, S_Projection_T>
+      Result<std::ranges::iterator_t<Range_T>>
+      operator()(Range_T&& range, S_Range_T&& s_range,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        return (*this)(pool_utils::defaultThreadPool(), std::forward<Range_T>(range),
+                       std::forward<S_Range_T>(s_range), std::move(pred),
+                       std::move(proj), std::move(s_proj));
+      }
+
+    };
+
+  }   // namespace detail
+
+  /**
+   * Niebloid API Instantiation -- chunked multi-threaded search with any
+   * compilable engine, e.g. parallel_search<bmh_search>(text, pattern).
+   * An optional leading ThreadPool& selects the pool (default: hardware).
+   *
+   *  parallel_search      first match; chunks past a found match are skipped
+   *  parallel_search_all  every (possibly overlapping) match, in text order;
+   *                       an empty pattern yields a single match at first,
+   *                       none in an empty text (parallel_search: last)
+   *
+   * Within a chunk, find-all runs as compiled_pattern::forEachMatch does:
+   * linear for kmp_search and two_way_search, O(n * m) worst case for the
+   * other engines on periodic text.
+   */
+  template <auto Engine_V = kmp_search>
+  inline constexpr detail::parallel_search_fn<Engine_V, false> parallel_search{};
+
+  template <auto Engine_V = kmp_search>
+  inline constexpr detail::parallel_search_fn<Engine_V, true>
+    parallel_search_all{};
+
+}   // namespace dte3611::string_match::algorithms
+
+#endif   // DTE3611_WEEK1_STRING_MATCH_PARALLEL_SEARCH_H
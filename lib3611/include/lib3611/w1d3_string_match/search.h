@@ -0,0 +1,404 @@
+#ifndef DTE3611_WEEK1_STRING_MATCH_SEARCH_H
+#define DTE3611_WEEK1_STRING_MATCH_SEARCH_H
+
+// utils
+#include "../utils/string_match_utils.h"
+
+// engines
+#include "naive_search.h"
+#include "kmp_search.h"
+#include "bmh_search.h"
+#include "kr_search.h"
+#include "aho_corasick_search.h"
+
+// stl
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace dte3611::string_match::algorithms
+{
+
+  // Engines search() and multi_search() dispatch to
+  enum class search_engine { naive, kmp, bmh, kr, aho_corasick };
+
+  constexpr std::string_view engineName(search_engine engine)
+  {
+    switch (engine) {
+      case search_engine::naive: return "naive";
+      case search_engine::kmp: return "kmp";
+      case search_engine::bmh: return "bmh";
+      case search_engine::kr: return "kr";
+      case search_engine::aho_corasick: return "aho_corasick";
+    }
+    return "unknown";
+  }
+
+  // What the caller knows about the haystack; 0 means unknown
+  struct search_hints {
+    std::size_t alphabet_size{0};
+  };
+
+  namespace detail
+  {
+
+    /**
+     * Selection thresholds, read off my_search_selection_benchmarks (1 Mi
+     * element haystacks, absent pattern). On byte text memchr-driven naive
+     * search beats BMH below 16 symbols, below 4 on small alphabets. Wider
+     * keys pay a hash lookup per BMH shift, so BMH only wins from 32 symbols
+     * and never on small alphabets, where KR's rolling hash is fastest.
+     */
+    inline constexpr std::size_t search_small_alphabet      = 8;
+    inline constexpr std::size_t search_bmh_min_bytes       = 16;
+    inline constexpr std::size_t search_bmh_min_bytes_small = 4;
+    inline constexpr std::size_t search_bmh_min_wide        = 32;
+
+    template <typename Key_T>
+    inline constexpr bool is_hashable_key_v
+      = std::integral<Key_T>
+        or requires(Key_T const& k) { std::hash<Key_T>{}(k); };
+
+    template <typename Iterator_T, typename Key_T, typename BinaryPredicate_T>
+    constexpr search_engine selectEngine(std::size_t m, search_hints hints)
+    {
+      bool const small_alphabet = hints.alphabet_size != 0
+                                  and hints.alphabet_size <= search_small_alphabet;
+
+      // Skip tables and hashes are only sound under plain equality
+      if constexpr (not utils::detail::is_equality_predicate_v<BinaryPredicate_T>)
+        return search_engine::naive;
+
+      // Shifts cost one step per element on forward-only text; KMP never
+      // backs up
+      else if constexpr (not std::random_access_iterator<Iterator_T>)
+        return search_engine::kmp;
+
+      else if constexpr (utils::detail::is_byte_key_v<Key_T>) {
+        auto const bmh_from
+          = small_alphabet ? search_bmh_min_bytes_small : search_bmh_min_bytes;
+        return m < bmh_from ? search_engine::naive : search_engine::bmh;
+      }
+
+      else if constexpr (is_hashable_key_v<Key_T>) {
+        if (small_alphabet) return search_engine::kr;
+        return m < search_bmh_min_wide ? search_engine::naive
+                                       : search_engine::bmh;
+      }
+
+      else
+        return search_engine::naive;
+    }
+
+
+    /**
+     * Single-pattern search on the engine picked from the pattern length,
+     * the haystack iterator category, the key type, the predicate and an
+     * optional search_hints. engine() reports the choice without searching.
+     */
+    struct search_fn {
+
+      /**************************
+       *  Iterator Range Operator
+       */
+
+      // Type Generics
+      template <std::forward_iterator           Iterator_T,
+                std::sentinel_for<Iterator_T>   Sentinel_T,
+                std::forward_iterator           S_Iterator_T,
+                std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<Iterator_T, S_Iterator_T,
+                                          BinaryPredicate_T, Projection_T,
+                                          S_Projection_T>
+
+      // Return value
+      constexpr Iterator_T
+
+      // Call-operator signature
+      operator()(search_hints hints, Iterator_T first, Sentinel_T last,
+                 S_Iterator_T s_first, S_Sentinel_T s_last,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        using PatKey = utils::detail::pattern_key_t<S_Iterator_T, S_Projection_T>;
+        auto const m
+          = static_cast<std::size_t>(std::ranges::distance(s_first, s_last));
+
+        switch (selectEngine<Iterator_T, PatKey, BinaryPredicate_T>(m, hints)) {
+          case search_engine::kmp:
+            return kmp_search(first, last, s_first, s_last, std::move(pred),
+                              std::move(proj), std::move(s_proj));
+          case search_engine::bmh:
+            return bmh_search(first, last, s_first, s_last, std::move(pred),
+                              std::move(proj), std::move(s_proj));
+          case search_engine::kr:
+            return kr_search(first, last, s_first, s_last, std::move(pred),
+                             std::move(proj), std::move(s_proj));
+          default:
+            return naive_search(first, last, s_first, s_last, std::move(pred),
+                                std::move(proj), std::move(s_proj));
+        }
+      }
+
+      // Type Generics
+      template <std::forward_iterator           Iterator_T,
+                std::sentinel_for<Iterator_T>   Sentinel_T,
+                std::forward_iterator           S_Iterator_T,
+                std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<Iterator_T, S_Iterator_T,
+                                          BinaryPredicate_T, Projection_T,
+                                          S_Projection_T>
+
+      // Return value
+      constexpr Iterator_T
+
+      // Call-operator signature
+      operator()(Iterator_T first, Sentinel_T last,
+                 S_Iterator_T s_first, S_Sentinel_T s_last,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        return (*this)(search_hints{}, first, last, s_first, s_last,
+                       std::move(pred), std::move(proj), std::move(s_proj));
+      }
+
+      /******************
+       *  Ranges Operator
+       */
+
+      // Type Generics
+      template <std::ranges::forward_range Range_T,
+                std::ranges::forward_range S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<
+        std::ranges::iterator_t<Range_T>, std::ranges::iterator_t<S_Range_T>,
+        BinaryPredicate_T, Projection_T, S_Projection_T>
+
+      // Return value
+      constexpr std::ranges::iterator_t<Range_T>
+
+      // Call-operator signature
+      operator()(search_hints hints, Range_T&& range, S_Range_T&& s_range,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        return (*this)(hints, std::ranges::begin(range), std::ranges::end(range),
+                       std::ranges::begin(s_range), std::ranges::end(s_range),
+                       std::move(pred), std::move(proj), std::move(s_proj));
+      }
+
+      // Type Generics
+      template <std::ranges::forward_range Range_T,
+                std::ranges::forward_range S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<
+        std::ranges::iterator_t<Range_T>, std::ranges::iterator_t<S_Range_T>,
+        BinaryPredicate_T, Projection_T, S_Projection_T>
+
+      // Return value
+      constexpr std::ranges::iterator_t<Range_T>
+
+      // Call-operator signature
+      operator()(Range_T&& range, S_Range_T&& s_range,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        return (*this)(search_hints{}, std::forward<Range_T>(range),
+                       std::forward<S_Range_T>(s_range), std::move(pred),
+                       std::move(proj), std::move(s_proj));
+      }
+
+      /******************
+       *  Diagnostics
+       */
+
+      // Engine the call with the same arguments would run
+      template <std::ranges::forward_range Range_T,
+                std::ranges::forward_range S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+      constexpr search_engine engine(search_hints hints, Range_T&&,
+                                     S_Range_T&& s_range, BinaryPredicate_T = {},
+                                     Projection_T = {}, S_Projection_T = {}) const
+      {
+        using PatKey = utils::detail::pattern_key_t<
+          std::ranges::iterator_t<S_Range_T>, S_Projection_T>;
+        return selectEngine<std::ranges::iterator_t<Range_T>, PatKey,
+                            BinaryPredicate_T>(
+          static_cast<std::size_t>(std::ranges::distance(s_range)), hints);
+      }
+
+      template <std::ranges::forward_range Range_T,
+                std::ranges::forward_range S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+      constexpr search_engine engine(Range_T&& range, S_Range_T&& s_range,
+                                     BinaryPredicate_T pred = {},
+                                     Projection_T      proj = {},
+                                     S_Projection_T    s_proj = {}) const
+      {
+        return engine(search_hints{}, std::forward<Range_T>(range),
+                      std::forward<S_Range_T>(s_range), std::move(pred),
+                      std::move(proj), std::move(s_proj));
+      }
+
+    };
+
+
+    /**
+     * Dictionary search: Karp-Rabin over a hash set when all patterns have
+     * the same length, Aho-Corasick otherwise. Hits are ordered by offset,
+     * then pattern id, whichever engine runs.
+     */
+    struct multi_search_fn {
+
+      /**************************
+       *  Iterator Range Operator
+       */
+
+      // Type Generics
+      template <std::forward_iterator           Iterator_T,
+                std::sentinel_for<Iterator_T>   Sentinel_T,
+                std::forward_iterator           P_Iterator_T,
+                std::sentinel_for<P_Iterator_T> P_Sentinel_T,
+                typename Projection_T   = std::identity,
+                typename S_Projection_T = std::identity>
+
+      // Algorithm type requirements
+      requires std::ranges::forward_range<std::iter_reference_t<P_Iterator_T>>
+
+      // Return value
+      std::vector<aho_corasick_match>
+
+      // Call-operator signature
+      operator()(Iterator_T first, Sentinel_T last,
+                 P_Iterator_T p_first, P_Sentinel_T p_last,
+                 Projection_T proj = {}, S_Projection_T s_proj = {}) const
+      {
+        using PatKey = key_t<P_Iterator_T, S_Projection_T>;
+
+        std::vector<aho_corasick_match> hits;
+        if constexpr (is_hashable_key_v<PatKey>) {
+          if (engine(p_first, p_last, s_proj) == search_engine::kr) {
+            kr_set_matcher<PatKey>(p_first, p_last, std::move(s_proj))
+              .forEachMatch(
+                first, last,
+                [&hits](std::size_t id, std::size_t offset) {
+                  hits.push_back({id, offset});
+                },
+                std::move(proj));
+            return hits;
+          }
+        }
+
+        hits = aho_corasick_search(first, last, p_first, p_last,
+                                   std::move(proj), std::move(s_proj));
+        std::ranges::sort(hits, [](auto const& a, auto const& b) {
+          return std::tie(a.offset, a.pattern_id)
+                 < std::tie(b.offset, b.pattern_id);
+        });
+        return hits;
+      }
+
+      /******************
+       *  Ranges Operator
+       */
+
+      // Type Generics
+      template <std::ranges::forward_range Range_T,
+                std::ranges::forward_range P_Range_T,
+                typename Projection_T   = std::identity,
+                typename S_Projection_T = std::identity>
+
+      // Algorithm type requirements
+      requires std::ranges::forward_range<std::ranges::range_reference_t<P_Range_T>>
+
+      // Return value
+      std::vector<aho_corasick_match>
+
+      // Call-operator signature
+      operator()(Range_T&& range, P_Range_T&& patterns,
+                 Projection_T proj = {}, S_Projection_T s_proj = {}) const
+      {
+        return (*this)(std::ranges::begin(range), std::ranges::end(range),
+                       std::ranges::begin(patterns), std::ranges::end(patterns),
+                       std::move(proj), std::move(s_proj));
+      }
+
+      /******************
+       *  Diagnostics
+       */
+
+      // Engine the dictionary would be searched with
+      template <std::forward_iterator           P_Iterator_T,
+                std::sentinel_for<P_Iterator_T> P_Sentinel_T,
+                typename S_Projection_T = std::identity>
+      requires std::ranges::forward_range<std::iter_reference_t<P_Iterator_T>>
+      search_engine engine(P_Iterator_T p_first, P_Sentinel_T p_last,
+                           S_Projection_T const& = {}) const
+      {
+        if constexpr (not is_hashable_key_v<key_t<P_Iterator_T, S_Projection_T>>)
+          return search_engine::aho_corasick;
+
+        auto const length = [](auto&& pattern) {
+          return std::ranges::distance(pattern);
+        };
+        if (p_first == p_last) return search_engine::kr;
+
+        auto const m = length(*p_first);
+        for (auto it = std::ranges::next(p_first); it != p_last; ++it)
+          if (length(*it) != m) return search_engine::aho_corasick;
+        return search_engine::kr;
+      }
+
+      template <std::ranges::forward_range P_Range_T,
+                typename S_Projection_T = std::identity>
+      requires std::ranges::forward_range<std::ranges::range_reference_t<P_Range_T>>
+      search_engine engine(P_Range_T&& patterns, S_Projection_T const& s_proj = {}) const
+      {
+        return engine(std::ranges::begin(patterns), std::ranges::end(patterns),
+                      s_proj);
+      }
+
+    private:
+      template <typename P_Iterator_T, typename S_Projection_T>
+      using key_t = utils::detail::pattern_key_t<
+        std::ranges::iterator_t<std::iter_reference_t<P_Iterator_T>>,
+        S_Projection_T>;
+
+    };
+
+  }   // namespace detail
+
+  // Niebloid API Instantiation
+  inline constexpr detail::search_fn       search{};
+  inline constexpr detail::multi_search_fn multi_search{};
+
+}   // namespace dte3611::string_match::algorithms
+
+#endif   // DTE3611_WEEK1_STRING_MATCH_SEARCH_H
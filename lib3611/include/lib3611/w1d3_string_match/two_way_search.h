@@ -0,0 +1,323 @@
+#ifndef DTE3611_WEEK1_STRING_MATCH_TWO_WAY_SEARCH_H
+#define DTE3611_WEEK1_STRING_MATCH_TWO_WAY_SEARCH_H
+
+// utils
+#include "../utils/string_match_utils.h"
+
+// stl
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace dte3611::string_match::algorithms
+{
+  namespace detail
+  {
+
+    /**
+     * Critical factorization of the pattern, x = x[0, split) x[split, m).
+     * The right half is scanned left-to-right, the left half right-to-left;
+     * period is the shift after a full right-half match. For a periodic
+     * pattern, mem0 is the prefix already known to match after that shift.
+     */
+    struct two_way_factorization {
+      std::size_t split{0};
+      std::size_t period{1};
+      std::size_t mem0{0};
+    };
+
+    // Maximal suffix of the pattern under the given (or reversed) order
+    template <typename PatternAt_T>
+    constexpr std::pair<std::size_t, std::size_t>
+    twoWayMaxSuffix(PatternAt_T const& pat, std::size_t m, bool reversed)
+    {
+      std::size_t split = 0, jp = 0, k = 1, p = 1;
+      while (jp + k < m) {
+        auto const a = pat(split + k - 1);
+        auto const b = pat(jp + k);
+        if (std::ranges::equal_to{}(a, b)) {
+          if (k == p) {
+            jp += p;
+            k = 1;
+          }
+          else
+            ++k;
+        }
+        else if (reversed ? std::ranges::less{}(a, b)
+                          : std::ranges::less{}(b, a)) {
+          jp += k;
+          k = 1;
+          p = jp + 1 - split;
+        }
+        else {
+          split = ++jp;
+          k = p = 1;
+        }
+      }
+      return {split, p};
+    }
+
+    template <typename PatternAt_T>
+    constexpr two_way_factorization twoWayFactorize(PatternAt_T const& pat,
+                                                    std::size_t        m)
+    {
+      auto const [split_lt, period_lt] = twoWayMaxSuffix(pat, m, false);
+      auto const [split_gt, period_gt] = twoWayMaxSuffix(pat, m, true);
+
+      // The later of the two maximal suffixes gives a critical position
+      two_way_factorization f;
+      f.split  = std::max(split_lt, split_gt);
+      f.period = split_lt >= split_gt ? period_lt : period_gt;
+
+      // Is the left half a suffix of x[0, period + split), i.e. is the
+      // period of the right half a period of the whole pattern?
+      bool periodic = true;
+      for (std::size_t i = 0; periodic and i < f.split; ++i)
+        periodic = std::ranges::equal_to{}(pat(i), pat(i + f.period));
+
+      if (periodic)
+        f.mem0 = m - f.period;
+      else
+        f.period = std::max(f.split, m - f.split + 1);
+      return f;
+    }
+
+    // Scan [first, first + n) -- O(n + m) comparisons, O(1) extra space.
+    // Calls on_match(pos) per match until it returns false, and returns that
+    // position -- or n. After a match the scan shifts by the period and,
+    // for a periodic pattern, keeps the prefix it already knows
+    template <std::random_access_iterator Iterator_T, typename PatternAt_T,
+              typename BinaryPredicate_T, typename Projection_T,
+              typename OnMatch_T>
+    constexpr std::size_t
+    twoWayScan(Iterator_T first, std::size_t n, PatternAt_T const& pat,
+               std::size_t m, two_way_factorization const& f,
+               BinaryPredicate_T const& pred, Projection_T const& proj,
+               OnMatch_T&& on_match)
+    {
+      using Diff = std::iter_difference_t<Iterator_T>;
+      auto matches = [&](std::size_t i, std::size_t k) {
+        return std::invoke(pred,
+                           std::invoke(proj, first[static_cast<Diff>(i + k)]),
+                           pat(k));
+      };
+
+      std::size_t pos = 0, mem = 0;
+      while (n - pos >= m) {
+        // Right half, left to right
+        std::size_t k = std::max(f.split, mem);
+        while (k < m and matches(pos, k)) ++k;
+        if (k < m) {
+          pos += k - f.split + 1;
+          mem = 0;
+          continue;
+        }
+
+        // Left half, right to left -- down to what is already known
+        k = f.split;
+        while (k > mem and matches(pos, k - 1)) --k;
+        if (k <= mem and not on_match(pos)) return pos;
+
+        pos += f.period;
+        mem = f.mem0;
+      }
+      return n;
+    }
+
+    template <std::random_access_iterator Iterator_T, typename PatternAt_T,
+              typename BinaryPredicate_T, typename Projection_T>
+    constexpr Iterator_T
+    twoWayFind(Iterator_T first, std::size_t n, PatternAt_T const& pat,
+               std::size_t m, two_way_factorization const& f,
+               BinaryPredicate_T const& pred, Projection_T const& proj)
+    {
+      auto const pos = twoWayScan(first, n, pat, m, f, pred, proj,
+                                  [](std::size_t) { return false; });
+      return first + static_cast<std::iter_difference_t<Iterator_T>>(pos);
+    }
+
+    // Two-Way orders the pattern symbols and needs plain equality to match
+    template <typename Key_T, typename BinaryPredicate_T>
+    concept TwoWayComparable
+      = std::totally_ordered<Key_T>
+        and utils::detail::is_equality_predicate_v<BinaryPredicate_T>;
+
+
+    /**
+     * Preprocessed Two-Way matcher -- projected pattern and its critical
+     * factorization. Searching allocates nothing.
+     */
+    template <typename Key_T, typename BinaryPredicate_T = std::ranges::equal_to>
+    requires TwoWayComparable<Key_T, BinaryPredicate_T>
+    class two_way_matcher {
+    public:
+      template <std::forward_iterator           S_Iterator_T,
+                std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+                typename S_Projection_T = std::identity>
+      constexpr two_way_matcher(S_Iterator_T s_first, S_Sentinel_T s_last,
+                                BinaryPredicate_T pred   = {},
+                                S_Projection_T    s_proj = {})
+        : m_pat{utils::detail::materializePattern<Key_T>(s_first, s_last,
+                                                          s_proj)},
+          m_pred{std::move(pred)}
+      {
+        if (not m_pat.empty()) m_fact = twoWayFactorize(patternAt(), m_pat.size());
+      }
+
+      constexpr std::size_t size() const { return m_pat.size(); }
+
+      // Two-Way steps backwards through the haystack
+      template <std::random_access_iterator         Iterator_T,
+                std::sized_sentinel_for<Iterator_T> Sentinel_T,
+                typename Projection_T = std::identity>
+      constexpr Iterator_T find(Iterator_T first, Sentinel_T last,
+                                Projection_T proj = {}) const
+      {
+        auto const n = static_cast<std::size_t>(last - first);
+        if (m_pat.empty()) return first;
+        if (m_pat.size() > n) return first + (last - first);
+
+        return twoWayFind(first, n, patternAt(), m_pat.size(), m_fact, m_pred,
+                          proj);
+      }
+
+      /**
+       * sink(it) for every (possibly overlapping) match; an empty pattern
+       * reports nothing. One scan serves all matches, so it stays O(n + m)
+       * comparisons also on periodic text.
+       */
+      template <std::random_access_iterator         Iterator_T,
+                std::sized_sentinel_for<Iterator_T> Sentinel_T,
+                typename Sink_T, typename Projection_T = std::identity>
+      requires std::invocable<Sink_T&, Iterator_T>
+      constexpr void forEachMatch(Iterator_T first, Sentinel_T last,
+                                  Sink_T&& sink, Projection_T proj = {}) const
+      {
+        auto const n = static_cast<std::size_t>(last - first);
+        if (m_pat.empty() or m_pat.size() > n) return;
+
+        twoWayScan(first, n, patternAt(), m_pat.size(), m_fact, m_pred, proj,
+                   [&](std::size_t pos) {
+                     std::invoke(
+                       sink,
+                       first + static_cast<std::iter_difference_t<Iterator_T>>(pos));
+                     return true;
+                   });
+      }
+
+    private:
+      constexpr auto patternAt() const
+      {
+        return [this](std::size_t i) -> Key_T const& { return m_pat[i]; };
+      }
+
+      std::vector<Key_T>                      m_pat;
+      two_way_factorization                   m_fact;
+      [[no_unique_address]] BinaryPredicate_T m_pred;
+    };
+
+
+    struct two_way_search_fn {
+
+      // Preprocessed matcher type -- see compile_pattern
+      template <typename Key_T, typename BinaryPredicate_T>
+      using matcher = two_way_matcher<Key_T, BinaryPredicate_T>;
+
+      /**************************
+       *  Iterator Range Operator
+       */
+
+      // Type Generics
+      template <std::random_access_iterator           Iterator_T,
+                std::sized_sentinel_for<Iterator_T>   Sentinel_T,
+                std::random_access_iterator           S_Iterator_T,
+                std::sized_sentinel_for<S_Iterator_T> S_Sentinel_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::indirectly_comparable<Iterator_T, S_Iterator_T,
+                                          BinaryPredicate_T, Projection_T,
+                                          S_Projection_T>
+               and TwoWayComparable<
+                 utils::detail::pattern_key_t<S_Iterator_T, S_Projection_T>,
+                 BinaryPredicate_T>
+
+      // Return value
+      constexpr Iterator_T
+
+      // Call-operator signature
+      operator()(Iterator_T first, Sentinel_T last,
+                 S_Iterator_T s_first, S_Sentinel_T s_last,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        auto const n = static_cast<std::size_t>(last - first);
+        auto const m = static_cast<std::size_t>(s_last - s_first);
+
+        // Empty pattern matches at first
+        if (m == 0) return first;
+        if (m > n) return first + (last - first);
+
+        // The pattern is read in place -- nothing is materialized
+        using S_Diff = std::iter_difference_t<S_Iterator_T>;
+        auto const pat = [&s_first, &s_proj](std::size_t i) {
+          return std::invoke(s_proj, s_first[static_cast<S_Diff>(i)]);
+        };
+
+        return twoWayFind(first, n, pat, m, twoWayFactorize(pat, m), pred,
+                          proj);
+      }
+
+      /******************
+       *  Ranges Operator
+       */
+
+      // Type Generics
+      template <std::ranges::random_access_range Range_T,
+                std::ranges::random_access_range S_Range_T,
+                typename BinaryPredicate_T = std::ranges::equal_to,
+                typename Projection_T      = std::identity,
+                typename S_Projection_T    = std::identity>
+
+      // Algorithm type requirements
+      requires std::ranges::sized_range<Range_T>
+               and std::ranges::sized_range<S_Range_T>
+               and std::indirectly_comparable<
+                 std::ranges::iterator_t<Range_T>,
+                 std::ranges::iterator_t<S_Range_T>, BinaryPredicate_T,
+                 Projection_T, S_Projection_T>
+               and TwoWayComparable<
+                 utils::detail::pattern_key_t<std::ranges::iterator_t<S_Range_T>,
+                                              S_Projection_T>,
+                 BinaryPredicate_T>
+
+      // Return value
+      constexpr std::ranges::iterator_t<Range_T>
+
+      // Call-operator signature
+      operator()(Range_T&& range, S_Range_T&& s_range,
+                 BinaryPredicate_T pred = {}, Projection_T proj = {},
+                 S_Projection_T s_proj = {}) const
+      {
+        auto const first   = std::ranges::begin(range);
+        auto const s_first = std::ranges::begin(s_range);
+        return (*this)(first, first + std::ranges::ssize(range), s_first,
+                       s_first + std::ranges::ssize(s_range), std::move(pred),
+                       std::move(proj), std::move(s_proj));
+      }
+
+    };
+
+  }   // namespace detail
+
+  // Niebloid API Instantiation
+  inline constexpr detail::two_way_search_fn two_way_search{};
+
+}   // namespace dte3611::string_match::algorithms
+
+#endif   // DTE3611_WEEK1_STRING_MATCH_TWO_WAY_SEARCH_H
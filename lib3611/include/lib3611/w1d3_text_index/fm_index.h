@@ -0,0 +1,517 @@
+#ifndef DTE3611_WEEK1_TEXT_INDEX_FM_INDEX_H
+#define DTE3611_WEEK1_TEXT_INDEX_FM_INDEX_H
+
+// text index
+#include "suffix_array.h"
+
+// utils
+#include "../utils/mapped_file.h"
+
+// stl
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace dte3611::text_index
+{
+
+  namespace detail
+  {
+
+    /**
+     * Read-only view of a bitvector with rank support: words holds the bits,
+     * blocks[k] the number of ones in words [0, 8k), i.e. one cumulative
+     * count per 512 bits (12.5% overhead).
+     */
+    struct rank_bitvector_view {
+      std::span<std::uint64_t const> words;
+      std::span<std::uint64_t const> blocks;
+
+      static constexpr std::size_t wordCount(std::size_t bits)
+      {
+        return (bits + 63) / 64;
+      }
+      static constexpr std::size_t blockCount(std::size_t bits)
+      {
+        return wordCount(bits) / 8 + 1;
+      }
+
+      bool operator[](std::size_t i) const
+      {
+        return (words[i / 64] >> (i % 64)) & 1u;
+      }
+
+      // Ones in [0, i)
+      std::size_t rank1(std::size_t i) const
+      {
+        std::size_t const w = i / 64;
+        std::size_t       r = blocks[w / 8];
+        for (std::size_t k = w & ~std::size_t{7}; k < w; ++k)
+          r += static_cast<std::size_t>(std::popcount(words[k]));
+        if (i % 64)
+          r += static_cast<std::size_t>(
+            std::popcount(words[w] & ((std::uint64_t{1} << (i % 64)) - 1)));
+        return r;
+      }
+
+      std::size_t rank0(std::size_t i) const { return i - rank1(i); }
+
+      // Fill blocks from words
+      static void buildBlocks(std::span<std::uint64_t const> words,
+                              std::span<std::uint64_t>       blocks)
+      {
+        std::uint64_t sum = 0;
+        for (std::size_t k = 0; k < blocks.size(); ++k) {
+          blocks[k] = sum;
+          for (std::size_t w = 8 * k; w < std::min(8 * k + 8, words.size()); ++w)
+            sum += static_cast<std::uint64_t>(std::popcount(words[w]));
+        }
+      }
+    };
+
+    // Fixed-width bit-packed unsigned integers
+    struct packed_ints_view {
+      std::span<std::uint64_t const> words;
+      unsigned                       width{1};
+
+      static constexpr std::size_t wordCount(std::size_t count, unsigned width)
+      {
+        return (count * width + 63) / 64;
+      }
+
+      std::uint64_t operator[](std::size_t i) const
+      {
+        std::size_t const bit  = i * width;
+        std::size_t const w    = bit / 64;
+        auto const        off  = static_cast<unsigned>(bit % 64);
+        std::uint64_t     v    = words[w] >> off;
+        if (off + width > 64) v |= words[w + 1] << (64 - off);
+        return width == 64 ? v : v & ((std::uint64_t{1} << width) - 1);
+      }
+
+      static void set(std::span<std::uint64_t> words, unsigned width,
+                      std::size_t i, std::uint64_t v)
+      {
+        std::size_t const bit = i * width;
+        std::size_t const w   = bit / 64;
+        auto const        off = static_cast<unsigned>(bit % 64);
+        words[w] |= v << off;
+        if (off + width > 64) words[w + 1] |= v >> (64 - off);
+      }
+    };
+
+  }   // namespace detail
+
+
+  /**
+   * FM-index over a byte text: the Burrows-Wheeler transform stored as a
+   * wavelet matrix over the text's own alphabet (ceil(log2(sigma + 1))
+   * bits per symbol, e.g. 3 bits for DNA), plus every sample_rate-th
+   * suffix array entry for locate.
+   *
+   *  count   backward search, O(m log sigma)
+   *  locate  count + at most sample_rate - 1 LF steps per occurrence
+   *
+   * The whole index is a single flat image of 64-bit words. save() writes
+   * it verbatim and load() maps the file read-only, so a saved index is
+   * queryable without being read into memory first.
+   */
+  class fm_index {
+  public:
+    static constexpr std::size_t default_sample_rate = 32;
+
+    fm_index() = default;
+
+    template <std::forward_iterator         Iterator_T,
+              std::sentinel_for<Iterator_T> Sentinel_T,
+              typename Projection_T = std::identity>
+    requires string_match::utils::detail::is_byte_key_v<
+      std::remove_cvref_t<std::indirect_result_t<Projection_T&, Iterator_T>>>
+    fm_index(Iterator_T first, Sentinel_T last, Projection_T proj = {},
+             std::size_t sample_rate = default_sample_rate)
+    {
+      std::vector<unsigned char> text;
+      for (; first != last; ++first)
+        text.push_back(static_cast<unsigned char>(
+          detail::byteIndex(std::invoke(proj, *first))));
+      build(text, std::max<std::size_t>(sample_rate, 1));
+    }
+
+    template <std::ranges::forward_range Range_T,
+              typename Projection_T = std::identity>
+    requires string_match::utils::detail::is_byte_key_v<std::remove_cvref_t<
+      std::indirect_result_t<Projection_T&, std::ranges::iterator_t<Range_T>>>>
+    explicit fm_index(Range_T&& range, Projection_T proj = {},
+                      std::size_t sample_rate = default_sample_rate)
+      : fm_index(std::ranges::begin(range), std::ranges::end(range),
+                 std::move(proj), sample_rate)
+    {
+    }
+
+    std::size_t size() const { return m_n; }
+    std::size_t sampleRate() const { return m_sample_rate; }
+
+    // Size of the index image in bytes
+    std::size_t byteSize() const { return m_image.size_bytes(); }
+
+    // Number of occurrences; an empty pattern occurs at every position
+    template <std::ranges::forward_range S_Range_T,
+              typename S_Projection_T = std::identity>
+    std::size_t count(S_Range_T&& s_range, S_Projection_T s_proj = {}) const
+    {
+      auto const [sp, ep]
+        = backwardSearch(std::ranges::begin(s_range), std::ranges::end(s_range),
+                         s_proj);
+      return ep - sp;
+    }
+
+    // Start offsets of all occurrences, in suffix order
+    template <std::ranges::forward_range S_Range_T,
+              typename S_Projection_T = std::identity>
+    std::vector<std::size_t> locate(S_Range_T&&    s_range,
+                                    S_Projection_T s_proj = {}) const
+    {
+      auto const [sp, ep]
+        = backwardSearch(std::ranges::begin(s_range), std::ranges::end(s_range),
+                         s_proj);
+
+      std::vector<std::size_t> hits;
+      hits.reserve(ep - sp);
+      for (std::size_t row = sp; row < ep; ++row) hits.push_back(locateRow(row));
+      return hits;
+    }
+
+
+    /******************
+     *  Serialization
+     */
+
+    void save(std::filesystem::path const& path) const
+    {
+      std::ofstream out(path, std::ios::binary | std::ios::trunc);
+      if (not out) throw std::runtime_error("cannot write " + path.string());
+      out.write(reinterpret_cast<char const*>(m_image.data()),
+                static_cast<std::streamsize>(m_image.size_bytes()));
+      if (not out) throw std::runtime_error("failed writing " + path.string());
+    }
+
+    // Queries read straight from the mapping; random access, so no read-ahead
+    static fm_index load(std::filesystem::path const& path,
+                         utils::MapHints hints = {.sequential = false})
+    {
+      auto file = std::make_shared<utils::MappedFile const>(path, hints);
+      if (file->size() % sizeof(std::uint64_t) != 0)
+        throw std::runtime_error("not an FM-index image: " + path.string());
+
+      std::span<std::uint64_t const> const image(
+        reinterpret_cast<std::uint64_t const*>(file->data()),
+        file->size() / sizeof(std::uint64_t));
+
+      fm_index index;
+      index.attach(image, std::move(file), path.string());
+      return index;
+    }
+
+  private:
+    /**
+     * Image layout, in 64-bit words:
+     *   header[header_words]
+     *   code[256]          byte -> symbol code, 0 if absent (0 = sentinel)
+     *   C[sigma + 1]       symbols with a smaller code
+     *   zeros[levels]      zero bits per wavelet level
+     *   per level          bitvector words, rank blocks
+     *   marks              bitvector words, rank blocks (sampled BWT rows)
+     *   samples            bit-packed text positions of the sampled rows
+     */
+    enum Header : std::size_t {
+      h_magic, h_version, h_n, h_sigma, h_levels, h_sample_rate, h_sample_width,
+      h_samples, header_words
+    };
+    static constexpr std::uint64_t magic   = 0x4d46'3131'3633'4554;   // "TE3611FM"
+    static constexpr std::uint64_t version = 1;
+
+    struct Layout {
+      std::size_t code, c, zeros, levels, level_stride, marks, samples, total;
+
+      Layout(std::size_t n, std::size_t sigma, std::size_t levels_n,
+             std::size_t n_samples, unsigned sample_width)
+      {
+        using BV             = detail::rank_bitvector_view;
+        std::size_t const rows = n + 1;
+
+        code         = header_words;
+        c            = code + 256;
+        zeros        = c + sigma + 1;
+        levels       = zeros + levels_n;
+        level_stride = BV::wordCount(rows) + BV::blockCount(rows);
+        marks        = levels + levels_n * level_stride;
+        samples      = marks + level_stride;
+        total        = samples
+                + detail::packed_ints_view::wordCount(n_samples, sample_width);
+      }
+    };
+
+    void build(std::vector<unsigned char> const& text, std::size_t sample_rate)
+    {
+      // 32-bit suffix array entries while the text allows it
+      if (text.size() < std::numeric_limits<std::uint32_t>::max())
+        build<std::uint32_t>(text, sample_rate);
+      else
+        build<std::uint64_t>(text, sample_rate);
+    }
+
+    template <std::unsigned_integral Index_T>
+    void build(std::vector<unsigned char> const& text, std::size_t sample_rate)
+    {
+      using BV = detail::rank_bitvector_view;
+
+      std::size_t const n    = text.size();
+      std::size_t const rows = n + 1;
+
+      // Dense codes for the bytes present; 0 is the sentinel
+      std::array<std::uint64_t, 256> code{};
+      for (auto const b : text) code[b] = 1;
+      std::size_t sigma = 1;
+      for (auto& c : code)
+        if (c) c = sigma++;
+
+      std::size_t const levels = std::max<std::size_t>(
+        1, static_cast<std::size_t>(std::bit_width(sigma - 1)));
+
+      // Suffix array with the sentinel row first
+      auto sa = detail::buildSuffixArray<Index_T>(text);
+      sa.insert(sa.begin(), static_cast<Index_T>(n));
+
+      std::vector<std::uint32_t> bwt(rows);
+      for (std::size_t i = 0; i < rows; ++i)
+        bwt[i] = sa[i] == 0 ? 0u : static_cast<std::uint32_t>(code[text[sa[i] - 1]]);
+
+      std::size_t n_samples = 0;
+      for (std::size_t i = 0; i < rows; ++i)
+        if (sa[i] % sample_rate == 0) ++n_samples;
+      auto const width = static_cast<unsigned>(std::max<std::size_t>(1, std::bit_width(n)));
+
+      Layout const layout(n, sigma, levels, n_samples, width);
+      auto storage = std::make_shared<std::vector<std::uint64_t>>(layout.total, 0);
+      std::span<std::uint64_t> const img(*storage);
+
+      img[h_magic]        = magic;
+      img[h_version]      = version;
+      img[h_n]            = n;
+      img[h_sigma]        = sigma;
+      img[h_levels]       = levels;
+      img[h_sample_rate]  = sample_rate;
+      img[h_sample_width] = width;
+      img[h_samples]      = n_samples;
+      std::ranges::copy(code, img.begin() + static_cast<std::ptrdiff_t>(layout.code));
+
+      // C array
+      std::vector<std::uint64_t> freq(sigma + 1, 0);
+      for (auto const s : bwt) ++freq[s + 1];
+      std::partial_sum(freq.begin(), freq.end(),
+                       img.begin() + static_cast<std::ptrdiff_t>(layout.c));
+
+      // Wavelet matrix: stable-partition the BWT codes level by level, MSB first
+      std::vector<std::uint32_t> cur = std::move(bwt), next(rows);
+      for (std::size_t l = 0; l < levels; ++l) {
+        auto const words = img.subspan(layout.levels + l * layout.level_stride,
+                                       BV::wordCount(rows));
+        auto const blocks = img.subspan(
+          layout.levels + l * layout.level_stride + BV::wordCount(rows),
+          BV::blockCount(rows));
+        auto const shift = levels - 1 - l;
+
+        std::size_t zeros = 0;
+        for (std::size_t i = 0; i < rows; ++i)
+          if ((cur[i] >> shift) & 1u)
+            words[i / 64] |= std::uint64_t{1} << (i % 64);
+          else
+            ++zeros;
+        BV::buildBlocks(words, blocks);
+        img[layout.zeros + l] = zeros;
+
+        std::size_t z = 0, o = zeros;
+        for (auto const s : cur) next[(s >> shift) & 1u ? o++ : z++] = s;
+        std::swap(cur, next);
+      }
+
+      // Sampled rows and their text positions
+      auto const marks = img.subspan(layout.marks, BV::wordCount(rows));
+      auto const samples = img.subspan(layout.samples);
+      for (std::size_t i = 0, k = 0; i < rows; ++i) {
+        if (sa[i] % sample_rate != 0) continue;
+        marks[i / 64] |= std::uint64_t{1} << (i % 64);
+        detail::packed_ints_view::set(samples, width, k++, sa[i]);
+      }
+      BV::buildBlocks(marks, img.subspan(layout.marks + BV::wordCount(rows),
+                                         BV::blockCount(rows)));
+
+      attach(img, std::move(storage), "<memory>");
+    }
+
+    // Validate an image and point the views into it. The header, codes, C
+    // array and zero counts are checked; the bitvectors and samples are
+    // trusted, i.e. load only files written by save()
+    void attach(std::span<std::uint64_t const> img,
+                std::shared_ptr<void const> storage, std::string const& what)
+    {
+      using BV = detail::rank_bitvector_view;
+      auto bad = [&what] {
+        throw std::runtime_error("not a compatible FM-index image: " + what);
+      };
+
+      if (img.size() < header_words or img[h_magic] != magic
+          or img[h_version] != version or img[h_levels] == 0
+          or img[h_levels] > 32 or img[h_sample_width] == 0
+          or img[h_sample_width] > 64)
+        bad();
+
+      m_n           = img[h_n];
+      m_sigma       = img[h_sigma];
+      m_levels      = img[h_levels];
+      m_sample_rate = img[h_sample_rate];
+
+      // Bound the sizes before the layout arithmetic: at most 256 bytes and
+      // the sentinel, codes that fit the levels, one bit per row in the image
+      if (m_sigma == 0 or m_sigma > 257 or m_sigma > (std::size_t{1} << m_levels)
+          or m_n >= img.size() * 64 or img[h_samples] > m_n + 1)
+        bad();
+
+      std::size_t const rows = m_n + 1;
+      Layout const      layout(m_n, m_sigma, m_levels, img[h_samples],
+                               static_cast<unsigned>(img[h_sample_width]));
+      if (img.size() != layout.total) bad();
+
+      // Symbol codes index C and select wavelet paths; C partitions the rows
+      auto const code = img.subspan(layout.code, 256);
+      auto const c    = img.subspan(layout.c, m_sigma + 1);
+      if (std::ranges::any_of(code, [this](auto s) { return s >= m_sigma; })
+          or c.front() != 0 or c.back() != rows
+          or not std::ranges::is_sorted(c)
+          or std::ranges::any_of(img.subspan(layout.zeros, m_levels),
+                                 [rows](auto z) { return z > rows; }))
+        bad();
+
+      m_code  = code;
+      m_c     = c;
+      m_zeros = img.subspan(layout.zeros, m_levels);
+      m_wavelet.clear();
+      for (std::size_t l = 0; l < m_levels; ++l) {
+        auto const base = layout.levels + l * layout.level_stride;
+        m_wavelet.push_back(
+          {img.subspan(base, BV::wordCount(rows)),
+           img.subspan(base + BV::wordCount(rows), BV::blockCount(rows))});
+      }
+      m_marks   = {img.subspan(layout.marks, BV::wordCount(rows)),
+                   img.subspan(layout.marks + BV::wordCount(rows),
+                               BV::blockCount(rows))};
+      m_samples = {img.subspan(layout.samples),
+                   static_cast<unsigned>(img[h_sample_width])};
+
+      m_image   = img;
+      m_storage = std::move(storage);
+    }
+
+    // Occurrences of symbol s among the first i BWT rows
+    std::size_t rank(std::size_t s, std::size_t i) const
+    {
+      std::size_t lo = 0;
+      for (std::size_t l = 0; l < m_levels; ++l) {
+        auto const& bv = m_wavelet[l];
+        if ((s >> (m_levels - 1 - l)) & 1u) {
+          lo = m_zeros[l] + bv.rank1(lo);
+          i  = m_zeros[l] + bv.rank1(i);
+        }
+        else {
+          lo = bv.rank0(lo);
+          i  = bv.rank0(i);
+        }
+      }
+      return i - lo;
+    }
+
+    // BWT symbol at row i
+    std::size_t access(std::size_t i) const
+    {
+      std::size_t s = 0;
+      for (std::size_t l = 0; l < m_levels; ++l) {
+        auto const& bv  = m_wavelet[l];
+        bool const  bit = bv[i];
+        s               = (s << 1) | bit;
+        i = bit ? m_zeros[l] + bv.rank1(i) : bv.rank0(i);
+      }
+      return s;
+    }
+
+    // Row of the suffix one position to the left
+    std::size_t lf(std::size_t row) const
+    {
+      auto const s = access(row);
+      return m_c[s] + rank(s, row);
+    }
+
+    std::size_t locateRow(std::size_t row) const
+    {
+      std::size_t steps = 0;
+      while (not m_marks[row]) {
+        row = lf(row);
+        ++steps;
+      }
+      return m_samples[m_marks.rank1(row)] + steps;
+    }
+
+    // Row interval [sp, ep) of the suffixes prefixed by the pattern
+    template <typename S_Iterator_T, typename S_Sentinel_T, typename S_Projection_T>
+    std::pair<std::size_t, std::size_t>
+    backwardSearch(S_Iterator_T s_first, S_Sentinel_T s_last,
+                   S_Projection_T& s_proj) const
+    {
+      std::vector<unsigned char> pat;
+      for (; s_first != s_last; ++s_first)
+        pat.push_back(static_cast<unsigned char>(
+          detail::byteIndex(std::invoke(s_proj, *s_first))));
+
+      // Skip the sentinel row -- it is no text position
+      if (pat.empty()) return {1, m_n + 1};
+
+      std::size_t sp = 0, ep = m_n + 1;
+      for (auto it = pat.rbegin(); it != pat.rend() and sp < ep; ++it) {
+        if (m_code.empty() or m_code[*it] == 0) return {0, 0};
+        auto const s = m_code[*it];
+        sp           = m_c[s] + rank(s, sp);
+        ep           = m_c[s] + rank(s, ep);
+      }
+      return {sp, std::max(sp, ep)};
+    }
+
+    std::size_t                              m_n{0};
+    std::size_t                              m_sigma{0};
+    std::size_t                              m_levels{0};
+    std::size_t                              m_sample_rate{default_sample_rate};
+    std::span<std::uint64_t const>           m_code;
+    std::span<std::uint64_t const>           m_c;
+    std::span<std::uint64_t const>           m_zeros;
+    std::vector<detail::rank_bitvector_view> m_wavelet;
+    detail::rank_bitvector_view              m_marks;
+    detail::packed_ints_view                 m_samples;
+    std::span<std::uint64_t const>           m_image;
+    std::shared_ptr<void const>              m_storage;   // vector or mapping
+  };
+
+}   // namespace dte3611::text_index
+
+#endif   // DTE3611_WEEK1_TEXT_INDEX_FM_INDEX_H
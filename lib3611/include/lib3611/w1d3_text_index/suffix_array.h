@@ -0,0 +1,505 @@
+#ifndef DTE3611_WEEK1_TEXT_INDEX_SUFFIX_ARRAY_H
+#define DTE3611_WEEK1_TEXT_INDEX_SUFFIX_ARRAY_H
+
+// utils
+#include "../utils/string_match_utils.h"
+
+// stl
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dte3611::text_index
+{
+
+  namespace detail
+  {
+
+    using string_match::utils::detail::byteIndex;
+    using string_match::utils::detail::is_byte_key_v;
+
+    // Symbol order used by the index: unsigned for bytes, operator< otherwise
+    template <typename Key_T>
+    constexpr bool keyLess(Key_T const& a, Key_T const& b)
+    {
+      if constexpr (is_byte_key_v<Key_T>)
+        return byteIndex(a) < byteIndex(b);
+      else
+        return std::ranges::less{}(a, b);
+    }
+
+    /**
+     * Map the text onto dense ranks 1..sigma and append the sentinel 0, as
+     * SA-IS expects. Returns the ranked text and the alphabet size + 1.
+     */
+    template <std::unsigned_integral Index_T, typename Key_T>
+    std::pair<std::vector<Index_T>, std::size_t>
+    rankText(std::vector<Key_T> const& text)
+    {
+      std::vector<Index_T> ranked(text.size() + 1, 0);
+
+      if constexpr (is_byte_key_v<Key_T>) {
+        for (std::size_t i = 0; i < text.size(); ++i)
+          ranked[i] = static_cast<Index_T>(byteIndex(text[i]) + 1);
+        return {std::move(ranked), 257};
+      }
+      else {
+        auto alphabet = text;
+        std::ranges::sort(alphabet, keyLess<Key_T>);
+        auto const dup = std::ranges::unique(alphabet);
+        alphabet.erase(dup.begin(), dup.end());
+
+        for (std::size_t i = 0; i < text.size(); ++i)
+          ranked[i] = static_cast<Index_T>(
+            std::ranges::lower_bound(alphabet, text[i], keyLess<Key_T>)
+            - alphabet.begin() + 1);
+        return {std::move(ranked), alphabet.size() + 1};
+      }
+    }
+
+    /**
+     * SA-IS (Nong, Zhang & Chan) -- linear-time suffix sorting by induced
+     * sorting. s holds symbols in [0, K) and ends in a unique sentinel 0.
+     */
+    template <std::unsigned_integral Index_T>
+    void saIs(std::span<Index_T const> s, std::span<Index_T> sa, std::size_t K)
+    {
+      constexpr Index_T empty = std::numeric_limits<Index_T>::max();
+      std::size_t const n     = s.size();
+
+      if (n == 1) {
+        sa[0] = 0;
+        return;
+      }
+
+      // S/L types -- S: suffix i is smaller than suffix i + 1
+      std::vector<std::uint8_t> is_s(n, 0);
+      is_s[n - 1] = 1;
+      for (std::size_t i = n - 1; i-- > 0;)
+        is_s[i] = s[i] < s[i + 1] or (s[i] == s[i + 1] and is_s[i + 1]);
+
+      auto const is_lms = [&is_s](std::size_t i) {
+        return i > 0 and is_s[i] and not is_s[i - 1];
+      };
+
+      std::vector<Index_T> counts(K, 0);
+      for (auto const c : s) ++counts[c];
+
+      std::vector<Index_T> bucket(K);
+      auto bucketStarts = [&] {
+        Index_T sum = 0;
+        for (std::size_t c = 0; c < K; ++c) {
+          bucket[c] = sum;
+          sum += counts[c];
+        }
+      };
+      auto bucketEnds = [&] {
+        Index_T sum = 0;
+        for (std::size_t c = 0; c < K; ++c) {
+          sum += counts[c];
+          bucket[c] = sum;
+        }
+      };
+
+      // Seed the LMS suffixes in the given order, then induce L and S types
+      auto induce = [&](std::vector<Index_T> const& lms) {
+        std::ranges::fill(sa, empty);
+
+        bucketEnds();
+        for (auto it = lms.rbegin(); it != lms.rend(); ++it)
+          sa[--bucket[s[*it]]] = *it;
+
+        bucketStarts();
+        for (std::size_t i = 0; i < n; ++i) {
+          Index_T const j = sa[i];
+          if (j != empty and j > 0 and not is_s[j - 1])
+            sa[bucket[s[j - 1]]++] = j - 1;
+        }
+
+        bucketEnds();
+        for (std::size_t i = n; i-- > 0;) {
+          Index_T const j = sa[i];
+          if (j != empty and j > 0 and is_s[j - 1])
+            sa[--bucket[s[j - 1]]] = j - 1;
+        }
+      };
+
+      // 1. Sort the LMS substrings
+      std::vector<Index_T> lms;
+      for (std::size_t i = 1; i < n; ++i)
+        if (is_lms(i)) lms.push_back(static_cast<Index_T>(i));
+      induce(lms);
+
+      // 2. Name them; equal LMS substrings share a name
+      auto const equalLms = [&](std::size_t p, std::size_t q) {
+        for (std::size_t d = 0;; ++d) {
+          if (s[p + d] != s[q + d] or is_s[p + d] != is_s[q + d]) return false;
+          if (d > 0 and (is_lms(p + d) or is_lms(q + d)))
+            return is_lms(p + d) and is_lms(q + d);
+        }
+      };
+
+      std::vector<Index_T> name_of(n, empty);
+      Index_T              names = 0;
+      std::size_t          prev  = n;
+      for (std::size_t i = 0; i < n; ++i) {
+        std::size_t const p = sa[i];
+        if (not is_lms(p)) continue;
+        if (prev == n or not equalLms(prev, p)) ++names;
+        name_of[p] = names - 1;
+        prev       = p;
+      }
+
+      std::vector<Index_T> reduced;
+      reduced.reserve(lms.size());
+      for (auto const p : lms) reduced.push_back(name_of[p]);
+
+      // 3. Sort the reduced problem -- recursively unless names are unique
+      std::vector<Index_T> reduced_sa(lms.size());
+      if (names < lms.size())
+        saIs<Index_T>(reduced, reduced_sa, names);
+      else
+        for (std::size_t i = 0; i < reduced.size(); ++i)
+          reduced_sa[reduced[i]] = static_cast<Index_T>(i);
+
+      // 4. Induce the full order from the sorted LMS suffixes
+      std::vector<Index_T> sorted_lms;
+      sorted_lms.reserve(lms.size());
+      for (auto const r : reduced_sa) sorted_lms.push_back(lms[r]);
+      induce(sorted_lms);
+    }
+
+    // Kasai et al. -- lcp[i] = lcp(suffix sa[i - 1], suffix sa[i]), lcp[0] = 0
+    template <std::unsigned_integral Index_T, typename Key_T>
+    std::vector<Index_T> kasaiLcp(std::vector<Key_T> const&   text,
+                                  std::vector<Index_T> const& sa)
+    {
+      std::size_t const    n = text.size();
+      std::vector<Index_T> rank(n), lcp(n, 0);
+      for (std::size_t i = 0; i < n; ++i) rank[sa[i]] = static_cast<Index_T>(i);
+
+      for (std::size_t i = 0, h = 0; i < n; ++i) {
+        if (rank[i] == 0) {
+          h = 0;
+          continue;
+        }
+        std::size_t const j = sa[rank[i] - 1];
+        while (i + h < n and j + h < n and text[i + h] == text[j + h]) ++h;
+        lcp[rank[i]] = static_cast<Index_T>(h);
+        if (h > 0) --h;
+      }
+      return lcp;
+    }
+
+    // Suffix array of a projected text, sentinel removed
+    template <std::unsigned_integral Index_T, typename Key_T>
+    std::vector<Index_T> buildSuffixArray(std::vector<Key_T> const& text)
+    {
+      if (text.size() >= std::numeric_limits<Index_T>::max())
+        throw std::length_error("text too long for the suffix array index type");
+
+      auto const [ranked, alphabet] = rankText<Index_T>(text);
+      std::vector<Index_T> sa(ranked.size());
+      saIs<Index_T>(ranked, sa, alphabet);
+
+      sa.erase(sa.begin());   // the sentinel suffix sorts first
+      return sa;
+    }
+
+  }   // namespace detail
+
+
+  /**
+   * Suffix array + LCP index over a fixed text. The text is projected once
+   * at construction; queries project the pattern with s_proj, following the
+   * string_match conventions. count/locate binary search the suffix array,
+   * skipping prefixes already known to match via precomputed LCP-LR values,
+   * for O(m + log n) symbol comparisons per bound.
+   *
+   * The index round-trips through save()/load() (trivially copyable keys).
+   * load() checks the header, the file size and that every suffix array
+   * entry is below n. LCP values are not checked: a corrupt file may then
+   * answer queries wrongly, but never reads outside the text.
+   */
+  template <typename Key_T, std::unsigned_integral Index_T = std::uint32_t>
+  requires std::totally_ordered<Key_T>
+  class suffix_array_index {
+  public:
+    using key_type   = Key_T;
+    using index_type = Index_T;
+
+    suffix_array_index() = default;
+
+    template <std::forward_iterator         Iterator_T,
+              std::sentinel_for<Iterator_T> Sentinel_T,
+              typename Projection_T = std::identity>
+    suffix_array_index(Iterator_T first, Sentinel_T last, Projection_T proj = {})
+    {
+      for (; first != last; ++first)
+        m_text.push_back(static_cast<Key_T>(std::invoke(proj, *first)));
+
+      m_sa  = detail::buildSuffixArray<Index_T>(m_text);
+      m_lcp = detail::kasaiLcp<Index_T>(m_text, m_sa);
+      buildLcpLr();
+    }
+
+    template <std::ranges::forward_range Range_T,
+              typename Projection_T = std::identity>
+    explicit suffix_array_index(Range_T&& range, Projection_T proj = {})
+      : suffix_array_index(std::ranges::begin(range), std::ranges::end(range),
+                           std::move(proj))
+    {
+    }
+
+    std::size_t                size() const { return m_text.size(); }
+    std::span<Key_T const>     text() const { return m_text; }
+    std::span<Index_T const>   suffixArray() const { return m_sa; }
+    std::span<Index_T const>   lcp() const { return m_lcp; }
+
+    /**
+     * Suffix-array interval [lo, hi) of the suffixes starting with the
+     * pattern. An empty pattern matches every suffix.
+     */
+    template <std::forward_iterator           S_Iterator_T,
+              std::sentinel_for<S_Iterator_T> S_Sentinel_T,
+              typename S_Projection_T = std::identity>
+    std::pair<std::size_t, std::size_t>
+    equalRange(S_Iterator_T s_first, S_Sentinel_T s_last,
+               S_Projection_T s_proj = {}) const
+    {
+      auto const pat
+        = string_match::utils::detail::materializePattern<Key_T>(s_first, s_last,
+                                                                  s_proj);
+      return {bound(pat, false), bound(pat, true)};
+    }
+
+    template <std::ranges::forward_range S_Range_T,
+              typename S_Projection_T = std::identity>
+    std::pair<std::size_t, std::size_t> equalRange(S_Range_T&&    s_range,
+                                                   S_Projection_T s_proj = {}) const
+    {
+      return equalRange(std::ranges::begin(s_range), std::ranges::end(s_range),
+                        std::move(s_proj));
+    }
+
+    // Number of occurrences
+    template <std::ranges::forward_range S_Range_T,
+              typename S_Projection_T = std::identity>
+    std::size_t count(S_Range_T&& s_range, S_Projection_T s_proj = {}) const
+    {
+      auto const [lo, hi]
+        = equalRange(std::forward<S_Range_T>(s_range), std::move(s_proj));
+      return hi - lo;
+    }
+
+    // Start offsets of all occurrences, in suffix order
+    template <std::ranges::forward_range S_Range_T,
+              typename S_Projection_T = std::identity>
+    std::vector<std::size_t> locate(S_Range_T&&    s_range,
+                                    S_Projection_T s_proj = {}) const
+    {
+      auto const [lo, hi]
+        = equalRange(std::forward<S_Range_T>(s_range), std::move(s_proj));
+      return {m_sa.begin() + static_cast<std::ptrdiff_t>(lo),
+              m_sa.begin() + static_cast<std::ptrdiff_t>(hi)};
+    }
+
+
+    /******************
+     *  Serialization
+     */
+
+    void save(std::filesystem::path const& path) const
+    requires std::is_trivially_copyable_v<Key_T>
+    {
+      std::ofstream out(path, std::ios::binary | std::ios::trunc);
+      if (not out) throw std::runtime_error("cannot write " + path.string());
+
+      Header const header{magic, version, sizeof(Key_T), sizeof(Index_T), 0,
+                          m_text.size()};
+      out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+      writeArray(out, m_text);
+      writeArray(out, m_sa);
+      writeArray(out, m_lcp);
+      writeArray(out, m_lcp_lo);
+      writeArray(out, m_lcp_hi);
+      if (not out) throw std::runtime_error("failed writing " + path.string());
+    }
+
+    static suffix_array_index load(std::filesystem::path const& path)
+    requires std::is_trivially_copyable_v<Key_T>
+    {
+      std::ifstream in(path, std::ios::binary);
+      if (not in) throw std::runtime_error("cannot read " + path.string());
+
+      Header header{};
+      in.read(reinterpret_cast<char*>(&header), sizeof(header));
+      if (not in or header.magic != magic or header.version != version
+          or header.key_size != sizeof(Key_T)
+          or header.index_size != sizeof(Index_T))
+        throw std::runtime_error("not a compatible suffix array index: "
+                                 + path.string());
+
+      // Check the size before allocating: a corrupt n must not reach resize
+      constexpr std::uint64_t entry = sizeof(Key_T) + 4 * sizeof(Index_T);
+      auto const payload = std::filesystem::file_size(path) - sizeof(Header);
+      if (header.n > payload / entry)
+        throw std::runtime_error("truncated index: " + path.string());
+
+      suffix_array_index index;
+      auto const n = static_cast<std::size_t>(header.n);
+      readArray(in, index.m_text, n);
+      readArray(in, index.m_sa, n);
+      readArray(in, index.m_lcp, n);
+      readArray(in, index.m_lcp_lo, n);
+      readArray(in, index.m_lcp_hi, n);
+      if (not in) throw std::runtime_error("truncated index: " + path.string());
+
+      // count/locate index the text with these -- bad LCP values only give
+      // wrong answers, a bad suffix would read out of bounds
+      if (std::ranges::any_of(index.m_sa, [n](Index_T pos) { return pos >= n; }))
+        throw std::runtime_error("corrupt suffix array: " + path.string());
+      return index;
+    }
+
+  private:
+    struct Header {
+      std::array<char, 8> magic;
+      std::uint32_t       version;
+      std::uint32_t       key_size;
+      std::uint32_t       index_size;
+      std::uint32_t       reserved{0};   // padding, written as zeros
+      std::uint64_t       n;
+    };
+    static constexpr std::array<char, 8> magic{'D', 'T', 'E', '3', '6', '1', '1', 'S'};
+    static constexpr std::uint32_t       version = 1;
+
+    template <typename T>
+    static void writeArray(std::ofstream& out, std::vector<T> const& v)
+    {
+      out.write(reinterpret_cast<char const*>(v.data()),
+                static_cast<std::streamsize>(v.size() * sizeof(T)));
+    }
+
+    template <typename T>
+    static void readArray(std::ifstream& in, std::vector<T>& v, std::size_t n)
+    {
+      v.resize(n);
+      in.read(reinterpret_cast<char*>(v.data()),
+              static_cast<std::streamsize>(n * sizeof(T)));
+    }
+
+    /**
+     * The binary search below always probes mid = (lo + hi) / 2 starting from
+     * the virtual bounds lo = -1, hi = n, so every rank is the midpoint of
+     * exactly one interval. Store lcp(sa[lo], sa[mid]) and lcp(sa[mid],
+     * sa[hi]) for it; a virtual bound has lcp 0.
+     */
+    void buildLcpLr()
+    {
+      std::size_t const n = m_sa.size();
+      m_lcp_lo.assign(n, 0);
+      m_lcp_hi.assign(n, 0);
+
+      // Returns min(lcp[lo + 1 .. hi]) over the real interior
+      auto fill = [&](auto& self, std::ptrdiff_t lo, std::ptrdiff_t hi) -> Index_T {
+        if (hi - lo == 1)
+          return lo < 0 or hi >= static_cast<std::ptrdiff_t>(n)
+                   ? Index_T{0}
+                   : m_lcp[static_cast<std::size_t>(hi)];
+
+        std::ptrdiff_t const mid = lo + (hi - lo) / 2;
+        Index_T const        l   = self(self, lo, mid);
+        Index_T const        h   = self(self, mid, hi);
+        m_lcp_lo[static_cast<std::size_t>(mid)] = l;
+        m_lcp_hi[static_cast<std::size_t>(mid)] = h;
+        return std::min(l, h);
+      };
+      if (n > 0) fill(fill, -1, static_cast<std::ptrdiff_t>(n));
+    }
+
+    /**
+     * First rank whose suffix is not below the pattern. With upper == false
+     * "below" is plain lexicographic order, with upper == true a suffix
+     * starting with the pattern also counts as below. Invariants: suffix
+     * lo is below, suffix hi is not; l and h are their lcps with the pattern.
+     */
+    std::size_t bound(std::vector<Key_T> const& pat, bool upper) const
+    {
+      std::size_t const m = pat.size();
+      std::size_t const n = m_sa.size();
+
+      // lcp of the pattern and suffix sa[rank] from offset k on; below?
+      auto compare = [&](std::size_t rank, std::size_t k) {
+        std::size_t const pos = m_sa[rank];
+        while (k < m and pos + k < n and m_text[pos + k] == pat[k]) ++k;
+        bool const below = k == m ? upper
+                           : pos + k >= n
+                             ? true
+                             : detail::keyLess(m_text[pos + k], pat[k]);
+        return std::pair{k, below};
+      };
+
+      std::ptrdiff_t lo = -1, hi = static_cast<std::ptrdiff_t>(n);
+      std::size_t    l = 0, h = 0;
+      while (hi - lo > 1) {
+        std::ptrdiff_t const mid  = lo + (hi - lo) / 2;
+        auto const           rank = static_cast<std::size_t>(mid);
+
+        std::size_t known;   // lcp(pattern, suffix mid) when decided below
+        bool        below;
+        if (l >= h) {
+          std::size_t const lm = m_lcp_lo[rank];
+          if (lm > l) { known = l; below = true; }   // agrees with lo further
+          else if (lm < l) { known = lm; below = false; }
+          else std::tie(known, below) = compare(rank, l);
+        }
+        else {
+          std::size_t const mh = m_lcp_hi[rank];
+          if (mh > h) { known = h; below = false; }   // agrees with hi further
+          else if (mh < h) { known = mh; below = true; }
+          else std::tie(known, below) = compare(rank, h);
+        }
+
+        if (below) {
+          lo = mid;
+          l  = known;
+        }
+        else {
+          hi = mid;
+          h  = known;
+        }
+      }
+      return static_cast<std::size_t>(hi);
+    }
+
+    std::vector<Key_T>   m_text;
+    std::vector<Index_T> m_sa;
+    std::vector<Index_T> m_lcp;
+    std::vector<Index_T> m_lcp_lo;
+    std::vector<Index_T> m_lcp_hi;
+  };
+
+  // Deduce the key from the projected text
+  template <std::ranges::forward_range Range_T, typename Projection_T = std::identity>
+  suffix_array_index(Range_T&&, Projection_T = {}) -> suffix_array_index<
+    std::remove_cvref_t<std::invoke_result_t<
+      Projection_T&, std::ranges::range_reference_t<Range_T>>>>;
+
+}   // namespace dte3611::text_index
+
+#endif   // DTE3611_WEEK1_TEXT_INDEX_SUFFIX_ARRAY_H
@@ -1,15 +1,82 @@
 #ifndef DTE3611_DAY4_BREADTH_FIRST_SEARCH_H
 #define DTE3611_DAY4_BREADTH_FIRST_SEARCH_H
 
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
 // concepts
 #include "../utils/concepts/graphs.h"
 
+// utils
+#include "../utils/traversal_containers.h"
+#include "../utils/traversal_workspace.h"
+
 // boost
 #include <boost/graph/adjacency_list.hpp>
-#include <queue>
+
+// stl
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace dte3611::graph::algorithms
 {
+  namespace detail
+  {
+    /**
+     * One BFS, a vertex at a time: next() visits the next vertex in BFS
+     * order -- the start first -- and returns it, or nullopt once the
+     * reachable set is exhausted.
+     *
+     * Visited_T: contains(v) / insert(v) -> fresh; Queue_T: push / pop /
+     * empty. Either may be a reference, for containers owned elsewhere.
+     */
+    template <typename Graph_T, typename Visited_T, typename Queue_T>
+    class bfs_stepper {
+    public:
+      using VertexDescriptor = typename Graph_T::vertex_descriptor;
+
+      bfs_stepper(Graph_T const& graph, VertexDescriptor const& start,
+                  Visited_T visited, Queue_T q)
+        : m_graph{graph}, m_visited(std::forward<Visited_T>(visited)),
+          m_q(std::forward<Queue_T>(q))
+      {
+        m_q.push(start);
+        m_visited.insert(start);
+      }
+
+      std::optional<VertexDescriptor> next()
+      {
+        if (m_q.empty()) return std::nullopt;
+
+        VertexDescriptor u = m_q.pop();
+        for (auto v : boost::make_iterator_range(boost::adjacent_vertices(u, m_graph)))
+          if (m_visited.insert(v)) m_q.push(v);
+        return u;
+      }
+
+    private:
+      Graph_T const& m_graph;
+      Visited_T      m_visited;
+      Queue_T        m_q;
+    };
+
+    template <typename Graph_T, typename Visited_T, typename Queue_T>
+    std::vector<typename Graph_T::vertex_descriptor>
+    breadthFirstSearchImpl(Graph_T const&                             graph,
+                           typename Graph_T::vertex_descriptor const& start,
+                           Visited_T& visited, Queue_T& q)
+    {
+      std::vector<typename Graph_T::vertex_descriptor> result_traversal;
+
+      bfs_stepper<Graph_T, Visited_T&, Queue_T&> stepper(graph, start, visited, q);
+      stepper.next();   // the start is not part of the result
+      while (auto v = stepper.next()) result_traversal.push_back(*v);
+
+      return result_traversal;
+    }
+  }   // namespace detail
+
   template <predef::concepts::graph::BidirectionalGraph Graph_T>
   std::vector<typename Graph_T::vertex_descriptor>
   breadthFirstSearch([[maybe_unused]] Graph_T const& graph,
@@ -19,35 +86,25 @@ namespace dte3611::graph::algorithms
 
     using VertexDescriptor = typename Graph_T::vertex_descriptor;
 
-    std::queue<VertexDescriptor> q;
-
-    std::set<VertexDescriptor> visited;
-
-    std::vector<VertexDescriptor> result_traversal;
+    // Dense bits for index descriptors, hashed otherwise
+    auto visited = utils::detail::makeVisitedSet(graph);
 
-    q.push(start);
-    visited.insert(start);
+    utils::detail::vertex_queue<VertexDescriptor> q;
+    q.reserve(boost::num_vertices(graph));
 
-    while (!q.empty()) {
-      VertexDescriptor u = q.front();
-      q.pop();
-
-      result_traversal.push_back(u);
-
-      for (auto v : boost::make_iterator_range(boost::adjacent_vertices(u, graph))) {
-
-        if (!visited.contains(v)) {
-          visited.insert(v);
-
-          q.push(v);
-        }
-      }
-    }
-
-    if(!result_traversal.empty())
-      result_traversal.erase(result_traversal.begin());
+    return detail::breadthFirstSearchImpl(graph, start, visited, q);
+  }
 
-    return result_traversal;
+  // Same traversal on a reused workspace -- costs only what it reaches
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  std::vector<typename Graph_T::vertex_descriptor>
+  breadthFirstSearch(utils::TraversalWorkspace<Graph_T>&         workspace,
+                     Graph_T const&                             graph,
+                     typename Graph_T::vertex_descriptor const& start)
+  {
+    workspace.reset(graph);
+    return detail::breadthFirstSearchImpl(graph, start, workspace,
+                                          workspace.queue());
   }
 
 }   // namespace dte3611::graph::algorithms
@@ -0,0 +1,272 @@
+#ifndef DTE3611_DAY4_CONNECTED_COMPONENTS_H
+#define DTE3611_DAY4_CONNECTED_COMPONENTS_H
+
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
+#include "traversal_visitors.h"
+
+// concepts
+#include "../utils/concepts/graphs.h"
+
+// utils
+#include "../utils/thread_pool.h"
+#include "../utils/traversal_containers.h"
+
+// boost
+#include <boost/graph/adjacency_list.hpp>
+
+// stl
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace dte3611::graph::algorithms
+{
+
+  // Component id per vertex index, and the vertex count of every component
+  struct graph_components {
+    std::vector<std::size_t> component;
+    std::vector<std::size_t> sizes;
+
+    std::size_t count() const { return sizes.size(); }
+  };
+
+  namespace detail
+  {
+
+    // graph::utils shadows dte3611::utils in here
+    namespace pool_utils = ::dte3611::utils;
+
+    // Vertices per union-find task
+    inline constexpr std::size_t components_chunk = std::size_t{1} << 12;
+
+    /**
+     * Tarjan's SCC algorithm as a DFS visitor: discovery indices and
+     * low-links on dense arrays, the open components on a vertex stack. A
+     * vertex whose low-link is its own index closes a component once it is
+     * finished; low-links pass to the DFS parent on finishing.
+     */
+    template <typename Graph_T>
+    class tarjan_visitor {
+    public:
+      using VertexDescriptor = typename Graph_T::vertex_descriptor;
+
+      static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+      explicit tarjan_visitor(std::size_t n)
+        : m_index(n, none), m_low(n), m_parent(n), m_on_stack(n, false)
+      {
+        m_result.component.assign(n, none);
+      }
+
+      void start_vertex(VertexDescriptor const& v, Graph_T const&) { m_parent[v] = v; }
+
+      void discover_vertex(VertexDescriptor const& v, Graph_T const&)
+      {
+        m_index[v] = m_low[v] = m_next_index++;
+        m_stack.push_back(v);
+        m_on_stack[v] = true;
+      }
+
+      void tree_edge(typename Graph_T::edge_descriptor const& e, Graph_T const& g)
+      {
+        m_parent[boost::target(e, g)] = boost::source(e, g);
+      }
+
+      void back_edge(typename Graph_T::edge_descriptor const& e, Graph_T const& g)
+      {
+        lowerTo(boost::source(e, g), m_index[boost::target(e, g)]);
+      }
+
+      // Cross edges into a component still open count like back edges
+      void forward_or_cross_edge(typename Graph_T::edge_descriptor const& e, Graph_T const& g)
+      {
+        auto const v = boost::target(e, g);
+        if (m_on_stack[v]) lowerTo(boost::source(e, g), m_index[v]);
+      }
+
+      void finish_vertex(VertexDescriptor const& v, Graph_T const&)
+      {
+        if (m_low[v] == m_index[v]) {
+          auto const id   = m_result.sizes.size();
+          std::size_t size = 0;
+          VertexDescriptor w;
+          do {
+            w = m_stack.back();
+            m_stack.pop_back();
+            m_on_stack[w]          = false;
+            m_result.component[w] = id;
+            ++size;
+          } while (w != v);
+          m_result.sizes.push_back(size);
+        }
+        if (m_parent[v] != v) lowerTo(m_parent[v], m_low[v]);
+      }
+
+      graph_components result() && { return std::move(m_result); }
+
+    private:
+      void lowerTo(VertexDescriptor const& v, std::size_t low)
+      {
+        m_low[v] = std::min(m_low[v], low);
+      }
+
+      std::vector<std::size_t>      m_index;
+      std::vector<std::size_t>      m_low;
+      std::vector<VertexDescriptor> m_parent;
+      std::vector<bool>             m_on_stack;
+      std::vector<VertexDescriptor> m_stack;
+      std::size_t                   m_next_index{0};
+      graph_components              m_result;
+    };
+
+    /**
+     * Components from a union-find forest whose roots are the smallest
+     * vertex of their set: ids follow the roots in index order, so the
+     * serial and parallel builds agree exactly.
+     */
+    inline graph_components labelRoots(std::vector<std::size_t> const& root)
+    {
+      graph_components result;
+      result.component.resize(root.size());
+
+      for (std::size_t v = 0; v < root.size(); ++v) {
+        if (root[v] == v) {
+          result.component[v] = result.sizes.size();
+          result.sizes.push_back(0);
+        }
+        else
+          result.component[v] = result.component[root[v]];
+        ++result.sizes[result.component[v]];
+      }
+      return result;
+    }
+
+    // Lock-free union-find: CAS links, path halving, larger root under smaller
+    class concurrent_union_find {
+    public:
+      explicit concurrent_union_find(std::vector<std::size_t>& parent) : m_parent{parent} {}
+
+      std::size_t find(std::size_t x) const
+      {
+        for (;;) {
+          auto const p = slot(x).load(std::memory_order_acquire);
+          if (p == x) return x;
+          auto const gp = slot(p).load(std::memory_order_acquire);
+          if (gp != p) {
+            auto expected = p;
+            slot(x).compare_exchange_weak(expected, gp, std::memory_order_acq_rel);
+          }
+          x = gp;
+        }
+      }
+
+      void unite(std::size_t a, std::size_t b) const
+      {
+        for (;;) {
+          a = find(a);
+          b = find(b);
+          if (a == b) return;
+          if (a < b) std::swap(a, b);
+          auto expected = a;   // a must still be a root
+          if (slot(a).compare_exchange_strong(expected, b, std::memory_order_acq_rel)) return;
+        }
+      }
+
+    private:
+      std::atomic_ref<std::size_t> slot(std::size_t x) const
+      {
+        return std::atomic_ref<std::size_t>(m_parent[x]);
+      }
+
+      std::vector<std::size_t>& m_parent;
+    };
+
+  }   // namespace detail
+
+
+  /**
+   * Strongly connected components, Tarjan's algorithm on the iterative
+   * depthFirstVisitAll -- no recursion, so path-like graphs of any depth
+   * are fine. Components are numbered in the order Tarjan closes them,
+   * which is a reverse topological order of the condensation.
+   */
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  requires utils::detail::IndexedVertices<Graph_T>
+  graph_components stronglyConnectedComponents(Graph_T const& graph)
+  {
+    detail::tarjan_visitor<Graph_T> tarjan(boost::num_vertices(graph));
+    depthFirstVisitAll(graph, tarjan);
+    return std::move(tarjan).result();
+  }
+
+  /**
+   * Weakly connected components by union-find over the edges. Components
+   * are numbered by their smallest vertex.
+   */
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  requires utils::detail::IndexedVertices<Graph_T>
+  graph_components weaklyConnectedComponents(Graph_T const& graph)
+  {
+    std::vector<std::size_t> parent(boost::num_vertices(graph));
+    std::iota(parent.begin(), parent.end(), std::size_t{0});
+
+    auto find = [&parent](std::size_t x) {
+      while (parent[x] != x) x = parent[x] = parent[parent[x]];
+      return x;
+    };
+
+    for (auto e : boost::make_iterator_range(boost::edges(graph))) {
+      auto a = find(boost::source(e, graph));
+      auto b = find(boost::target(e, graph));
+      if (a == b) continue;
+      if (a < b) std::swap(a, b);
+      parent[a] = b;
+    }
+    for (std::size_t v = 0; v < parent.size(); ++v) parent[v] = find(v);
+
+    return detail::labelRoots(parent);
+  }
+
+  /**
+   * Parallel weakly connected components: vertex chunks unite their
+   * out-edges concurrently on a lock-free union-find, then every vertex
+   * resolves its root in parallel. Same numbering as the serial version.
+   */
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  requires utils::detail::IndexedVertices<Graph_T>
+  graph_components weaklyConnectedComponents(detail::pool_utils::ThreadPool& pool,
+                                             Graph_T const&                  graph)
+  {
+    constexpr auto chunk = detail::components_chunk;
+
+    auto const n      = static_cast<std::size_t>(boost::num_vertices(graph));
+    auto const chunks = (n + chunk - 1) / chunk;
+
+    std::vector<std::size_t> parent(n);
+    std::iota(parent.begin(), parent.end(), std::size_t{0});
+    detail::concurrent_union_find const sets(parent);
+
+    pool.parallelFor(chunks, [&](std::size_t c) {
+      auto const hi = std::min((c + 1) * chunk, n);
+      for (std::size_t u = c * chunk; u < hi; ++u)
+        for (auto v : boost::make_iterator_range(boost::adjacent_vertices(u, graph)))
+          sets.unite(u, v);
+    });
+
+    std::vector<std::size_t> root(n);
+    pool.parallelFor(chunks, [&](std::size_t c) {
+      auto const hi = std::min((c + 1) * chunk, n);
+      for (std::size_t v = c * chunk; v < hi; ++v) root[v] = sets.find(v);
+    });
+
+    return detail::labelRoots(root);
+  }
+
+}   // namespace dte3611::graph::algorithms
+
+#endif   // DTE3611_DAY4_CONNECTED_COMPONENTS_H
@@ -1,15 +1,93 @@
 #ifndef DTE3611_DAY4_DEPTH_FIRST_SEARCH_H
 #define DTE3611_DAY4_DEPTH_FIRST_SEARCH_H
 
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
 // concepts
 #include "../utils/concepts/graphs.h"
 
+// utils
+#include "../utils/traversal_containers.h"
+#include "../utils/traversal_workspace.h"
+
 #include <boost/graph/adjacency_list.hpp>
 
-#include <stack>
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace dte3611::graph::algorithms
 {
+  namespace detail
+  {
+    /**
+     * One DFS, a vertex at a time: next() visits the next vertex in DFS
+     * preorder -- the start first -- and returns it, or nullopt once the
+     * reachable set is exhausted.
+     *
+     * Visited_T: contains(v) / insert(v) -> fresh; Stack_T: a vector of
+     * vertex descriptors. Either may be a reference, for containers owned
+     * elsewhere.
+     */
+    template <typename Graph_T, typename Visited_T, typename Stack_T>
+    class dfs_stepper {
+    public:
+      using VertexDescriptor = typename Graph_T::vertex_descriptor;
+
+      dfs_stepper(Graph_T const& graph, VertexDescriptor const& start,
+                  Visited_T visited, Stack_T s)
+        : m_graph{graph}, m_visited(std::forward<Visited_T>(visited)),
+          m_s(std::forward<Stack_T>(s))
+      {
+        m_s.push_back(start);
+      }
+
+      std::optional<VertexDescriptor> next()
+      {
+        while (!m_s.empty()) {
+          VertexDescriptor u = m_s.back();
+          m_s.pop_back();
+
+          if (m_visited.insert(u)) {
+            // Push the unvisited neighbours, then flip them in place so the
+            // first neighbour is on top
+            auto const first_pushed = m_s.size();
+            for (auto v : boost::make_iterator_range(boost::adjacent_vertices(u, m_graph)))
+              if (!m_visited.contains(v)) m_s.push_back(v);
+            std::reverse(m_s.begin() + static_cast<std::ptrdiff_t>(first_pushed), m_s.end());
+            return u;
+          }
+        }
+        return std::nullopt;
+      }
+
+    private:
+      Graph_T const& m_graph;
+      Visited_T      m_visited;
+      Stack_T        m_s;
+    };
+
+    template <typename Graph_T, typename Visited_T>
+    std::vector<typename Graph_T::vertex_descriptor>
+    depthFirstSearchImpl(Graph_T const&                             graph,
+                         typename Graph_T::vertex_descriptor const& start,
+                         Visited_T&                                 visited,
+                         std::vector<typename Graph_T::vertex_descriptor>& s)
+    {
+      using VertexDescriptor = typename Graph_T::vertex_descriptor;
+
+      std::vector<VertexDescriptor> result_traversal;
+
+      dfs_stepper<Graph_T, Visited_T&, std::vector<VertexDescriptor>&> stepper(
+        graph, start, visited, s);
+      stepper.next();   // the start is not part of the result
+      while (auto v = stepper.next()) result_traversal.push_back(*v);
+
+      return result_traversal;
+    }
+  }   // namespace detail
 
   template <predef::concepts::graph::BidirectionalGraph Graph_T>
   std::vector<typename Graph_T::vertex_descriptor>
@@ -17,38 +95,23 @@ namespace dte3611::graph::algorithms
                    [[maybe_unused]]
                    typename Graph_T::vertex_descriptor const& start)
   {
-      using VertexDescriptor = typename Graph_T::vertex_descriptor;
-
-      std::vector<VertexDescriptor> result_traversal;
-      std::set<VertexDescriptor> visited;
-      std::stack<VertexDescriptor> s;
-
-      s.push(start);
-
-      while (!s.empty()) {
-          VertexDescriptor u = s.top();
-          s.pop();
-
-          if (!visited.contains(u)) {
-              visited.insert(u);
-              result_traversal.push_back(u);
-
-              std::vector<VertexDescriptor> neighbors;
-              for (auto v : boost::make_iterator_range(boost::adjacent_vertices(u, graph))) {
-                  if (!visited.contains(v)) {
-                      neighbors.push_back(v);
-                  }
-              }
-              for (auto it = neighbors.rbegin(); it != neighbors.rend(); ++it) {
-                  s.push(*it);
-              }
-          }
-      }
+      // Dense bits for index descriptors, hashed otherwise
+      auto visited = utils::detail::makeVisitedSet(graph);
+      std::vector<typename Graph_T::vertex_descriptor> s;
 
-      if (!result_traversal.empty())
-          result_traversal.erase(result_traversal.begin());
+      return detail::depthFirstSearchImpl(graph, start, visited, s);
+  }
 
-      return result_traversal;
+  // Same traversal on a reused workspace -- costs only what it reaches
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  std::vector<typename Graph_T::vertex_descriptor>
+  depthFirstSearch(utils::TraversalWorkspace<Graph_T>&         workspace,
+                   Graph_T const&                             graph,
+                   typename Graph_T::vertex_descriptor const& start)
+  {
+      workspace.reset(graph);
+      return detail::depthFirstSearchImpl(graph, start, workspace,
+                                          workspace.stack());
   }
 
 }   // namespace dte3611::graph::algorithms
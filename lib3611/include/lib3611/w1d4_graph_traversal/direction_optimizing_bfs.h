@@ -0,0 +1,164 @@
+#ifndef DTE3611_DAY4_DIRECTION_OPTIMIZING_BFS_H
+#define DTE3611_DAY4_DIRECTION_OPTIMIZING_BFS_H
+
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
+// concepts
+#include "../utils/concepts/graphs.h"
+
+// utils
+#include "../utils/traversal_containers.h"
+
+// boost
+#include <boost/graph/adjacency_list.hpp>
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace dte3611::graph::algorithms
+{
+
+  enum class bfs_direction {
+    automatic,   // Beamer et al.'s switching heuristic
+    top_down,    // frontier pushes along out-edges -- breadthFirstSearch's order
+    bottom_up    // unvisited vertices pull along in-edges
+  };
+
+  struct bfs_options {
+    bfs_direction direction{bfs_direction::automatic};
+    bool          record_order{false};
+
+    // Top-down -> bottom-up once the frontier's out-edges exceed the
+    // unexplored vertices' in-edges / alpha; back once the frontier
+    // shrinks below V / beta
+    double alpha{14.};
+    double beta{24.};
+  };
+
+  /**
+   * BFS levels and parents. parent[v] == v for the start vertex and for
+   * unreached vertices (whose level is `unreached`). order lists the
+   * reached vertices but the start, level by level, when requested.
+   */
+  template <typename VertexDescriptor_T>
+  struct bfs_tree {
+    static constexpr std::size_t unreached = std::numeric_limits<std::size_t>::max();
+
+    std::vector<std::size_t>        level;
+    std::vector<VertexDescriptor_T> parent;
+    std::vector<VertexDescriptor_T> order;
+
+    std::size_t top_down_steps{0};
+    std::size_t bottom_up_steps{0};
+  };
+
+
+  /**
+   * Direction-optimizing BFS (Beamer, Asanovic, Patterson, 2012). A level
+   * is expanded top-down while the frontier is small; once its out-edges
+   * outweigh the in-edges left to explore, every unvisited vertex instead
+   * scans its in-edges for a frontier parent and stops at the first -- on
+   * low-diameter graphs the middle levels then touch a fraction of the
+   * edges.
+   *
+   * Top-down steps reproduce breadthFirstSearch's visitation order;
+   * bottom-up steps add a level in vertex index order.
+   */
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  requires utils::detail::IndexedVertices<Graph_T>
+  bfs_tree<typename Graph_T::vertex_descriptor>
+  directionOptimizingBfs(Graph_T const&                             graph,
+                         typename Graph_T::vertex_descriptor const& start,
+                         bfs_options const&                         options = {})
+  {
+    using VertexDescriptor = typename Graph_T::vertex_descriptor;
+    using Tree             = bfs_tree<VertexDescriptor>;
+
+    auto const n = static_cast<std::size_t>(boost::num_vertices(graph));
+
+    Tree tree;
+    tree.level.assign(n, Tree::unreached);
+    tree.parent.resize(n);
+    for (std::size_t v = 0; v < n; ++v) tree.parent[v] = static_cast<VertexDescriptor>(v);
+
+    tree.level[start] = 0;
+
+    std::vector<VertexDescriptor> frontier{start};
+    std::vector<VertexDescriptor> next;
+
+    // Bottom-up steps test frontier membership on a bitmap
+    std::vector<std::uint64_t> in_frontier;
+    auto mark = [](std::vector<std::uint64_t>& bits, std::size_t v) {
+      bits[v / 64] |= std::uint64_t{1} << (v % 64);
+    };
+    auto marked = [](std::vector<std::uint64_t> const& bits, std::size_t v) {
+      return bool(bits[v / 64] & (std::uint64_t{1} << (v % 64)));
+    };
+
+    // Edges out of the frontier / into vertices not yet visited
+    double frontier_edges   = double(boost::out_degree(start, graph));
+    double unexplored_edges = double(boost::num_edges(graph)) - double(boost::in_degree(start, graph));
+
+    bool bottom_up = options.direction == bfs_direction::bottom_up;
+
+    for (std::size_t depth = 1; not frontier.empty(); ++depth) {
+
+      if (options.direction == bfs_direction::automatic) {
+        if (not bottom_up and frontier_edges > unexplored_edges / options.alpha)
+          bottom_up = true;
+        else if (bottom_up and double(frontier.size()) < double(n) / options.beta)
+          bottom_up = false;
+      }
+
+      next.clear();
+      double next_edges = 0;
+
+      if (bottom_up) {
+        ++tree.bottom_up_steps;
+        in_frontier.assign((n + 63) / 64, 0);
+        for (auto u : frontier) mark(in_frontier, u);
+
+        for (std::size_t v = 0; v < n; ++v) {
+          if (tree.level[v] != Tree::unreached) continue;
+          for (auto e : boost::make_iterator_range(boost::in_edges(v, graph))) {
+            auto const u = boost::source(e, graph);
+            if (marked(in_frontier, u)) {
+              tree.level[v]  = depth;
+              tree.parent[v] = u;
+              next.push_back(static_cast<VertexDescriptor>(v));
+              break;
+            }
+          }
+        }
+      }
+      else {
+        ++tree.top_down_steps;
+        for (auto u : frontier)
+          for (auto v : boost::make_iterator_range(boost::adjacent_vertices(u, graph)))
+            if (tree.level[v] == Tree::unreached) {
+              tree.level[v]  = depth;
+              tree.parent[v] = u;
+              next.push_back(v);
+            }
+      }
+
+      for (auto v : next) {
+        next_edges += double(boost::out_degree(v, graph));
+        unexplored_edges -= double(boost::in_degree(v, graph));
+      }
+      if (options.record_order) tree.order.insert(tree.order.end(), next.begin(), next.end());
+
+      frontier.swap(next);
+      frontier_edges = next_edges;
+    }
+
+    return tree;
+  }
+
+}   // namespace dte3611::graph::algorithms
+
+#endif   // DTE3611_DAY4_DIRECTION_OPTIMIZING_BFS_H
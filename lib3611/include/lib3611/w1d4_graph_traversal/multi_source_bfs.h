@@ -0,0 +1,183 @@
+#ifndef DTE3611_DAY4_MULTI_SOURCE_BFS_H
+#define DTE3611_DAY4_MULTI_SOURCE_BFS_H
+
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
+#include "direction_optimizing_bfs.h"
+
+// concepts
+#include "../utils/concepts/graphs.h"
+
+// utils
+#include "../utils/traversal_containers.h"
+
+// boost
+#include <boost/graph/adjacency_list.hpp>
+
+// stl
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace dte3611::graph::algorithms
+{
+
+  namespace detail
+  {
+
+    // One bit per BFS of a batch -- 64 * Words_V sources
+    template <std::size_t Words_V>
+    struct source_mask {
+      std::array<std::uint64_t, Words_V> words{};
+
+      bool any() const
+      {
+        std::uint64_t all = 0;
+        for (auto w : words) all |= w;
+        return all != 0;
+      }
+
+      void set(std::size_t i) { words[i / 64] |= std::uint64_t{1} << (i % 64); }
+
+      // this |= other & ~mask
+      void addUnseen(source_mask const& other, source_mask const& mask)
+      {
+        for (std::size_t k = 0; k < Words_V; ++k) words[k] |= other.words[k] & ~mask.words[k];
+      }
+
+      // Calls fn(i) for every set bit i
+      template <typename Fn_T>
+      void forEach(Fn_T&& fn) const
+      {
+        for (std::size_t k = 0; k < Words_V; ++k)
+          for (auto w = words[k]; w != 0; w &= w - 1)
+            fn(k * 64 + static_cast<std::size_t>(std::countr_zero(w)));
+      }
+    };
+
+    // Levels with more than V / ratio frontier or next-frontier vertices
+    // are collected by a sweep in index order instead of tracked
+    inline constexpr std::size_t ms_bfs_dense_ratio = 64;
+
+  }   // namespace detail
+
+
+  /**
+   * Multi-source BFS (Then et al., "The More the Merrier", 2014): the BFSs
+   * from up to 64 * Words_V sources run as one, every vertex carrying a
+   * bitmask of the searches that have seen it. A level scans each frontier
+   * vertex's out-edges once for all searches that reached it at that
+   * depth, so sources that share parts of the graph share the edge scans.
+   * As in directionOptimizingBfs the frontier is an explicit vertex list,
+   * and only masks a batch touched are cleared, so a sparse level costs
+   * just its frontier's out-edges. A level touching more than V / 64
+   * vertices sweeps the masks for its next frontier instead, which keeps
+   * large frontiers in index order and costs no more than the level's
+   * own work.
+   *
+   * Calls on_discover(source_index, vertex, distance) for every vertex
+   * each source reaches -- the source itself at distance 0 -- level by
+   * level, in no fixed order within a level. Longer source lists run
+   * in consecutive batches. Words_V > 1 widens a batch; the mask
+   * operations are plain word loops the compiler may vectorize.
+   */
+  template <std::size_t Words_V = 1,
+            predef::concepts::graph::BidirectionalGraph Graph_T, typename Callback_T>
+  requires utils::detail::IndexedVertices<Graph_T>
+  void multiSourceBfs(Graph_T const&                                        graph,
+                      std::span<typename Graph_T::vertex_descriptor const> sources,
+                      Callback_T&&                                          on_discover)
+  {
+    using VertexDescriptor = typename Graph_T::vertex_descriptor;
+    using Mask             = detail::source_mask<Words_V>;
+
+    constexpr std::size_t batch = 64 * Words_V;
+
+    auto const n = static_cast<std::size_t>(boost::num_vertices(graph));
+
+    std::vector<Mask> seen(n), visit(n), visit_next(n);
+
+    // Vertices with a non-empty visit / visit_next mask, and every vertex
+    // the batch has seen -- the only mask entries that need clearing
+    std::vector<VertexDescriptor> frontier, next, reached;
+
+    for (std::size_t first = 0; first < sources.size(); first += batch) {
+      auto const lanes = std::min(batch, sources.size() - first);
+
+      for (std::size_t i = 0; i < lanes; ++i) {
+        auto const s = sources[first + i];
+        if (not seen[s].any()) frontier.push_back(s);
+        seen[s].set(i);
+        visit[s].set(i);
+        on_discover(first + i, s, std::size_t{0});
+      }
+      reached = frontier;
+
+      for (std::size_t depth = 1; not frontier.empty(); ++depth) {
+        // Push every frontier vertex's searches to its neighbours that have not
+        // seen them; dense levels leave the next frontier to the sweep below
+        bool const dense = frontier.size() > n / detail::ms_bfs_dense_ratio;
+        for (auto v : frontier) {
+          for (auto w : boost::make_iterator_range(boost::adjacent_vertices(v, graph))) {
+            auto& to = visit_next[w];
+            if (dense) {
+              to.addUnseen(visit[v], seen[w]);
+              continue;
+            }
+            bool const was_reached = to.any();
+            to.addUnseen(visit[v], seen[w]);
+            if (not was_reached and to.any()) next.push_back(w);
+          }
+          visit[v] = Mask{};
+        }
+
+        // Large frontiers are kept in index order, for locality on the next level
+        if (dense or next.size() > n / detail::ms_bfs_dense_ratio) {
+          next.clear();
+          for (std::size_t w = 0; w < n; ++w)
+            if (visit_next[w].any()) next.push_back(static_cast<VertexDescriptor>(w));
+        }
+
+        for (auto w : next) {
+          visit_next[w].forEach([&](std::size_t i) { on_discover(first + i, w, depth); });
+          seen[w].addUnseen(visit_next[w], Mask{});
+        }
+        reached.insert(reached.end(), next.begin(), next.end());
+
+        visit.swap(visit_next);
+        frontier.swap(next);
+        next.clear();
+      }
+
+      for (auto v : reached) seen[v] = Mask{};
+    }
+  }
+
+  /**
+   * Hop distances from every source: result[i][v] is the distance from
+   * sources[i] to v, or bfs_tree<>::unreached.
+   */
+  template <std::size_t Words_V = 1, predef::concepts::graph::BidirectionalGraph Graph_T>
+  requires utils::detail::IndexedVertices<Graph_T>
+  std::vector<std::vector<std::size_t>>
+  multiSourceBfsDistances(Graph_T const&                                        graph,
+                          std::span<typename Graph_T::vertex_descriptor const> sources)
+  {
+    using Tree = bfs_tree<typename Graph_T::vertex_descriptor>;
+
+    std::vector<std::vector<std::size_t>> distance(
+      sources.size(), std::vector<std::size_t>(boost::num_vertices(graph), Tree::unreached));
+
+    multiSourceBfs<Words_V>(graph, sources,
+                            [&](std::size_t i, auto v, std::size_t d) { distance[i][v] = d; });
+    return distance;
+  }
+
+}   // namespace dte3611::graph::algorithms
+
+#endif   // DTE3611_DAY4_MULTI_SOURCE_BFS_H
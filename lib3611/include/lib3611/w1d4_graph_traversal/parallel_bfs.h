@@ -0,0 +1,141 @@
+#ifndef DTE3611_DAY4_PARALLEL_BFS_H
+#define DTE3611_DAY4_PARALLEL_BFS_H
+
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
+#include "direction_optimizing_bfs.h"
+
+// concepts
+#include "../utils/concepts/graphs.h"
+
+// utils
+#include "../utils/thread_pool.h"
+#include "../utils/traversal_containers.h"
+
+// boost
+#include <boost/graph/adjacency_list.hpp>
+
+// stl
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace dte3611::graph::algorithms
+{
+
+  namespace detail
+  {
+
+    // graph::utils shadows dte3611::utils in here
+    namespace pool_utils = ::dte3611::utils;
+
+    // Frontier vertices per task; smaller frontiers stay on the calling thread
+    inline constexpr std::size_t parallel_bfs_chunk = std::size_t{1} << 10;
+
+  }   // namespace detail
+
+
+  /**
+   * Level-synchronous BFS over a thread pool. Every level's frontier is cut
+   * into chunks that the pool's workers take dynamically; a worker claims
+   * an unvisited vertex by compare-and-swap on its parent slot and appends
+   * it to its chunk's own next-frontier buffer. The buffers are
+   * concatenated in chunk order between levels, so the only shared writes
+   * are the claims.
+   *
+   * Levels equal the serial BFS levels. Which chunk wins a contested
+   * claim depends on the thread timing, so both the order of the next
+   * frontier and a vertex's parent can differ from run to run; any
+   * parent found is a valid BFS parent. parent[v] == v for the start and
+   * for unreached vertices, as in directionOptimizingBfs. The visit order
+   * is not recorded.
+   */
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  requires utils::detail::IndexedVertices<Graph_T>
+  bfs_tree<typename Graph_T::vertex_descriptor>
+  parallelBfs(detail::pool_utils::ThreadPool&            pool,
+              Graph_T const&                             graph,
+              typename Graph_T::vertex_descriptor const& start)
+  {
+    using VertexDescriptor = typename Graph_T::vertex_descriptor;
+    using Tree             = bfs_tree<VertexDescriptor>;
+
+    constexpr auto chunk = detail::parallel_bfs_chunk;
+
+    auto const n         = static_cast<std::size_t>(boost::num_vertices(graph));
+    auto const chunks    = [](std::size_t size) { return (size + chunk - 1) / chunk; };
+    auto const unclaimed = static_cast<VertexDescriptor>(n);
+
+    Tree tree;
+    tree.level.resize(n);
+    tree.parent.resize(n);
+    pool.parallelFor(chunks(n), [&](std::size_t c) {
+      auto const hi = std::min((c + 1) * chunk, n);
+      std::fill(tree.level.begin() + c * chunk, tree.level.begin() + hi, Tree::unreached);
+      std::fill(tree.parent.begin() + c * chunk, tree.parent.begin() + hi, unclaimed);
+    });
+
+    tree.level[start]  = 0;
+    tree.parent[start] = start;
+
+    std::vector<VertexDescriptor>              frontier{start};
+    std::vector<std::vector<VertexDescriptor>> next;
+
+    for (std::size_t depth = 1; not frontier.empty(); ++depth) {
+      ++tree.top_down_steps;
+
+      std::size_t const tasks = chunks(frontier.size());
+      if (next.size() < tasks) next.resize(tasks);
+
+      pool.parallelFor(tasks, [&](std::size_t c) {
+        auto& local = next[c];
+        local.clear();
+
+        auto const hi = std::min((c + 1) * chunk, frontier.size());
+        for (std::size_t i = c * chunk; i < hi; ++i) {
+          auto const u = frontier[i];
+          for (auto v : boost::make_iterator_range(boost::adjacent_vertices(u, graph))) {
+            std::atomic_ref<VertexDescriptor> slot(tree.parent[v]);
+            // Plain load first -- most edges of a busy level hit claimed vertices
+            if (slot.load(std::memory_order_relaxed) != unclaimed) continue;
+            auto expected = unclaimed;
+            if (slot.compare_exchange_strong(expected, u, std::memory_order_relaxed)) {
+              tree.level[v] = depth;
+              local.push_back(v);
+            }
+          }
+        }
+      });
+
+      // parallelFor's join orders the claims before the serial reads below
+      std::vector<std::size_t> offset(tasks + 1, 0);
+      for (std::size_t c = 0; c < tasks; ++c) offset[c + 1] = offset[c] + next[c].size();
+
+      frontier.resize(offset[tasks]);
+      pool.parallelFor(tasks, [&](std::size_t c) {
+        std::ranges::copy(next[c], frontier.begin() + offset[c]);
+      });
+    }
+
+    pool.parallelFor(chunks(n), [&](std::size_t c) {
+      auto const hi = std::min((c + 1) * chunk, n);
+      for (std::size_t v = c * chunk; v < hi; ++v)
+        if (tree.parent[v] == unclaimed) tree.parent[v] = static_cast<VertexDescriptor>(v);
+    });
+
+    return tree;
+  }
+
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  requires utils::detail::IndexedVertices<Graph_T>
+  bfs_tree<typename Graph_T::vertex_descriptor>
+  parallelBfs(Graph_T const& graph, typename Graph_T::vertex_descriptor const& start)
+  {
+    return parallelBfs(detail::pool_utils::defaultThreadPool(), graph, start);
+  }
+
+}   // namespace dte3611::graph::algorithms
+
+#endif   // DTE3611_DAY4_PARALLEL_BFS_H
@@ -0,0 +1,60 @@
+#ifndef DTE3611_DAY4_TOPOLOGICAL_SORT_H
+#define DTE3611_DAY4_TOPOLOGICAL_SORT_H
+
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
+// concepts
+#include "../utils/concepts/graphs.h"
+
+// utils
+#include "../utils/traversal_containers.h"
+
+// boost
+#include <boost/graph/adjacency_list.hpp>
+
+// stl
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace dte3611::graph::algorithms
+{
+
+  /**
+   * Kahn's algorithm: vertices in topological order, from in-degree counts
+   * in a dense array. The result vector doubles as the FIFO queue, so
+   * sources come first in index order and every vertex follows the
+   * vertices that freed it. O(V + E).
+   *
+   * Throws std::invalid_argument if the graph has a cycle.
+   */
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  requires utils::detail::IndexedVertices<Graph_T>
+  std::vector<typename Graph_T::vertex_descriptor> topologicalSort(Graph_T const& graph)
+  {
+    using VertexDescriptor = typename Graph_T::vertex_descriptor;
+
+    auto const n = static_cast<std::size_t>(boost::num_vertices(graph));
+
+    std::vector<std::size_t>      in_degree(n);
+    std::vector<VertexDescriptor> order;
+    order.reserve(n);
+
+    for (auto v : boost::make_iterator_range(boost::vertices(graph))) {
+      in_degree[v] = boost::in_degree(v, graph);
+      if (in_degree[v] == 0) order.push_back(v);
+    }
+
+    for (std::size_t head = 0; head < order.size(); ++head)
+      for (auto w : boost::make_iterator_range(boost::adjacent_vertices(order[head], graph)))
+        if (--in_degree[w] == 0) order.push_back(w);
+
+    if (order.size() != n)
+      throw std::invalid_argument("topologicalSort: the graph has a cycle");
+    return order;
+  }
+
+}   // namespace dte3611::graph::algorithms
+
+#endif   // DTE3611_DAY4_TOPOLOGICAL_SORT_H
@@ -0,0 +1,157 @@
+#ifndef DTE3611_DAY4_TRAVERSAL_VIEWS_H
+#define DTE3611_DAY4_TRAVERSAL_VIEWS_H
+
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
+#include "breadth_first_search.h"
+#include "depth_first_search.h"
+
+// concepts
+#include "../utils/concepts/graphs.h"
+
+// utils
+#include "../utils/traversal_containers.h"
+#include "../utils/traversal_workspace.h"
+
+// stl
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+namespace dte3611::graph::algorithms
+{
+
+  /**
+   * Lazy traversal: an input range whose iterator drives a bfs_stepper or
+   * dfs_stepper one vertex per increment. Like breadthFirstSearch and
+   * depthFirstSearch, the start itself is not yielded.
+   *
+   * Stopping early -- a break, std::views::take, std::ranges::find_if --
+   * leaves the rest of the graph untouched. The stepper lives on the heap,
+   * so the view can be moved into a pipeline; it is single-pass, and the
+   * graph (and workspace, if any) must outlive it.
+   */
+  template <typename Stepper_T>
+  class traversal_view : public std::ranges::view_interface<traversal_view<Stepper_T>> {
+  public:
+    using VertexDescriptor = typename Stepper_T::VertexDescriptor;
+
+    class iterator {
+    public:
+      using value_type      = VertexDescriptor;
+      using difference_type = std::ptrdiff_t;
+
+      iterator() = default;
+      explicit iterator(traversal_view* view) : m_view{view} {}
+
+      VertexDescriptor const& operator*() const { return *m_view->current(); }
+
+      iterator& operator++()
+      {
+        m_view->current();
+        m_view->m_pending = true;
+        return *this;
+      }
+      void operator++(int) { ++*this; }
+
+      bool operator==(std::default_sentinel_t) const { return not m_view->current(); }
+
+    private:
+      traversal_view* m_view{nullptr};
+    };
+
+    traversal_view() = default;
+    explicit traversal_view(std::unique_ptr<Stepper_T> stepper)
+      : m_stepper{std::move(stepper)}
+    {
+    }
+
+    iterator                begin() { return iterator(this); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+  private:
+    /**
+     * Steps are taken when a vertex is looked at, not on increment, so the
+     * last ++ of a views::take -- which nobody dereferences -- costs
+     * nothing.
+     */
+    std::optional<VertexDescriptor> const& current()
+    {
+      if (m_pending) {
+        if (not m_started) m_stepper->next();   // the start
+        m_started = true;
+        m_current = m_stepper->next();
+        m_pending = false;
+      }
+      return m_current;
+    }
+
+    std::unique_ptr<Stepper_T>      m_stepper;
+    std::optional<VertexDescriptor> m_current;
+    bool                            m_pending{true};
+    bool                            m_started{false};
+  };
+
+
+  // Vertices reachable from start, lazily in breadthFirstSearch's order
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  auto breadthFirstView(Graph_T const&                             graph,
+                        typename Graph_T::vertex_descriptor const& start)
+  {
+    using Visited = decltype(utils::detail::makeVisitedSet(graph));
+    using Queue   = utils::detail::vertex_queue<typename Graph_T::vertex_descriptor>;
+    using Stepper = detail::bfs_stepper<Graph_T, Visited, Queue>;
+
+    return traversal_view<Stepper>(std::make_unique<Stepper>(
+      graph, start, utils::detail::makeVisitedSet(graph), Queue{}));
+  }
+
+  // Same, on a reused workspace -- an abandoned traversal costs only its prefix
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  auto breadthFirstView(utils::TraversalWorkspace<Graph_T>&         workspace,
+                        Graph_T const&                             graph,
+                        typename Graph_T::vertex_descriptor const& start)
+  {
+    using Workspace = utils::TraversalWorkspace<Graph_T>;
+    using Queue     = utils::detail::vertex_queue<typename Graph_T::vertex_descriptor>;
+    using Stepper   = detail::bfs_stepper<Graph_T, Workspace&, Queue&>;
+
+    workspace.reset(graph);
+    return traversal_view<Stepper>(
+      std::make_unique<Stepper>(graph, start, workspace, workspace.queue()));
+  }
+
+  // Vertices reachable from start, lazily in depthFirstSearch's order
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  auto depthFirstView(Graph_T const&                             graph,
+                      typename Graph_T::vertex_descriptor const& start)
+  {
+    using Visited = decltype(utils::detail::makeVisitedSet(graph));
+    using Stack   = std::vector<typename Graph_T::vertex_descriptor>;
+    using Stepper = detail::dfs_stepper<Graph_T, Visited, Stack>;
+
+    return traversal_view<Stepper>(std::make_unique<Stepper>(
+      graph, start, utils::detail::makeVisitedSet(graph), Stack{}));
+  }
+
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  auto depthFirstView(utils::TraversalWorkspace<Graph_T>&         workspace,
+                      Graph_T const&                             graph,
+                      typename Graph_T::vertex_descriptor const& start)
+  {
+    using Workspace = utils::TraversalWorkspace<Graph_T>;
+    using Stack     = std::vector<typename Graph_T::vertex_descriptor>;
+    using Stepper   = detail::dfs_stepper<Graph_T, Workspace&, Stack&>;
+
+    workspace.reset(graph);
+    return traversal_view<Stepper>(
+      std::make_unique<Stepper>(graph, start, workspace, workspace.stack()));
+  }
+
+}   // namespace dte3611::graph::algorithms
+
+#endif   // DTE3611_DAY4_TRAVERSAL_VIEWS_H
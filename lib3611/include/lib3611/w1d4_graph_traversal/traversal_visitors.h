@@ -0,0 +1,309 @@
+#ifndef DTE3611_DAY4_TRAVERSAL_VISITORS_H
+#define DTE3611_DAY4_TRAVERSAL_VISITORS_H
+
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
+// concepts
+#include "../utils/concepts/graphs.h"
+
+// utils
+#include "../utils/traversal_containers.h"
+#include "../utils/traversal_workspace.h"
+
+// boost
+#include <boost/graph/adjacency_list.hpp>
+
+// stl
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace dte3611::graph::algorithms
+{
+
+  /**
+   * Visitor events, BGL-style. A visitor defines any subset of
+   *
+   *   start_vertex(v, g)            -- a root of the *VisitAll traversals
+   *   discover_vertex(v, g)         -- v is reached for the first time
+   *   examine_edge(e, g)            -- every out-edge of a discovered vertex
+   *   tree_edge(e, g)               -- e discovers its target
+   *   back_edge(e, g)               -- DFS: e leads to a vertex still on the
+   *                                    stack, i.e. closes a cycle
+   *   forward_or_cross_edge(e, g)   -- DFS: e leads to a finished vertex
+   *   non_tree_edge(e, g)           -- BFS: e leads to a discovered vertex
+   *   finish_vertex(v, g)           -- all of v's out-edges are examined
+   *
+   * Each hook is detected at compile time and called directly. Absent
+   * hooks generate no code, so an empty visitor costs what the bare
+   * traversal does. Visitors are taken by reference and keep their state.
+   */
+  namespace detail
+  {
+
+    template <typename Visitor_T, typename Graph_T>
+    void startVertex(Visitor_T& vis, typename Graph_T::vertex_descriptor const& v, Graph_T const& g)
+    {
+      if constexpr (requires { vis.start_vertex(v, g); }) vis.start_vertex(v, g);
+    }
+
+    template <typename Visitor_T, typename Graph_T>
+    void discoverVertex(Visitor_T& vis, typename Graph_T::vertex_descriptor const& v, Graph_T const& g)
+    {
+      if constexpr (requires { vis.discover_vertex(v, g); }) vis.discover_vertex(v, g);
+    }
+
+    template <typename Visitor_T, typename Graph_T>
+    void finishVertex(Visitor_T& vis, typename Graph_T::vertex_descriptor const& v, Graph_T const& g)
+    {
+      if constexpr (requires { vis.finish_vertex(v, g); }) vis.finish_vertex(v, g);
+    }
+
+    template <typename Visitor_T, typename Graph_T>
+    void examineEdge(Visitor_T& vis, typename Graph_T::edge_descriptor const& e, Graph_T const& g)
+    {
+      if constexpr (requires { vis.examine_edge(e, g); }) vis.examine_edge(e, g);
+    }
+
+    template <typename Visitor_T, typename Graph_T>
+    void treeEdge(Visitor_T& vis, typename Graph_T::edge_descriptor const& e, Graph_T const& g)
+    {
+      if constexpr (requires { vis.tree_edge(e, g); }) vis.tree_edge(e, g);
+    }
+
+    template <typename Visitor_T, typename Graph_T>
+    void backEdge(Visitor_T& vis, typename Graph_T::edge_descriptor const& e, Graph_T const& g)
+    {
+      if constexpr (requires { vis.back_edge(e, g); }) vis.back_edge(e, g);
+    }
+
+    template <typename Visitor_T, typename Graph_T>
+    void forwardOrCrossEdge(Visitor_T& vis, typename Graph_T::edge_descriptor const& e,
+                            Graph_T const& g)
+    {
+      if constexpr (requires { vis.forward_or_cross_edge(e, g); }) vis.forward_or_cross_edge(e, g);
+    }
+
+    template <typename Visitor_T, typename Graph_T>
+    void nonTreeEdge(Visitor_T& vis, typename Graph_T::edge_descriptor const& e, Graph_T const& g)
+    {
+      if constexpr (requires { vis.non_tree_edge(e, g); }) vis.non_tree_edge(e, g);
+    }
+
+    // Seen / finished marks over two visited sets; TraversalWorkspace's
+    // seen / settled stamps serve the same interface
+    template <typename Graph_T>
+    class dfs_marks {
+    public:
+      using VertexDescriptor = typename Graph_T::vertex_descriptor;
+
+      explicit dfs_marks(Graph_T const& graph)
+        : m_seen{utils::detail::makeVisitedSet(graph)},
+          m_finished{utils::detail::makeVisitedSet(graph)}
+      {
+      }
+
+      bool contains(VertexDescriptor const& v) const { return m_seen.contains(v); }
+      bool insert(VertexDescriptor const& v) { return m_seen.insert(v); }
+      bool settled(VertexDescriptor const& v) const { return m_finished.contains(v); }
+      bool settle(VertexDescriptor const& v) { return m_finished.insert(v); }
+
+    private:
+      decltype(utils::detail::makeVisitedSet(std::declval<Graph_T const&>())) m_seen;
+      decltype(utils::detail::makeVisitedSet(std::declval<Graph_T const&>())) m_finished;
+    };
+
+    // Visited_T: contains(v) / insert(v) -> fresh; Queue_T: push / pop / empty
+    template <typename Graph_T, typename Visited_T, typename Queue_T, typename Visitor_T>
+    void breadthFirstVisitImpl(Graph_T const&                             graph,
+                               typename Graph_T::vertex_descriptor const& start,
+                               Visited_T& visited, Queue_T& q, Visitor_T& vis)
+    {
+      visited.insert(start);
+      discoverVertex(vis, start, graph);
+      q.push(start);
+
+      while (!q.empty()) {
+        auto const u = q.pop();
+        for (auto e : boost::make_iterator_range(boost::out_edges(u, graph))) {
+          examineEdge(vis, e, graph);
+          auto const v = boost::target(e, graph);
+          if (visited.insert(v)) {
+            treeEdge(vis, e, graph);
+            discoverVertex(vis, v, graph);
+            q.push(v);
+          }
+          else
+            nonTreeEdge(vis, e, graph);
+        }
+        finishVertex(vis, u, graph);
+      }
+    }
+
+    // Marks_T: contains / insert (seen) and settled / settle (finished)
+    template <typename Graph_T, typename Marks_T, typename Visitor_T>
+    void depthFirstVisitImpl(Graph_T const&                             graph,
+                             typename Graph_T::vertex_descriptor const& start,
+                             Marks_T& marks, Visitor_T& vis)
+    {
+      using VertexDescriptor = typename Graph_T::vertex_descriptor;
+      using OutEdgeIterator  = decltype(boost::out_edges(start, graph).first);
+
+      // A vertex on the DFS path and its out-edges still to examine
+      struct Frame {
+        VertexDescriptor u;
+        OutEdgeIterator  next;
+        OutEdgeIterator  end;
+      };
+
+      std::vector<Frame> path;
+      auto enter = [&](VertexDescriptor const& u) {
+        marks.insert(u);
+        discoverVertex(vis, u, graph);
+        auto const [first, last] = boost::out_edges(u, graph);
+        path.push_back({u, first, last});
+      };
+
+      enter(start);
+      while (!path.empty()) {
+        auto& frame = path.back();
+        if (frame.next == frame.end) {
+          marks.settle(frame.u);
+          finishVertex(vis, frame.u, graph);
+          path.pop_back();
+          continue;
+        }
+
+        auto const e = *frame.next++;
+        examineEdge(vis, e, graph);
+        auto const v = boost::target(e, graph);
+        if (!marks.contains(v)) {
+          treeEdge(vis, e, graph);
+          enter(v);   // invalidates frame
+        }
+        else if (!marks.settled(v))
+          backEdge(vis, e, graph);
+        else
+          forwardOrCrossEdge(vis, e, graph);
+      }
+    }
+
+  }   // namespace detail
+
+
+  // Forwards every event to each of several visitors, in order
+  template <typename... Visitors_T>
+  class visitor_list {
+  public:
+    explicit visitor_list(Visitors_T&... visitors) : m_visitors{visitors...} {}
+
+    template <typename V_T, typename G_T>
+    void start_vertex(V_T const& v, G_T const& g)
+    {
+      std::apply([&](auto&... vis) { (detail::startVertex(vis, v, g), ...); }, m_visitors);
+    }
+    template <typename V_T, typename G_T>
+    void discover_vertex(V_T const& v, G_T const& g)
+    {
+      std::apply([&](auto&... vis) { (detail::discoverVertex(vis, v, g), ...); }, m_visitors);
+    }
+    template <typename V_T, typename G_T>
+    void finish_vertex(V_T const& v, G_T const& g)
+    {
+      std::apply([&](auto&... vis) { (detail::finishVertex(vis, v, g), ...); }, m_visitors);
+    }
+    template <typename E_T, typename G_T>
+    void examine_edge(E_T const& e, G_T const& g)
+    {
+      std::apply([&](auto&... vis) { (detail::examineEdge(vis, e, g), ...); }, m_visitors);
+    }
+    template <typename E_T, typename G_T>
+    void tree_edge(E_T const& e, G_T const& g)
+    {
+      std::apply([&](auto&... vis) { (detail::treeEdge(vis, e, g), ...); }, m_visitors);
+    }
+    template <typename E_T, typename G_T>
+    void back_edge(E_T const& e, G_T const& g)
+    {
+      std::apply([&](auto&... vis) { (detail::backEdge(vis, e, g), ...); }, m_visitors);
+    }
+    template <typename E_T, typename G_T>
+    void forward_or_cross_edge(E_T const& e, G_T const& g)
+    {
+      std::apply([&](auto&... vis) { (detail::forwardOrCrossEdge(vis, e, g), ...); }, m_visitors);
+    }
+    template <typename E_T, typename G_T>
+    void non_tree_edge(E_T const& e, G_T const& g)
+    {
+      std::apply([&](auto&... vis) { (detail::nonTreeEdge(vis, e, g), ...); }, m_visitors);
+    }
+
+  private:
+    std::tuple<Visitors_T&...> m_visitors;
+  };
+
+
+  // BFS from start; discovery order is start, then breadthFirstSearch's order
+  template <predef::concepts::graph::BidirectionalGraph Graph_T, typename Visitor_T>
+  void breadthFirstVisit(Graph_T const& graph, typename Graph_T::vertex_descriptor const& start,
+                         Visitor_T&& vis)
+  {
+    auto visited = utils::detail::makeVisitedSet(graph);
+    utils::detail::vertex_queue<typename Graph_T::vertex_descriptor> q;
+    detail::breadthFirstVisitImpl(graph, start, visited, q, vis);
+  }
+
+  template <predef::concepts::graph::BidirectionalGraph Graph_T, typename Visitor_T>
+  void breadthFirstVisit(utils::TraversalWorkspace<Graph_T>& workspace, Graph_T const& graph,
+                         typename Graph_T::vertex_descriptor const& start, Visitor_T&& vis)
+  {
+    workspace.reset(graph);
+    detail::breadthFirstVisitImpl(graph, start, workspace, workspace.queue(), vis);
+  }
+
+  // BFS forest: a new root, announced by start_vertex, at every undiscovered vertex
+  template <predef::concepts::graph::BidirectionalGraph Graph_T, typename Visitor_T>
+  void breadthFirstVisitAll(Graph_T const& graph, Visitor_T&& vis)
+  {
+    auto visited = utils::detail::makeVisitedSet(graph);
+    utils::detail::vertex_queue<typename Graph_T::vertex_descriptor> q;
+    for (auto s : boost::make_iterator_range(boost::vertices(graph))) {
+      if (visited.contains(s)) continue;
+      detail::startVertex(vis, s, graph);
+      detail::breadthFirstVisitImpl(graph, s, visited, q, vis);
+    }
+  }
+
+  // DFS from start; discovery order is start, then depthFirstSearch's order
+  template <predef::concepts::graph::BidirectionalGraph Graph_T, typename Visitor_T>
+  void depthFirstVisit(Graph_T const& graph, typename Graph_T::vertex_descriptor const& start,
+                       Visitor_T&& vis)
+  {
+    detail::dfs_marks<Graph_T> marks(graph);
+    detail::depthFirstVisitImpl(graph, start, marks, vis);
+  }
+
+  template <predef::concepts::graph::BidirectionalGraph Graph_T, typename Visitor_T>
+  void depthFirstVisit(utils::TraversalWorkspace<Graph_T>& workspace, Graph_T const& graph,
+                       typename Graph_T::vertex_descriptor const& start, Visitor_T&& vis)
+  {
+    workspace.reset(graph);
+    detail::depthFirstVisitImpl(graph, start, workspace, vis);
+  }
+
+  // DFS forest: a new root, announced by start_vertex, at every undiscovered vertex
+  template <predef::concepts::graph::BidirectionalGraph Graph_T, typename Visitor_T>
+  void depthFirstVisitAll(Graph_T const& graph, Visitor_T&& vis)
+  {
+    detail::dfs_marks<Graph_T> marks(graph);
+    for (auto s : boost::make_iterator_range(boost::vertices(graph))) {
+      if (marks.contains(s)) continue;
+      detail::startVertex(vis, s, graph);
+      detail::depthFirstVisitImpl(graph, s, marks, vis);
+    }
+  }
+
+}   // namespace dte3611::graph::algorithms
+
+#endif   // DTE3611_DAY4_TRAVERSAL_VISITORS_H
@@ -1,6 +1,9 @@
 #ifndef DTE3611_DAY5_ASTAR_SEARCH_H
 #define DTE3611_DAY5_ASTAR_SEARCH_H
 
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
 #include "operators.h"
 
 // concepts
@@ -0,0 +1,186 @@
+#ifndef DTE3611_DAY5_DAG_SHORTEST_PATHS_H
+#define DTE3611_DAY5_DAG_SHORTEST_PATHS_H
+
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
+#include "dijkstra_shortest_paths.h"
+#include "operators.h"
+
+#include "../w1d4_graph_traversal/topological_sort.h"
+
+// concepts
+#include "../utils/concepts/graphs.h"
+#include "../utils/concepts/operators.h"
+
+// utils
+#include "../utils/traversal_containers.h"
+
+// stl
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <span>
+#include <vector>
+
+namespace dte3611::graph::algorithms
+{
+
+  /**
+   * Single-source shortest distances on a DAG, in dense per-vertex arrays:
+   * distance[v] is infinity for vertices start does not reach, and
+   * path_count[v] the number of distinct shortest start -> v paths
+   * (saturating at the uint64_t maximum).
+   */
+  template <typename VertexDescriptor_T>
+  struct dag_path_tree {
+    VertexDescriptor_T         start;
+    std::vector<double>        distance;
+    std::vector<std::uint64_t> path_count;
+
+    static constexpr double unreached = std::numeric_limits<double>::infinity();
+
+    bool reached(VertexDescriptor_T const& v) const { return distance[v] != unreached; }
+  };
+
+  namespace detail
+  {
+
+    inline std::uint64_t saturatingAdd(std::uint64_t a, std::uint64_t b)
+    {
+      constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+      return a > max - b ? max : a + b;
+    }
+
+  }   // namespace detail
+
+
+  /**
+   * Relaxes every out-edge once, in topological order: by the time a
+   * vertex is scanned, all its in-edges from reached vertices have been
+   * relaxed, so its distance and path count are final. O(V + E), and
+   * negative weights are fine since no vertex is ever revisited.
+   *
+   * order must be a topological order of graph (topologicalSort), so that
+   * many queries on one DAG can share it. Vertices ahead of start in it
+   * cannot be reached and are skipped.
+   */
+  template <predef::concepts::graph::BidirectionalGraph Graph_T,
+            predef::concepts::graph::EdgeDistanceOperator<Graph_T> EdOp_T
+            = operators::DefaultEdgeDistanceOperator<>>
+  requires utils::detail::IndexedVertices<Graph_T>
+  dag_path_tree<typename Graph_T::vertex_descriptor>
+  dagShortestPathTree(std::span<typename Graph_T::vertex_descriptor const> order,
+                      Graph_T const&                                        graph,
+                      typename Graph_T::vertex_descriptor const&            start,
+                      EdOp_T distance_op = EdOp_T())
+  {
+    using Tree = dag_path_tree<typename Graph_T::vertex_descriptor>;
+
+    auto const n = static_cast<std::size_t>(boost::num_vertices(graph));
+
+    Tree tree{start, std::vector<double>(n, Tree::unreached), std::vector<std::uint64_t>(n, 0)};
+    tree.distance[start]   = 0.0;
+    tree.path_count[start] = 1;
+
+    auto it = std::ranges::find(order, start);
+    for (; it != order.end(); ++it) {
+      auto const u = *it;
+      if (not tree.reached(u)) continue;
+
+      for (auto e : boost::make_iterator_range(boost::out_edges(u, graph))) {
+        auto const v        = boost::target(e, graph);
+        auto const new_dist = tree.distance[u] + distance_op(e, graph);
+
+        if (new_dist < tree.distance[v]) {
+          tree.distance[v]   = new_dist;
+          tree.path_count[v] = tree.path_count[u];
+        }
+        else if (new_dist == tree.distance[v])
+          tree.path_count[v] = detail::saturatingAdd(tree.path_count[v], tree.path_count[u]);
+      }
+    }
+    return tree;
+  }
+
+  // Same, sorting the graph first -- throws std::invalid_argument on a cycle
+  template <predef::concepts::graph::BidirectionalGraph Graph_T,
+            predef::concepts::graph::EdgeDistanceOperator<Graph_T> EdOp_T
+            = operators::DefaultEdgeDistanceOperator<>>
+  requires utils::detail::IndexedVertices<Graph_T>
+  dag_path_tree<typename Graph_T::vertex_descriptor>
+  dagShortestPathTree(Graph_T const&                             graph,
+                      typename Graph_T::vertex_descriptor const& start,
+                      EdOp_T                                     distance_op = EdOp_T())
+  {
+    auto const order = topologicalSort(graph);
+    return dagShortestPathTree<Graph_T>(order, graph, start, distance_op);
+  }
+
+  /**
+   * All shortest paths start -> goal, without start -- the same set of
+   * paths as dijkstraShortestPaths, not necessarily in the same order, and
+   * also with negative weights. Parents are not stored during the pass;
+   * they are recovered from goal backwards over the in-edges that are
+   * tight under the final distances, so the paths follow in-edge order.
+   */
+  template <predef::concepts::graph::BidirectionalGraph Graph_T,
+            predef::concepts::graph::EdgeDistanceOperator<Graph_T> EdOp_T
+            = operators::DefaultEdgeDistanceOperator<>>
+  requires utils::detail::IndexedVertices<Graph_T>
+  std::vector<std::vector<typename Graph_T::vertex_descriptor>>
+  dagShortestPaths(std::span<typename Graph_T::vertex_descriptor const> order,
+                   Graph_T const&                                        graph,
+                   typename Graph_T::vertex_descriptor const&            start,
+                   typename Graph_T::vertex_descriptor const&            goal,
+                   EdOp_T distance_op = EdOp_T())
+  {
+    using VertexDescriptor = typename Graph_T::vertex_descriptor;
+
+    auto const tree = dagShortestPathTree<Graph_T>(order, graph, start, distance_op);
+    if (not tree.reached(goal)) return {};
+
+    std::map<VertexDescriptor, std::vector<VertexDescriptor>> parents;
+    std::vector<VertexDescriptor>                             pending{goal};
+    while (not pending.empty()) {
+      auto const v = pending.back();
+      pending.pop_back();
+      if (v == start or not parents.try_emplace(v).second) continue;
+
+      for (auto e : boost::make_iterator_range(boost::in_edges(v, graph))) {
+        auto const u = boost::source(e, graph);
+        if (tree.reached(u) and tree.distance[u] + distance_op(e, graph) == tree.distance[v]) {
+          parents[v].push_back(u);
+          pending.push_back(u);
+        }
+      }
+    }
+
+    return detail::shortestPathsFromParents(
+      start, goal,
+      [&parents](VertexDescriptor const& v) -> std::vector<VertexDescriptor> const* {
+        auto const it = parents.find(v);
+        return it == parents.end() ? nullptr : &it->second;
+      });
+  }
+
+  // Drop-in for dijkstraShortestPaths on DAGs
+  template <predef::concepts::graph::BidirectionalGraph Graph_T,
+            predef::concepts::graph::EdgeDistanceOperator<Graph_T> EdOp_T
+            = operators::DefaultEdgeDistanceOperator<>>
+  requires utils::detail::IndexedVertices<Graph_T>
+  std::vector<std::vector<typename Graph_T::vertex_descriptor>>
+  dagShortestPaths(Graph_T const&                             graph,
+                   typename Graph_T::vertex_descriptor const& start,
+                   typename Graph_T::vertex_descriptor const& goal,
+                   EdOp_T                                     distance_op = EdOp_T())
+  {
+    auto const order = topologicalSort(graph);
+    return dagShortestPaths<Graph_T>(order, graph, start, goal, distance_op);
+  }
+
+}   // namespace dte3611::graph::algorithms
+
+#endif   // DTE3611_DAY5_DAG_SHORTEST_PATHS_H
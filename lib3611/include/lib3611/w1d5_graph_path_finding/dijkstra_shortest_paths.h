@@ -1,14 +1,23 @@
 #ifndef DTE3611_DAY5_DIJKSTRA_SHORTEST_PATHS_H
 #define DTE3611_DAY5_DIJKSTRA_SHORTEST_PATHS_H
 
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
 #include "operators.h"
 
 // concepts
 #include "../utils/concepts/graphs.h"
 #include "../utils/concepts/operators.h"
 
+// utils
+#include "../utils/traversal_workspace.h"
+
 // stl
+#include <functional>
+#include <map>
 #include <queue>
+#include <set>
 #include <vector>
 
 namespace dte3611::graph::algorithms
@@ -16,13 +25,30 @@ namespace dte3611::graph::algorithms
     namespace detail
     {
 
-        template <typename Graph_T, typename EdOp_T, typename PriorityFn_T>
-        std::vector<std::vector<typename Graph_T::vertex_descriptor>>
-        shortestPathsImpl(Graph_T const& graph,
-                          typename Graph_T::vertex_descriptor const& start,
-                          typename Graph_T::vertex_descriptor const& goal,
-                          EdOp_T distance_op,
-                          PriorityFn_T priority_fn)
+        /**
+         * Every shortest path from start, as each reached vertex's list of
+         * shortest-path parents. Complete for every vertex as the search
+         * runs until the queue is empty.
+         */
+        template <typename VertexDescriptor_T>
+        struct shortest_path_tree {
+            VertexDescriptor_T start;
+            std::map<VertexDescriptor_T, std::vector<VertexDescriptor_T>> parents;
+        };
+
+        /**
+         * The search itself, on a per-vertex state with
+         *   contains(v) / insert(v) -> fresh   -- has a tentative distance
+         *   settle(v) -> fresh                 -- popped for good
+         *   distance(v), parents(v)            -- valid once inserted
+         */
+        template <typename Graph_T, typename EdOp_T, typename PriorityFn_T,
+                  typename State_T>
+        void shortestPathSearch(Graph_T const& graph,
+                                typename Graph_T::vertex_descriptor const& start,
+                                EdOp_T& distance_op,
+                                PriorityFn_T& priority_fn,
+                                State_T& state)
         {
             using VertexDescriptor = typename Graph_T::vertex_descriptor;
             using DistanceType = double;
@@ -34,37 +60,76 @@ namespace dte3611::graph::algorithms
                 std::greater<VertexDistance>
             > pq;
 
-            std::map<VertexDescriptor, DistanceType> dist;
-            std::map<VertexDescriptor, std::vector<VertexDescriptor>> parents;
-            std::set<VertexDescriptor> visited;
-
-            dist[start] = 0.0;
+            state.insert(start);
+            state.distance(start) = 0.0;
+            state.parents(start).clear();
             pq.push({priority_fn(0.0, start), start});
 
             while (!pq.empty()) {
                 auto [d, u] = pq.top();
                 pq.pop();
 
-                if (visited.contains(u)) continue;
-                visited.insert(u);
+                if (!state.settle(u)) continue;
 
                 for (auto e : boost::make_iterator_range(boost::out_edges(u, graph))) {
                     auto v = boost::target(e, graph);
                     auto weight = distance_op(e, graph);
-                    auto new_dist = dist[u] + weight;
+                    auto new_dist = state.distance(u) + weight;
 
-                    bool v_not_seen = (!dist.contains(v));
+                    bool v_not_seen = state.insert(v);
 
-                    if (v_not_seen || new_dist < dist[v]) {
-                        dist[v] = new_dist;
-                        parents[v] = {u};
+                    if (v_not_seen || new_dist < state.distance(v)) {
+                        state.distance(v) = new_dist;
+                        state.parents(v).assign(1, u);
                         pq.push({priority_fn(new_dist, v), v});
                     }
-                    else if (new_dist == dist[v]) {
-                        parents[v].push_back(u);
+                    else if (new_dist == state.distance(v)) {
+                        state.parents(v).push_back(u);
                     }
                 }
             }
+        }
+
+        // Search state on ordered maps, for any vertex descriptor
+        template <typename VertexDescriptor_T>
+        struct map_search_state {
+            std::map<VertexDescriptor_T, double> dist;
+            std::map<VertexDescriptor_T, std::vector<VertexDescriptor_T>>& parent_map;
+            std::set<VertexDescriptor_T> visited;
+
+            bool insert(VertexDescriptor_T const& v) { return dist.try_emplace(v, 0.0).second; }
+            bool settle(VertexDescriptor_T const& v) { return visited.insert(v).second; }
+            double& distance(VertexDescriptor_T const& v) { return dist[v]; }
+            std::vector<VertexDescriptor_T>& parents(VertexDescriptor_T const& v) { return parent_map[v]; }
+        };
+
+        template <typename Graph_T, typename EdOp_T, typename PriorityFn_T>
+        shortest_path_tree<typename Graph_T::vertex_descriptor>
+        shortestPathTree(Graph_T const& graph,
+                         typename Graph_T::vertex_descriptor const& start,
+                         EdOp_T distance_op,
+                         PriorityFn_T priority_fn)
+        {
+            using VertexDescriptor = typename Graph_T::vertex_descriptor;
+
+            shortest_path_tree<VertexDescriptor> tree{start, {}};
+            map_search_state<VertexDescriptor> state{{}, tree.parents, {}};
+            shortestPathSearch(graph, start, distance_op, priority_fn, state);
+
+            return tree;
+        }
+
+        /**
+         * All shortest paths start -> goal, without start. parents_of(v) is
+         * nullptr for vertices the search did not reach.
+         */
+        template <typename VertexDescriptor_T, typename ParentsOf_T>
+        std::vector<std::vector<VertexDescriptor_T>>
+        shortestPathsFromParents(VertexDescriptor_T const& start,
+                                 VertexDescriptor_T const& goal,
+                                 ParentsOf_T const& parents_of)
+        {
+            using VertexDescriptor = VertexDescriptor_T;
 
             std::vector<std::vector<VertexDescriptor>> result;
 
@@ -74,9 +139,10 @@ namespace dte3611::graph::algorithms
                     result.push_back(path);
                     return;
                 }
-                if (!parents.contains(v)) return;
+                auto const* parents = parents_of(v);
+                if (!parents) return;
 
-                for (auto& p : parents[v]) {
+                for (auto& p : *parents) {
                     path.insert(path.begin(), v);
                     buildPaths(p, path);
                     path.erase(path.begin());
@@ -88,6 +154,52 @@ namespace dte3611::graph::algorithms
 
             return result;
         }
+
+        // All shortest paths start -> goal, without start, read off the tree
+        template <typename VertexDescriptor_T>
+        std::vector<std::vector<VertexDescriptor_T>>
+        shortestPathsFromTree(shortest_path_tree<VertexDescriptor_T> const& tree,
+                              VertexDescriptor_T const& goal)
+        {
+            return shortestPathsFromParents(
+                tree.start, goal,
+                [&tree](VertexDescriptor_T const& v) -> std::vector<VertexDescriptor_T> const* {
+                    auto const it = tree.parents.find(v);
+                    return it == tree.parents.end() ? nullptr : &it->second;
+                });
+        }
+
+        template <typename Graph_T, typename EdOp_T, typename PriorityFn_T>
+        std::vector<std::vector<typename Graph_T::vertex_descriptor>>
+        shortestPathsImpl(utils::TraversalWorkspace<Graph_T>& workspace,
+                          Graph_T const& graph,
+                          typename Graph_T::vertex_descriptor const& start,
+                          typename Graph_T::vertex_descriptor const& goal,
+                          EdOp_T distance_op,
+                          PriorityFn_T priority_fn)
+        {
+            using VertexDescriptor = typename Graph_T::vertex_descriptor;
+
+            workspace.reset(graph);
+            shortestPathSearch(graph, start, distance_op, priority_fn, workspace);
+            return shortestPathsFromParents(
+                start, goal,
+                [&workspace](VertexDescriptor const& v) -> std::vector<VertexDescriptor> const* {
+                    return workspace.contains(v) ? &workspace.parents(v) : nullptr;
+                });
+        }
+
+        template <typename Graph_T, typename EdOp_T, typename PriorityFn_T>
+        std::vector<std::vector<typename Graph_T::vertex_descriptor>>
+        shortestPathsImpl(Graph_T const& graph,
+                          typename Graph_T::vertex_descriptor const& start,
+                          typename Graph_T::vertex_descriptor const& goal,
+                          EdOp_T distance_op,
+                          PriorityFn_T priority_fn)
+        {
+            return shortestPathsFromTree(
+                shortestPathTree(graph, start, distance_op, priority_fn), goal);
+        }
     }
 
     template <predef::concepts::graph::BidirectionalGraph Graph_T,
@@ -103,6 +215,22 @@ namespace dte3611::graph::algorithms
         return detail::shortestPathsImpl(graph, start, goal, distance_op, priority_fn);
     }
 
+    // Same search on a reused workspace -- costs only what it reaches
+    template <predef::concepts::graph::BidirectionalGraph Graph_T,
+              predef::concepts::graph::EdgeDistanceOperator<Graph_T> EdOp_T
+              = operators::DefaultEdgeDistanceOperator<>>
+    std::vector<std::vector<typename Graph_T::vertex_descriptor>>
+    dijkstraShortestPaths(utils::TraversalWorkspace<Graph_T>& workspace,
+                          Graph_T const& graph,
+                          typename Graph_T::vertex_descriptor const& start,
+                          typename Graph_T::vertex_descriptor const& goal,
+                          EdOp_T distance_op = EdOp_T())
+    {
+        auto priority_fn = [](auto dist, auto) { return dist; };
+        return detail::shortestPathsImpl(workspace, graph, start, goal, distance_op,
+                                         priority_fn);
+    }
+
 
 }   // namespace dte3611::graph::algorithms
 
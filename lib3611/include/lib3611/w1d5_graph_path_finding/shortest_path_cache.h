@@ -0,0 +1,321 @@
+#ifndef DTE3611_DAY5_SHORTEST_PATH_CACHE_H
+#define DTE3611_DAY5_SHORTEST_PATH_CACHE_H
+
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
+#include "astar_search.h"
+#include "dijkstra_shortest_paths.h"
+#include "operators.h"
+
+// concepts
+#include "../utils/concepts/graphs.h"
+#include "../utils/concepts/operators.h"
+
+// stl
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace dte3611::graph::algorithms
+{
+
+  namespace detail
+  {
+
+    // Bytes per std::map / std::list node beyond the payload (libstdc++)
+    inline constexpr std::size_t cache_node_overhead = 32;
+
+    template <typename VertexDescriptor_T>
+    struct path_cache_key {
+      std::uint64_t      version;
+      VertexDescriptor_T start;
+      VertexDescriptor_T goal;
+      bool               is_tree;   // a whole tree -- goal is unused
+      std::type_index    op;
+
+      bool operator==(path_cache_key const&) const = default;
+    };
+
+    template <typename VertexDescriptor_T>
+    struct path_cache_key_hash {
+      std::size_t operator()(path_cache_key<VertexDescriptor_T> const& key) const
+      {
+        std::hash<VertexDescriptor_T> const vd_hash;
+
+        std::size_t h = std::hash<std::uint64_t>{}(key.version);
+        auto mix = [&h](std::size_t v) {
+          h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+        };
+        mix(vd_hash(key.start));
+        mix(vd_hash(key.goal));
+        mix(key.is_tree);
+        mix(key.op.hash_code());
+        return h;
+      }
+    };
+
+    /**
+     * Paths to one goal, flattened: path i is
+     * vertices[offsets[i], offsets[i + 1]).
+     */
+    template <typename VertexDescriptor_T>
+    struct compact_paths {
+      std::vector<VertexDescriptor_T> vertices;
+      std::vector<std::uint32_t>      offsets{0};
+
+      explicit compact_paths(
+        std::vector<std::vector<VertexDescriptor_T>> const& paths)
+      {
+        for (auto const& path : paths) {
+          vertices.insert(vertices.end(), path.begin(), path.end());
+          offsets.push_back(static_cast<std::uint32_t>(vertices.size()));
+        }
+        vertices.shrink_to_fit();
+        offsets.shrink_to_fit();
+      }
+
+      std::vector<std::vector<VertexDescriptor_T>> expand() const
+      {
+        std::vector<std::vector<VertexDescriptor_T>> paths;
+        paths.reserve(offsets.size() - 1);
+        for (std::size_t i = 0; i + 1 < offsets.size(); ++i)
+          paths.emplace_back(vertices.begin() + offsets[i],
+                             vertices.begin() + offsets[i + 1]);
+        return paths;
+      }
+
+      std::size_t bytes() const
+      {
+        return vertices.capacity() * sizeof(VertexDescriptor_T)
+               + offsets.capacity() * sizeof(std::uint32_t);
+      }
+    };
+
+    template <typename VertexDescriptor_T>
+    std::size_t treeBytes(shortest_path_tree<VertexDescriptor_T> const& tree)
+    {
+      std::size_t bytes = 0;
+      for (auto const& [v, parents] : tree.parents)
+        bytes += cache_node_overhead + sizeof(v) + sizeof(parents)
+                 + parents.capacity() * sizeof(VertexDescriptor_T);
+      return bytes;
+    }
+
+  }   // namespace detail
+
+
+  /**
+   * LRU cache in front of dijkstraShortestPaths / aStarSearch for repeated
+   * (start, goal) queries on one graph that changes rarely. The graph is
+   * bound at construction and must outlive the cache; keys carry no graph
+   * identity, so use one cache per graph.
+   *
+   * Entries are keyed on (version, start, goal, operator type). A query
+   * first looks for its own paths. A Dijkstra query then looks for a cached
+   * shortest-path tree from the same start and distance operator, and only
+   * then searches, caching the full tree it computes -- later goals from
+   * that start are served without a search. A tree holds exactly what the
+   * uncached dijkstraShortestPaths builds, so answers, path order included,
+   * are the same. A* queries never read or store trees: their parent lists
+   * follow A*'s own settle order, and with an inconsistent heuristic A*
+   * may return other paths, so only its own answers are replayed.
+   *
+   * Operators are identified by type: two operator objects of the same
+   * type must yield the same distances (and heuristics). The cache does not
+   * watch the graph -- call invalidate() whenever it (or an operator's
+   * state) changes. Entries are evicted least recently used first once
+   * their estimated size exceeds the memory budget; a single entry larger
+   * than the budget is not cached. All members are thread-safe; searches
+   * run outside the lock.
+   */
+  template <predef::concepts::graph::BidirectionalGraph Graph_T>
+  class ShortestPathCache {
+  public:
+    using VertexDescriptor = typename Graph_T::vertex_descriptor;
+    using Paths            = std::vector<std::vector<VertexDescriptor>>;
+
+    struct Statistics {
+      std::size_t path_hits{0};
+      std::size_t tree_hits{0};
+      std::size_t misses{0};
+    };
+
+    ShortestPathCache(Graph_T const& graph, std::size_t memory_budget)
+      : m_graph{&graph}, m_budget{memory_budget}
+    {
+    }
+
+    Graph_T const& graph() const { return *m_graph; }
+
+    template <predef::concepts::graph::EdgeDistanceOperator<Graph_T> EdOp_T
+              = operators::DefaultEdgeDistanceOperator<>>
+    Paths dijkstraShortestPaths(VertexDescriptor const& start,
+                                VertexDescriptor const& goal,
+                                EdOp_T                  distance_op = EdOp_T())
+    {
+      auto const op = std::type_index(typeid(EdOp_T));
+      return query(start, goal, op, op, [&](std::uint64_t version) {
+        auto tree = std::make_shared<Tree const>(detail::shortestPathTree(
+          *m_graph, start, distance_op, [](auto dist, auto) { return dist; }));
+        auto paths = detail::shortestPathsFromTree(*tree, goal);
+        insertTree({version, start, start, true, op}, std::move(tree));
+        return paths;
+      });
+    }
+
+    template <predef::concepts::graph::ShortestPathHeuristicOperator<Graph_T> HOp_T,
+              predef::concepts::graph::EdgeDistanceOperator<Graph_T> EdOp_T
+              = operators::DefaultEdgeDistanceOperator<>>
+    Paths aStarSearch(VertexDescriptor const& start, VertexDescriptor const& goal,
+                      HOp_T h_op, EdOp_T distance_op = EdOp_T())
+    {
+      return query(start, goal, std::type_index(typeid(std::pair<HOp_T, EdOp_T>)),
+                   std::nullopt, [&](std::uint64_t) {
+                     return algorithms::aStarSearch(*m_graph, start, goal, h_op,
+                                                    distance_op);
+                   });
+    }
+
+    // Drops every entry; queries from before the call are never served again
+    void invalidate()
+    {
+      std::lock_guard lock(m_mutex);
+      ++m_version;
+      m_lru.clear();
+      m_index.clear();
+      m_bytes = 0;
+    }
+
+    std::uint64_t version() const
+    {
+      std::lock_guard lock(m_mutex);
+      return m_version;
+    }
+
+    std::size_t memoryBudget() const { return m_budget; }
+
+    std::size_t memoryUsage() const
+    {
+      std::lock_guard lock(m_mutex);
+      return m_bytes;
+    }
+
+    std::size_t size() const
+    {
+      std::lock_guard lock(m_mutex);
+      return m_lru.size();
+    }
+
+    Statistics statistics() const
+    {
+      std::lock_guard lock(m_mutex);
+      return m_stats;
+    }
+
+  private:
+    using Tree  = detail::shortest_path_tree<VertexDescriptor>;
+    using Key   = detail::path_cache_key<VertexDescriptor>;
+    using Value = std::variant<detail::compact_paths<VertexDescriptor>,
+                               std::shared_ptr<Tree const>>;
+
+    struct Entry {
+      Key         key;
+      Value       value;
+      std::size_t bytes;
+    };
+
+    using Lru = std::list<Entry>;
+
+    // Lookup order: paths, tree from start (if tree_op), search(version)
+    template <typename Search_T>
+    Paths query(VertexDescriptor const& start, VertexDescriptor const& goal,
+                std::type_index op, std::optional<std::type_index> tree_op,
+                Search_T const& search)
+    {
+      std::shared_ptr<Tree const> tree;
+      std::uint64_t               version;
+      {
+        std::lock_guard lock(m_mutex);
+        version = m_version;
+
+        if (auto const* entry = touch({version, start, goal, false, op})) {
+          ++m_stats.path_hits;
+          return std::get<0>(entry->value).expand();
+        }
+
+        auto const* entry
+          = tree_op ? touch({version, start, start, true, *tree_op}) : nullptr;
+        if (entry) {
+          ++m_stats.tree_hits;
+          tree = std::get<1>(entry->value);
+        }
+        else
+          ++m_stats.misses;
+      }
+
+      auto paths = tree ? detail::shortestPathsFromTree(*tree, goal) : search(version);
+      detail::compact_paths<VertexDescriptor> compact(paths);
+      auto const bytes = compact.bytes();
+      insert({{version, start, goal, false, op}, std::move(compact), bytes});
+      return paths;
+    }
+
+    void insertTree(Key const& key, std::shared_ptr<Tree const> tree)
+    {
+      auto const bytes = detail::treeBytes(*tree);
+      insert({key, std::move(tree), bytes});
+    }
+
+    // Entry for key moved to the front, or nullptr; requires the lock
+    Entry const* touch(Key const& key)
+    {
+      auto const it = m_index.find(key);
+      if (it == m_index.end()) return nullptr;
+      m_lru.splice(m_lru.begin(), m_lru, it->second);
+      return &*it->second;
+    }
+
+    void insert(Entry entry)
+    {
+      entry.bytes += sizeof(Entry) + 2 * detail::cache_node_overhead;
+      if (entry.bytes > m_budget) return;
+
+      std::lock_guard lock(m_mutex);
+      // Computed against a version since invalidated, or raced by another thread
+      if (entry.key.version != m_version or m_index.contains(entry.key)) return;
+
+      m_bytes += entry.bytes;
+      m_lru.push_front(std::move(entry));
+      m_index.emplace(m_lru.front().key, m_lru.begin());
+
+      while (m_bytes > m_budget) {
+        m_bytes -= m_lru.back().bytes;
+        m_index.erase(m_lru.back().key);
+        m_lru.pop_back();
+      }
+    }
+
+    Graph_T const*     m_graph;
+    std::size_t const  m_budget;
+    mutable std::mutex m_mutex;
+    std::uint64_t      m_version{0};
+    std::size_t        m_bytes{0};
+    Statistics         m_stats;
+    Lru                m_lru;
+    std::unordered_map<Key, typename Lru::iterator, detail::path_cache_key_hash<VertexDescriptor>>
+      m_index;
+  };
+
+}   // namespace dte3611::graph::algorithms
+
+#endif   // DTE3611_DAY5_SHORTEST_PATH_CACHE_H
@@ -1,6 +1,9 @@
 #ifndef DTE3611_WEEK2_BELLMAN_FORD_H
 #define DTE3611_WEEK2_BELLMAN_FORD_H
 
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
 #include "../w1d5_graph_path_finding/operators.h"
 
 // concepts
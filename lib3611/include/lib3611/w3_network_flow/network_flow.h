@@ -1,13 +1,18 @@
 #ifndef DTE3611_WEEK3_NETWORK_FLOW_H
 #define DTE3611_WEEK3_NETWORK_FLOW_H
 
+// CsrGraph's BGL overloads first, see csr_graph_bgl.h
+#include "../utils/csr_graph_bgl.h"
+
 // concepts
 #include "../utils/concepts/graphs.h"
 #include "../utils/concepts/operators.h"
 
+// utils
+#include "../utils/traversal_workspace.h"
+
 // stl
 #include <vector>
-#include <queue>
 #include <limits>
 #include <algorithm>
 #include <optional>
@@ -32,27 +37,23 @@ namespace dte3611::np::algorithms
       template <typename Graph_T, typename VertexDescriptor, typename EdgeDescriptor>
       std::optional<std::pair<std::vector<ResidualEdge<EdgeDescriptor>>, int>>
       findAugmentingPathBFS(
+          graph::utils::TraversalWorkspace<Graph_T>& workspace,
           Graph_T const& graph,
           VertexDescriptor const& source,
           VertexDescriptor const& sink)
       {
         using ResEdge = ResidualEdge<EdgeDescriptor>;
 
-        auto const num_vertices = boost::num_vertices(graph);
-
-        // for each vertex, store the residual edge that leads to it
-        std::vector<std::optional<ResEdge>> parent(num_vertices, std::nullopt);
-        std::vector<bool> visited(num_vertices, false);
-
-        std::queue<VertexDescriptor> queue;
+        // for each reached vertex, the vertex and edge that lead to it
+        workspace.reset(graph);
+        auto& queue = workspace.queue();
         queue.push(source);
-        visited[source] = true;
+        workspace.insert(source);
 
         bool found_sink = false;
 
         while (!queue.empty() && !found_sink) {
-          auto u = queue.front();
-          queue.pop();
+          auto u = queue.pop();
 
           // Explore forward edges
           auto [out_begin, out_end] = boost::out_edges(u, graph);
@@ -62,9 +63,9 @@ namespace dte3611::np::algorithms
 
             int residual_cap = graph[e].capacity - graph[e].flow;
 
-            if (!visited[v] && residual_cap > 0) {
-              visited[v] = true;
-              parent[v] = ResEdge{e, true, residual_cap};
+            if (residual_cap > 0 && workspace.insert(v)) {
+              workspace.parent(v) = u;
+              workspace.parentEdge(v) = e;
               queue.push(v);
 
               if (v == sink) {
@@ -84,9 +85,9 @@ namespace dte3611::np::algorithms
 
             int residual_cap = graph[e].flow;
 
-            if (!visited[v] && residual_cap > 0) {
-              visited[v] = true;
-              parent[v] = ResEdge{e, false, residual_cap};
+            if (residual_cap > 0 && workspace.insert(v)) {
+              workspace.parent(v) = u;
+              workspace.parentEdge(v) = e;
               queue.push(v);
 
               if (v == sink) {
@@ -107,16 +108,19 @@ namespace dte3611::np::algorithms
 
         VertexDescriptor current = sink;
         while (current != source) {
-          auto const& edge_info = parent[current].value();
-          path.push_back(edge_info);
-          bottleneck = std::min(bottleneck, edge_info.residual_capacity);
+          auto const e = workspace.parentEdge(current);
+          auto const previous = workspace.parent(current);
+
+          // Forward edges run previous -> current, backward ones the other way
+          bool const is_forward = boost::source(e, graph) == previous
+                                  && boost::target(e, graph) == current;
+          int const residual_cap = is_forward ? graph[e].capacity - graph[e].flow
+                                              : graph[e].flow;
+          path.push_back(ResEdge{e, is_forward, residual_cap});
+          bottleneck = std::min(bottleneck, residual_cap);
 
           // Move to previous vertex
-          if (edge_info.is_forward) {
-            current = boost::source(edge_info.original_edge, graph);
-          } else {
-            current = boost::target(edge_info.original_edge, graph);
-          }
+          current = previous;
         }
 
         // We reverse to get path from source to sink
@@ -158,9 +162,10 @@ namespace dte3611::np::algorithms
                 graph::operators::DefaultEdgeCapacityOperator<>,
             predef::concepts::graph::EdgeCapacityOperator<Graph_T> EdFOp_T =
                 graph::operators::DefaultEdgeFlowOperator<>>
-    int maxFlow([[maybe_unused]] Graph_T& graph,
-              [[maybe_unused]] typename Graph_T::vertex_descriptor const& source,
-              [[maybe_unused]] typename Graph_T::vertex_descriptor const& sink,
+    int maxFlow(graph::utils::TraversalWorkspace<Graph_T>& workspace,
+              Graph_T& graph,
+              typename Graph_T::vertex_descriptor const& source,
+              typename Graph_T::vertex_descriptor const& sink,
               [[maybe_unused]] EdCOp_T capacity_op = EdCOp_T(),
               [[maybe_unused]] EdFOp_T flow_op = EdFOp_T()) {
       using VertexDescriptor = typename Graph_T::vertex_descriptor;
@@ -177,7 +182,7 @@ namespace dte3611::np::algorithms
       // We repeatedly find augmenting paths and push flow
       while (true) {
         auto result = detail::findAugmentingPathBFS<Graph_T, VertexDescriptor, EdgeDescriptor>(
-            graph, source, sink);
+            workspace, graph, source, sink);
 
         if (!result.has_value()) {
           // No more augmenting paths, we are done
@@ -203,6 +208,21 @@ namespace dte3611::np::algorithms
       return total_flow;
     }
 
+    // One workspace serves every augmenting-path BFS -- O(V) once, not per path
+    template <predef::concepts::graph::BidirectionalGraph Graph_T,
+            predef::concepts::graph::EdgeCapacityOperator<Graph_T> EdCOp_T =
+                graph::operators::DefaultEdgeCapacityOperator<>,
+            predef::concepts::graph::EdgeCapacityOperator<Graph_T> EdFOp_T =
+                graph::operators::DefaultEdgeFlowOperator<>>
+    int maxFlow([[maybe_unused]] Graph_T& graph,
+              [[maybe_unused]] typename Graph_T::vertex_descriptor const& source,
+              [[maybe_unused]] typename Graph_T::vertex_descriptor const& sink,
+              [[maybe_unused]] EdCOp_T capacity_op = EdCOp_T(),
+              [[maybe_unused]] EdFOp_T flow_op = EdFOp_T()) {
+      graph::utils::TraversalWorkspace<Graph_T> workspace;
+      return maxFlow(workspace, graph, source, sink, capacity_op, flow_op);
+    }
+
     template <typename Graph_T>
     void cycleCanceling(Graph_T& graph)
     {